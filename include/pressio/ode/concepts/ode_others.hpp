@@ -62,6 +62,42 @@ template <class T, class AuxT, class ...Args>
 using StronglySteppableWithAuxiliaryArgs = SteppableWithAuxiliaryArgs<T, AuxT, Args...>;
 
 
+template <class T, class enable = void>
+struct StronglySteppableWithErrorEstimate : std::false_type{};
+
+template <class T>
+struct StronglySteppableWithErrorEstimate<
+  T,
+  std::enable_if_t<
+    StronglySteppable<T>::value
+    && std::is_same<
+      decltype(std::declval<T const &>().localErrorEstimate()),
+      typename T::state_type const &
+      >::value
+    && std::is_convertible<
+      decltype(std::declval<T const &>().errorEstimateOrder()), int
+      >::value
+    >
+  > : std::true_type{};
+
+template <class T, class AuxT, class ...Args>
+struct StronglySteppableWithAuxiliaryArgsAndErrorEstimate : std::false_type{};
+
+template <class T, class AuxT, class ...Args>
+struct StronglySteppableWithAuxiliaryArgsAndErrorEstimate<
+  std::enable_if_t<
+    StronglySteppableWithAuxiliaryArgs<void, T, AuxT, Args...>::value
+    && std::is_same<
+      decltype(std::declval<T const &>().localErrorEstimate()),
+      typename T::state_type const &
+      >::value
+    && std::is_convertible<
+      decltype(std::declval<T const &>().errorEstimateOrder()), int
+      >::value
+    >,
+  T, AuxT, Args...
+  > : std::true_type{};
+
 template <class T, class IndVarType, class StateType, class enable = void>
 struct StateObserver : std::false_type{};
 
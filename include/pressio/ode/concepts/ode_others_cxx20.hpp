@@ -45,6 +45,24 @@ concept StronglySteppable = Steppable<T>;
 template <class T, class AuxT, class ...Args>
 concept StronglySteppableWithAuxiliaryArgs = SteppableWithAuxiliaryArgs<T, AuxT, Args...>;
 
+template <class T>
+concept StronglySteppableWithErrorEstimate =
+  StronglySteppable<T>
+  && requires(const T & A)
+  {
+    { A.localErrorEstimate() } -> std::same_as<const typename T::state_type &>;
+    { A.errorEstimateOrder() } -> std::convertible_to<int>;
+  };
+
+template <class T, class AuxT, class ...Args>
+concept StronglySteppableWithAuxiliaryArgsAndErrorEstimate =
+  StronglySteppableWithAuxiliaryArgs<T, AuxT, Args...>
+  && requires(const T & A)
+  {
+    { A.localErrorEstimate() } -> std::same_as<const typename T::state_type &>;
+    { A.errorEstimateOrder() } -> std::convertible_to<int>;
+  };
+
 template <class T, class IndVarType, class StateType>
 concept StateObserver =
   requires(T && A,
@@ -111,6 +111,31 @@ struct OdeSystemFusingMassMatrixAndRhs<
   > : std::true_type{};
 
 
+template<class T, class enable = void>
+struct OdeSystemWithConstantMassMatrix : std::false_type{};
+
+template<class T>
+struct OdeSystemWithConstantMassMatrix<
+  T,
+  std::enable_if_t<
+       OdeSystem<T>::value
+    && ::pressio::has_mass_matrix_typedef<T>::value
+    && std::is_copy_constructible<typename T::mass_matrix_type>::value
+    && ::pressio::ode::has_const_create_mass_matrix_method_return_result<
+      T, typename T::mass_matrix_type >::value
+    //
+    && std::is_void<
+      decltype(
+	       std::declval<T const>().massMatrix
+	       (
+		std::declval<typename T::mass_matrix_type &>()
+	       )
+	   )
+      >::value
+   >
+  > : std::true_type{};
+
+
 template<class T, class enable = void>
 struct CompleteOdeSystem : std::false_type{};
 
@@ -240,6 +265,19 @@ struct RealValuedOdeSystemFusingMassMatrixAndRhs<
   > : std::true_type{};
 
 
+template<class T, class enable = void>
+struct RealValuedOdeSystemWithConstantMassMatrix : std::false_type{};
+
+template<class T>
+struct RealValuedOdeSystemWithConstantMassMatrix<
+  T, std::enable_if_t<
+    OdeSystemWithConstantMassMatrix<T>::value
+  && RealValuedOdeSystem<T>::value
+  && std::is_floating_point< scalar_trait_t<typename T::mass_matrix_type> >::value
+  >
+  > : std::true_type{};
+
+
 template<class T, class enable = void>
 struct RealValuedCompleteOdeSystem : std::false_type{};
 
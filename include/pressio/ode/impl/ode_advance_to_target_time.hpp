@@ -204,5 +204,167 @@ void to_target_time_with_step_size_policy(StepperType & stepper,
 #endif
 }
 
+/*
+  weighted RMS norm of the error estimate:
+    sqrt( 1/N sum_i ( e_i / (absTol + relTol*|y_i|) )^2 )
+*/
+template <class ErrorType, class StateType, class ScalarType>
+ScalarType weighted_rms_error_norm(const ErrorType & error,
+				   const StateType & state,
+				   ScalarType absTol,
+				   ScalarType relTol,
+				   StateType & scratch1,
+				   StateType & scratch2)
+{
+  constexpr auto zero = ::pressio::utils::Constants<ScalarType>::zero();
+  constexpr auto one  = ::pressio::utils::Constants<ScalarType>::one();
+  constexpr auto tiny = std::numeric_limits<ScalarType>::min();
+
+  // scratch1 = absTol + relTol*|y|
+  ::pressio::ops::fill(scratch2, one);
+  ::pressio::ops::abs(scratch1, state);
+  ::pressio::ops::update(scratch1, relTol, scratch2, absTol);
+  // scratch2 = e / scratch1
+  ::pressio::ops::abs_pow(scratch2, scratch1, -one, tiny);
+  ::pressio::ops::elementwise_multiply(one, error, scratch2, zero, scratch1);
+
+  const auto n = static_cast<ScalarType>(::pressio::ops::extent(state, 0));
+  return ::pressio::ops::norm2(scratch1)/std::sqrt(n);
+}
+
+// steppers whose error estimate has a cost (e.g. the implicit ones)
+// compute it only after enableLocalErrorEstimate() is called
+template <class StepperType, class = void>
+struct stepper_has_enable_local_error_estimate : std::false_type{};
+
+template <class StepperType>
+struct stepper_has_enable_local_error_estimate<
+  StepperType,
+  mpl::void_t<decltype(std::declval<StepperType &>().enableLocalErrorEstimate())>
+  > : std::true_type{};
+
+template <class StepperType>
+std::enable_if_t< stepper_has_enable_local_error_estimate<StepperType>::value >
+enable_local_error_estimate(StepperType & stepper){
+  stepper.enableLocalErrorEstimate();
+}
+
+template <class StepperType>
+std::enable_if_t< !stepper_has_enable_local_error_estimate<StepperType>::value >
+enable_local_error_estimate(StepperType & /*stepper*/){}
+
+template <
+  class StepperType,
+  class IndVarType,
+  class StateType,
+  class ObserverType,
+  class ControllerType,
+  class ... Args>
+void to_target_time_with_error_control(StepperType & stepper,
+				       const IndVarType & start_time,
+				       const IndVarType & final_time,
+				       StateType & odeState,
+				       const IndVarType & initialStepSize,
+				       ControllerType & controller,
+				       ObserverType && observer,
+				       Args && ... args)
+{
+
+  if (final_time < start_time){
+    throw std::runtime_error("You cannot call the advancer with final time < start time.");
+  }
+
+  if (initialStepSize <= ::pressio::utils::Constants<IndVarType>::zero()){
+    throw std::runtime_error("The initial time step size must be positive.");
+  }
+
+  if (final_time == start_time){
+    return;
+  }
+
+  enable_local_error_estimate(stepper);
+
+  using step_t = typename StepCount::value_type;
+  IndVarType time = start_time;
+  IndVarType dt = initialStepSize;
+
+  // state at the beginning of the step, to restore it if the step
+  // is rejected, and scratch storage used to compute the error norm
+  auto stateAtStepStart = ::pressio::ops::clone(odeState);
+  auto scratch1 = ::pressio::ops::clone(odeState);
+  auto scratch2 = ::pressio::ops::clone(odeState);
+
+  // observe initial condition
+  observer(StepCount{0}, time, odeState);
+
+  step_t step = ::pressio::ode::first_step_value;
+  PRESSIOLOG_DEBUG("impl: advance_to_target_time_with_error_control");
+  constexpr auto eps = std::numeric_limits<IndVarType>::epsilon();
+  bool condition = true;
+  while (condition)
+    {
+      const auto stepWrap = ::pressio::ode::StepCount(step);
+
+      bool accepted = false;
+      while (!accepted)
+	{
+	  // do not step past the final time
+	  const bool reachesFinalTime = (time + dt >= final_time);
+	  if (reachesFinalTime){
+	    dt = final_time - time;
+	  }
+	  else if (dt < controller.minStepSize()){
+	    throw std::runtime_error("The time step size cannot be smaller than the minimum value.");
+	  }
+
+	  print_step_and_current_time(step, time, dt);
+	  ::pressio::ops::deep_copy(stateAtStepStart, odeState);
+	  try
+	  {
+	    stepper(odeState,
+		    ::pressio::ode::StepStartAt<IndVarType>(time),
+		    stepWrap,
+		    ::pressio::ode::StepSize<IndVarType>(dt),
+		    std::forward<Args>(args)...);
+	  }
+	  catch (::pressio::eh::TimeStepFailure const & e)
+	  {
+	    // e.g. the nonlinear solve failed: reject and retry with a smaller step
+	    controller.evaluateFailedStep(step, time, dt);
+	    PRESSIOLOG_CRITICAL("time step={} failed, retrying with dt={}", step, dt);
+	    ::pressio::ops::deep_copy(odeState, stateAtStepStart);
+	    continue;
+	  }
+
+	  const IndVarType errorNorm = weighted_rms_error_norm
+	    (stepper.localErrorEstimate(), odeState,
+	     controller.absoluteTolerance(), controller.relativeTolerance(),
+	     scratch1, scratch2);
+
+	  const IndVarType dtUsed = dt;
+	  accepted = controller.evaluateStep(step, time, errorNorm,
+					     stepper.errorEstimateOrder(), dt);
+	  if (accepted){
+	    time = reachesFinalTime ? final_time : time + dtUsed;
+	  }
+	  else{
+	    PRESSIOLOG_DEBUG("time step={} rejected with error norm={}, retrying with dt={}",
+			     step, errorNorm, dt);
+	    ::pressio::ops::deep_copy(odeState, stateAtStepStart);
+	  }
+	}
+
+      observer(::pressio::ode::StepCount(step), time, odeState);
+
+      // use numeric limits to avoid tricky roundoff accumulation
+      if ( std::abs(time - final_time) <= eps ) condition = false;
+
+      // if we are over the final time, stop too
+      if ( time > final_time ) condition = false;
+
+      step++;
+    }
+}
+
 }}}//end namespace pressio::ode::impl
 #endif  // ODE_IMPL_ODE_ADVANCE_TO_TARGET_TIME_HPP_
@@ -0,0 +1,475 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_explicit_stepper_kernels.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_IMPL_ODE_EXPLICIT_STEPPER_KERNELS_HPP_
+#define ODE_IMPL_ODE_EXPLICIT_STEPPER_KERNELS_HPP_
+
+namespace pressio{ namespace ode{ namespace impl{
+
+/*
+  step kernels shared by the explicit steppers without mass matrix.
+
+  RhsContainerType and AuxStatesContainerType are anything supporting
+  operator[] returning a reference to a rhs/state instance: a std::vector
+  for the stepper where the scheme is chosen at runtime, or a std::array
+  for the stepper where the scheme is known at compile time.
+  The number of rhs and auxiliary states needed by each scheme is given
+  by explicit_scheme_num_rhs and explicit_scheme_num_aux_states below.
+*/
+
+template<class SchemeTag> struct explicit_scheme_num_rhs;
+
+template<> struct explicit_scheme_num_rhs<ode::ForwardEuler>
+  : std::integral_constant<std::size_t, 1>{};
+
+template<> struct explicit_scheme_num_rhs<ode::RungeKutta4>
+  : std::integral_constant<std::size_t, 4>{};
+
+template<> struct explicit_scheme_num_rhs<ode::AdamsBashforth2>
+  : std::integral_constant<std::size_t, 2>{};
+
+template<> struct explicit_scheme_num_rhs<ode::SSPRungeKutta3>
+  : std::integral_constant<std::size_t, 1>{};
+
+template<class SchemeTag> struct explicit_scheme_num_aux_states;
+
+template<> struct explicit_scheme_num_aux_states<ode::ForwardEuler>
+  : std::integral_constant<std::size_t, 0>{};
+
+template<> struct explicit_scheme_num_aux_states<ode::RungeKutta4>
+  : std::integral_constant<std::size_t, 1>{};
+
+template<> struct explicit_scheme_num_aux_states<ode::AdamsBashforth2>
+  : std::integral_constant<std::size_t, 0>{};
+
+template<> struct explicit_scheme_num_aux_states<ode::SSPRungeKutta3>
+  : std::integral_constant<std::size_t, 1>{};
+
+// generic tableau: one rhs per stage and one state for the stage values
+template<class TableauType> struct explicit_scheme_num_rhs<ode::ExplicitRungeKutta<TableauType>>
+  : std::integral_constant<std::size_t, TableauType::stages>{};
+
+template<class TableauType> struct explicit_scheme_num_aux_states<ode::ExplicitRungeKutta<TableauType>>
+  : std::integral_constant<std::size_t, 1>{};
+
+// embedded pair: same as above plus one state for the error estimate
+template<class TableauType> struct explicit_scheme_num_rhs<ode::EmbeddedRungeKutta<TableauType>>
+  : std::integral_constant<std::size_t, TableauType::stages>{};
+
+template<class TableauType> struct explicit_scheme_num_aux_states<ode::EmbeddedRungeKutta<TableauType>>
+  : std::integral_constant<std::size_t, 2>{};
+
+// low-storage 2N: the running increment and the rhs, no auxiliary state
+template<class TableauType> struct explicit_scheme_num_rhs<ode::LowStorageRungeKutta<TableauType>>
+  : std::integral_constant<std::size_t, 2>{};
+
+template<class TableauType> struct explicit_scheme_num_aux_states<ode::LowStorageRungeKutta<TableauType>>
+  : std::integral_constant<std::size_t, 0>{};
+
+// schemes computing a local error estimate at each step
+template<class SchemeTag>
+struct explicit_scheme_has_error_estimate : std::false_type{};
+
+template<class TableauType>
+struct explicit_scheme_has_error_estimate<ode::EmbeddedRungeKutta<TableauType>> : std::true_type{
+  // the estimate is that of the lower order method of the pair
+  static constexpr int order = TableauType::embedded_order;
+  // index into the auxiliary states where the estimate is stored
+  static constexpr std::size_t aux_state_index = 1;
+};
+
+template<
+  class SystemType,
+  class StateType,
+  class AuxStatesContainerType,
+  class RhsContainerType,
+  class IndVarType,
+  class RhsObserverType
+  >
+void explicit_step_no_mass_matrix(ode::ForwardEuler,
+				  const SystemType & system,
+				  StateType & odeState,
+				  AuxStatesContainerType & /*auxStates*/,
+				  RhsContainerType & rhsInstances,
+				  const IndVarType & stepStartTime,
+				  const IndVarType & stepSize,
+				  ::pressio::ode::StepCount stepNumber,
+				  RhsObserverType & rhsObserver)
+{
+  PRESSIOLOG_DEBUG("euler forward stepper: do step");
+
+  //eval rhs
+  auto & rhs = rhsInstances[0];
+  system.rhs(odeState, stepStartTime, rhs);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
+
+  // y = y + stepSize * rhs
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+  ::pressio::ops::update(odeState, one, rhs, stepSize);
+}
+
+template<
+  class SystemType,
+  class StateType,
+  class AuxStatesContainerType,
+  class RhsContainerType,
+  class IndVarType,
+  class RhsObserverType
+  >
+void explicit_step_no_mass_matrix(ode::AdamsBashforth2,
+				  const SystemType & system,
+				  StateType & odeState,
+				  AuxStatesContainerType & /*auxStates*/,
+				  RhsContainerType & rhsInstances,
+				  const IndVarType & stepStartTime,
+				  const IndVarType & stepSize,
+				  ::pressio::ode::StepCount stepNumber,
+				  RhsObserverType & rhsObserver)
+{
+  PRESSIOLOG_DEBUG("adams-bashforth2 stepper: do step");
+
+  // // y_n+1 = y_n + stepSize*[ (3/2)*f(y_n, t_n) - (1/2)*f(y_n-1, t_n-1) ]
+
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+  const auto cfn   = ::pressio::utils::Constants<scalar_type>::threeOvTwo()*stepSize;
+  const auto cfnm1 = ::pressio::utils::Constants<scalar_type>::negOneHalf()*stepSize;
+
+  if (stepNumber.get()==1){
+    // use Euler forward or we could use something else here maybe RK4
+    auto & rhs = rhsInstances[0];
+    system.rhs(odeState, stepStartTime, rhs);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
+    ::pressio::ops::update(odeState, one, rhs, stepSize);
+  }
+  else{
+    auto & fn   = rhsInstances[0];
+    auto & fnm1 = rhsInstances[1];
+    // fn -> fnm1
+    ::pressio::ops::deep_copy(fnm1, fn);
+
+    system.rhs(odeState, stepStartTime, fn);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, fn);
+    ::pressio::ops::update(odeState, one, fn, cfn, fnm1, cfnm1);
+  }
+}
+
+template<
+  class SystemType,
+  class StateType,
+  class AuxStatesContainerType,
+  class RhsContainerType,
+  class IndVarType,
+  class RhsObserverType
+  >
+void explicit_step_no_mass_matrix(ode::SSPRungeKutta3,
+				  const SystemType & system,
+				  StateType & odeState,
+				  AuxStatesContainerType & auxStates,
+				  RhsContainerType & rhsInstances,
+				  const IndVarType & stepStartTime,
+				  const IndVarType & stepSize,
+				  ::pressio::ode::StepCount stepNumber,
+				  RhsObserverType & rhsObserver)
+{
+  PRESSIOLOG_DEBUG("ssprk3 stepper: do step");
+
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto zero  = ::pressio::utils::Constants<scalar_type>::zero();
+  constexpr auto one   = ::pressio::utils::Constants<scalar_type>::one();
+  constexpr auto two   = ::pressio::utils::Constants<scalar_type>::two();
+  constexpr auto three = ::pressio::utils::Constants<scalar_type>::three();
+  constexpr auto four  = ::pressio::utils::Constants<scalar_type>::four();
+  constexpr auto oneOvThree = one/three;
+  constexpr auto twoOvThree = two/three;
+  constexpr auto threeOvFour = three/four;
+  constexpr auto fourInv = one/four;
+
+  auto & rhs0 = rhsInstances[0];
+  auto & auxiliaryState = auxStates[0];
+
+  // see e.g. https://gkeyll.readthedocs.io/en/latest/dev/ssp-rk.html
+
+  const scalar_type stepSize_half{stepSize/two};
+  const IndVarType t_phalf{stepStartTime + stepSize_half};
+  const IndVarType t_next{stepStartTime + stepSize};
+
+  // rhs(u_n, t_n)
+  system.rhs(odeState, stepStartTime, rhs0);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs0);
+  // u_1 = u_n + stepSize * rhs(u_n, t_n)
+  ::pressio::ops::update(auxiliaryState, zero,
+			 odeState,       one,
+			 rhs0,           stepSize);
+
+  // rhs(u_1, t_n+stepSize)
+  system.rhs(auxiliaryState, t_next, rhs0);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_next, rhs0);
+  // u_2 = 3/4*u_n + 1/4*u_1 + 1/4*stepSize*rhs(u_1, t_n+stepSize)
+  ::pressio::ops::update(auxiliaryState, fourInv,
+			 odeState,       threeOvFour,
+			 rhs0,           fourInv*stepSize);
+
+  // rhs(u_2, t_n + 0.5*stepSize)
+  system.rhs(auxiliaryState, t_phalf, rhs0);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs0);
+  // u_n+1 = 1/3*u_n + 2/3*u_2 + 2/3*stepSize*rhs(u_2, t_n+0.5*stepSize)
+  ::pressio::ops::update(odeState,       oneOvThree,
+			 auxiliaryState, twoOvThree,
+			 rhs0,           twoOvThree*stepSize);
+}
+
+template<
+  class SystemType,
+  class StateType,
+  class AuxStatesContainerType,
+  class RhsContainerType,
+  class IndVarType,
+  class RhsObserverType
+  >
+void explicit_step_no_mass_matrix(ode::RungeKutta4,
+				  const SystemType & system,
+				  StateType & odeState,
+				  AuxStatesContainerType & auxStates,
+				  RhsContainerType & rhsInstances,
+				  const IndVarType & stepStartTime,
+				  const IndVarType & stepSize,
+				  ::pressio::ode::StepCount stepNumber,
+				  RhsObserverType & rhsObserver)
+{
+  PRESSIOLOG_DEBUG("rk4 stepper: do step");
+
+  auto & rhs1 = rhsInstances[0];
+  auto & rhs2 = rhsInstances[1];
+  auto & rhs3 = rhsInstances[2];
+  auto & rhs4 = rhsInstances[3];
+  auto & auxiliaryState = auxStates[0];
+
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+  constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+  constexpr auto two  = ::pressio::utils::Constants<scalar_type>::two();
+  constexpr auto three  = ::pressio::utils::Constants<scalar_type>::three();
+  constexpr auto six  = two * three;
+
+  const scalar_type stepSize_half{stepSize/two};
+  const IndVarType t_phalf{stepStartTime + stepSize_half};
+  const IndVarType t_next{stepStartTime + stepSize};
+  const scalar_type stepSize6{stepSize/six};
+  const scalar_type stepSize3{stepSize/three};
+
+  // stage 1:
+  // rhs1 = rhs(y_n, t_n)
+  system.rhs(odeState, stepStartTime, rhs1);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs1);
+
+  // stage 2:
+  // ytmp = y + rhs1*stepSize_half;
+  ::pressio::ops::update(auxiliaryState, zero, odeState, one, rhs1, stepSize_half);
+  // rhs2 = rhs(y_tmp, t_n+stepSize/2)
+  system.rhs(auxiliaryState, t_phalf, rhs2);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_phalf, rhs2);
+
+  // stage 3:
+  // ytmp = y + rhs2*stepSize_half;
+  ::pressio::ops::update(auxiliaryState, zero, odeState, one, rhs2, stepSize_half);
+  // rhs3 = rhs(y_tmp)
+  system.rhs(auxiliaryState, t_phalf, rhs3);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs3);
+
+  // stage 4:
+  // ytmp = y + rhs3*stepSize;
+  ::pressio::ops::update(auxiliaryState, zero, odeState, one, rhs3, stepSize);
+  // rhs4 = rhs(y_tmp)
+  system.rhs(auxiliaryState, t_next, rhs4);
+  rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(3), t_next, rhs4);
+
+  // y_n += stepSize/6 * ( rhs1 + 2*rhs2 + 2*rhs3 + rhs4 )
+  ::pressio::ops::update(odeState, one,
+			 rhs1, stepSize6, rhs2, stepSize3,
+			 rhs3, stepSize3, rhs4, stepSize6);
+}
+
+template<
+  class TableauType,
+  class SystemType,
+  class StateType,
+  class AuxStatesContainerType,
+  class RhsContainerType,
+  class IndVarType,
+  class RhsObserverType
+  >
+void explicit_step_no_mass_matrix(ode::ExplicitRungeKutta<TableauType>,
+				  const SystemType & system,
+				  StateType & odeState,
+				  AuxStatesContainerType & auxStates,
+				  RhsContainerType & rhsInstances,
+				  const IndVarType & stepStartTime,
+				  const IndVarType & stepSize,
+				  ::pressio::ode::StepCount stepNumber,
+				  RhsObserverType & rhsObserver)
+{
+  PRESSIOLOG_DEBUG("explicit runge-kutta tableau stepper: do step");
+
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+  constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+  using im_step_t = typename ::pressio::ode::IntermediateStepCount::value_type;
+  auto & stageState = auxStates[0];
+
+  // k_s = f(y_n + dt * sum_{j<s} a_sj k_j, t_n + c_s dt)
+  for (std::size_t s=0; s<TableauType::stages; ++s)
+  {
+    const IndVarType t_s{stepStartTime + static_cast<scalar_type>(TableauType::c(s))*stepSize};
+    auto & k_s = rhsInstances[s];
+    if (s == 0){
+      system.rhs(odeState, t_s, k_s);
+    }
+    else{
+      ::pressio::ops::update(stageState, zero, odeState, one, rhsInstances[0],
+			     static_cast<scalar_type>(TableauType::a(s, 0))*stepSize);
+      for (std::size_t j=1; j<s; ++j){
+	const auto a_sj = static_cast<scalar_type>(TableauType::a(s, j));
+	if (a_sj != zero){
+	  ::pressio::ops::update(stageState, one, rhsInstances[j], a_sj*stepSize);
+	}
+      }
+      system.rhs(stageState, t_s, k_s);
+    }
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(static_cast<im_step_t>(s)), t_s, k_s);
+  }
+
+  // y_n+1 = y_n + dt * sum_s b_s k_s
+  for (std::size_t s=0; s<TableauType::stages; ++s){
+    const auto b_s = static_cast<scalar_type>(TableauType::b(s));
+    if (b_s != zero){
+      ::pressio::ops::update(odeState, one, rhsInstances[s], b_s*stepSize);
+    }
+  }
+}
+
+template<
+  class TableauType,
+  class SystemType,
+  class StateType,
+  class AuxStatesContainerType,
+  class RhsContainerType,
+  class IndVarType,
+  class RhsObserverType
+  >
+void explicit_step_no_mass_matrix(ode::EmbeddedRungeKutta<TableauType>,
+				  const SystemType & system,
+				  StateType & odeState,
+				  AuxStatesContainerType & auxStates,
+				  RhsContainerType & rhsInstances,
+				  const IndVarType & stepStartTime,
+				  const IndVarType & stepSize,
+				  ::pressio::ode::StepCount stepNumber,
+				  RhsObserverType & rhsObserver)
+{
+  explicit_step_no_mass_matrix(ode::ExplicitRungeKutta<TableauType>(),
+			       system, odeState, auxStates, rhsInstances,
+			       stepStartTime, stepSize, stepNumber, rhsObserver);
+
+  // error = y_n+1 - yhat_n+1 = dt * sum_s (b_s - bhat_s) k_s
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+  constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+  auto & errorEstimate = auxStates[1];
+  ::pressio::ops::set_zero(errorEstimate);
+  for (std::size_t s=0; s<TableauType::stages; ++s){
+    const auto d_s = static_cast<scalar_type>(TableauType::b(s) - TableauType::bhat(s));
+    if (d_s != zero){
+      ::pressio::ops::update(errorEstimate, one, rhsInstances[s], d_s*stepSize);
+    }
+  }
+}
+
+template<
+  class TableauType,
+  class SystemType,
+  class StateType,
+  class AuxStatesContainerType,
+  class RhsContainerType,
+  class IndVarType,
+  class RhsObserverType
+  >
+void explicit_step_no_mass_matrix(ode::LowStorageRungeKutta<TableauType>,
+				  const SystemType & system,
+				  StateType & odeState,
+				  AuxStatesContainerType & /*auxStates*/,
+				  RhsContainerType & rhsInstances,
+				  const IndVarType & stepStartTime,
+				  const IndVarType & stepSize,
+				  ::pressio::ode::StepCount stepNumber,
+				  RhsObserverType & rhsObserver)
+{
+  PRESSIOLOG_DEBUG("low-storage runge-kutta stepper: do step");
+
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+  auto & dy  = rhsInstances[0];
+  auto & rhs = rhsInstances[1];
+  using im_step_t = typename ::pressio::ode::IntermediateStepCount::value_type;
+
+  for (std::size_t s=0; s<TableauType::stages; ++s)
+  {
+    const IndVarType t_s{stepStartTime + static_cast<scalar_type>(TableauType::C(s))*stepSize};
+    system.rhs(odeState, t_s, rhs);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(static_cast<im_step_t>(s)), t_s, rhs);
+
+    // dy = A_s * dy + dt * f, A_0 = 0 so dy does not need to be reset
+    ::pressio::ops::update(dy, static_cast<scalar_type>(TableauType::A(s)), rhs, stepSize);
+    // y = y + B_s * dy
+    ::pressio::ops::update(odeState, one, dy, static_cast<scalar_type>(TableauType::B(s)));
+  }
+}
+
+}}}//end namespace pressio::ode::impl
+#endif  // ODE_IMPL_ODE_EXPLICIT_STEPPER_KERNELS_HPP_
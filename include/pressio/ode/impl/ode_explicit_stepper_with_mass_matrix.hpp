@@ -53,6 +53,34 @@
 
 namespace pressio{ namespace ode{ namespace impl{
 
+// true if the system provides a state- and time-independent mass matrix
+// via massMatrix(M), in which case M is queried only once
+template<class SystemType, class MassMatrixType, class = void>
+struct system_has_constant_mass_matrix : std::false_type{};
+
+template<class SystemType, class MassMatrixType>
+struct system_has_constant_mass_matrix<
+  SystemType, MassMatrixType,
+  mpl::void_t<
+    decltype(std::declval<SystemType const &>().massMatrix(std::declval<MassMatrixType &>()))
+    >
+  > : std::true_type{};
+
+// true if the linear solver can be factorized once via resetLinearSystem(M)
+// and then applied to several right-hand sides via solve(b, x)
+template<class SolverType, class MassMatrixType, class StateType, class RhsType, class = void>
+struct linear_solver_supports_factorization_reuse : std::false_type{};
+
+template<class SolverType, class MassMatrixType, class StateType, class RhsType>
+struct linear_solver_supports_factorization_reuse<
+  SolverType, MassMatrixType, StateType, RhsType,
+  mpl::void_t<
+    decltype(std::declval<SolverType &>().resetLinearSystem(std::declval<MassMatrixType const &>())),
+    decltype(std::declval<SolverType &>().solve(std::declval<RhsType const &>(),
+						std::declval<StateType &>()))
+    >
+  > : std::true_type{};
+
 // this class is NOT meant for direct instantiation.
 // One needs to use the public create_* functions because
 // templates are handled and passed properly there.
@@ -66,6 +94,8 @@ template<
 class ExplicitStepperWithMassMatrixImpl
 {
   using mass_matrix_type = typename mpl::remove_cvref_t<SystemType>::mass_matrix_type;
+  static constexpr bool has_constant_mass_matrix =
+    system_has_constant_mass_matrix<mpl::remove_cvref_t<SystemType>, mass_matrix_type>::value;
 
 public:
   using independent_variable_type  = IndVarType;
@@ -82,6 +112,14 @@ private:
 
   mass_matrix_type massMatrix_;
 
+  // only used when the mass matrix is constant:
+  // whether massMatrix_ has been computed, and whether the solver
+  // passed for the current time integration has factorized it.
+  // The factorization is redone at the first step of each integration,
+  // so all steps of one integration must use the same solver object.
+  bool massMatrixComputed_ = false;
+  bool massMatrixFactorized_ = false;
+
 public:
   ExplicitStepperWithMassMatrixImpl() = delete;
   ExplicitStepperWithMassMatrixImpl(const ExplicitStepperWithMassMatrixImpl &) = default;
@@ -176,6 +214,12 @@ public:
 		  LinearSolverType & solver,
 		  RhsObserverType & rhsObserver)
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("ode::explicit_stepper");
+
+    // a new time integration starts: the solver might be another one
+    if (step.get() == ::pressio::ode::first_step_value){
+      massMatrixFactorized_ = false;
+    }
 
     if (name_ == ode::StepScheme::ForwardEuler){
       doStepImpl(ode::ForwardEuler(), odeState,
@@ -204,6 +248,71 @@ public:
 
 private:
 
+  void evaluateMassMatrixAndRhs(const StateType & state,
+				const independent_variable_type & evalValue,
+				RightHandSideType & rhs)
+  {
+    evaluateMassMatrixAndRhs(std::integral_constant<bool, has_constant_mass_matrix>(),
+			     state, evalValue, rhs);
+  }
+
+  void evaluateMassMatrixAndRhs(std::false_type /*constant*/,
+				const StateType & state,
+				const independent_variable_type & evalValue,
+				RightHandSideType & rhs)
+  {
+    systemObj_.get().massMatrixAndRhs(state, evalValue, massMatrix_, rhs);
+  }
+
+  void evaluateMassMatrixAndRhs(std::true_type /*constant*/,
+				const StateType & state,
+				const independent_variable_type & evalValue,
+				RightHandSideType & rhs)
+  {
+    if (!massMatrixComputed_){
+      systemObj_.get().massMatrix(massMatrix_);
+      massMatrixComputed_ = true;
+    }
+    systemObj_.get().rhs(state, evalValue, rhs);
+  }
+
+  template<class LinearSolver>
+  void solveWithMassMatrix(LinearSolver & solver,
+			   StateType & x,
+			   const RightHandSideType & rhs)
+  {
+    using reuse_t = std::integral_constant<
+      bool,
+      has_constant_mass_matrix
+      && linear_solver_supports_factorization_reuse<
+	LinearSolver, mass_matrix_type, StateType, RightHandSideType>::value
+      >;
+    solveWithMassMatrix(reuse_t(), solver, x, rhs);
+  }
+
+  template<class LinearSolver>
+  void solveWithMassMatrix(std::false_type /*reuse factorization*/,
+			   LinearSolver & solver,
+			   StateType & x,
+			   const RightHandSideType & rhs)
+  {
+    solver.solve(massMatrix_, x, rhs);
+  }
+
+  template<class LinearSolver>
+  void solveWithMassMatrix(std::true_type /*reuse factorization*/,
+			   LinearSolver & solver,
+			   StateType & x,
+			   const RightHandSideType & rhs)
+  {
+    // M does not change, so factorize it once per time integration
+    if (!massMatrixFactorized_){
+      solver.resetLinearSystem(massMatrix_);
+      massMatrixFactorized_ = true;
+    }
+    solver.solve(rhs, x);
+  }
+
   template<class LinearSolver, class RhsObserverType>
   void doStepImpl(ode::ForwardEuler,
 		  StateType & odeState,
@@ -223,9 +332,9 @@ private:
     auto & fn = rhsInstance_;
     auto & x  = xInstances_[0];
 
-    systemObj_.get().massMatrixAndRhs(odeState, stepStartVal, massMatrix_, fn);
+    this->evaluateMassMatrixAndRhs(odeState, stepStartVal, fn);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartVal, fn);
-    solver.solve(massMatrix_, x, fn);
+    this->solveWithMassMatrix(solver, x, fn);
 
     // need to do: y_n+1 = y_n + stepSize*x
     // odeState already contains y_n
@@ -257,9 +366,9 @@ private:
       // start up with Euler forward
 
       auto & x  = xInstances_[0];
-      systemObj_.get().massMatrixAndRhs(odeState, stepStartVal, massMatrix_, fn);
+      this->evaluateMassMatrixAndRhs(odeState, stepStartVal, fn);
       rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartVal, fn);
-      solver.solve(massMatrix_, x, fn);
+      this->solveWithMassMatrix(solver, x, fn);
 
       // now compute new state y_n+1 = y_n + dt * x
       ::pressio::ops::update(odeState, one, x, stepSize);
@@ -269,9 +378,9 @@ private:
       auto & xnm1 = xInstances_[1];
       ::pressio::ops::deep_copy(xnm1, xn);
 
-      systemObj_.get().massMatrixAndRhs(odeState, stepStartVal, massMatrix_, fn);
+      this->evaluateMassMatrixAndRhs(odeState, stepStartVal, fn);
       rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartVal, fn);
-      solver.solve(massMatrix_, xn, fn);
+      this->solveWithMassMatrix(solver, xn, fn);
 
       const auto cfn   = ::pressio::utils::Constants<scalar_type>::threeOvTwo()*stepSize;
       const auto cfnm1 = ::pressio::utils::Constants<scalar_type>::negOneHalf()*stepSize;
@@ -313,23 +422,23 @@ private:
     const independent_variable_type t_next{stepStartTime + stepSize};
 
     // rhs(u_n, t_n)
-    systemObj_.get().massMatrixAndRhs(odeState, stepStartTime, massMatrix_, rhs);
+    this->evaluateMassMatrixAndRhs(odeState, stepStartTime, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
-    solver.solve(massMatrix_, x, rhs);
+    this->solveWithMassMatrix(solver, x, rhs);
     // u_1 = u_n + stepSize * x
     ::pressio::ops::update(auxState, zero, odeState, one, x, stepSize);
 
     // rhs(u_1, t_n+stepSize)
-    systemObj_.get().massMatrixAndRhs(auxState, t_next, massMatrix_, rhs);
+    this->evaluateMassMatrixAndRhs(auxState, t_next, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_next, rhs);
-    solver.solve(massMatrix_, x, rhs);
+    this->solveWithMassMatrix(solver, x, rhs);
     // u_2 = 3/4*u_n + 1/4*u_1 + 1/4*stepSize*x
     ::pressio::ops::update(auxState, fourInv, odeState, threeOvFour, x, fourInv*stepSize);
 
     // rhs(u_2, t_n + 0.5*stepSize)
-    systemObj_.get().massMatrixAndRhs(auxState, t_phalf, massMatrix_, rhs);
+    this->evaluateMassMatrixAndRhs(auxState, t_phalf, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs);
-    solver.solve(massMatrix_, x, rhs);
+    this->solveWithMassMatrix(solver, x, rhs);
     // u_n+1 = 1/3*u_n + 2/3*u_2 + 2/3*stepSize*rhs(u_2, t_n+0.5*stepSize)
     ::pressio::ops::update(odeState, oneOvThree, auxState, twoOvThree, x, twoOvThree*stepSize);
   }
@@ -367,33 +476,33 @@ private:
 
     // stage 1:
     // rhs1 = rhs(y_n, t_n)
-    systemObj_.get().massMatrixAndRhs(odeState, stepStartTime, massMatrix_, rhs);
+    this->evaluateMassMatrixAndRhs(odeState, stepStartTime, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
-    solver.solve(massMatrix_, x1, rhs);
+    this->solveWithMassMatrix(solver, x1, rhs);
 
     // stage 2:
     // ytmp = y + rhs1*stepSize_half;
     this->rk4_stage_update_impl(auxState, odeState, x1, stepSize_half);
     // rhs2 = rhs(y_tmp, t_n+stepSize/2)
-    systemObj_.get().massMatrixAndRhs(auxState, t_phalf, massMatrix_, rhs);
+    this->evaluateMassMatrixAndRhs(auxState, t_phalf, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_phalf, rhs);
-    solver.solve(massMatrix_, x2, rhs);
+    this->solveWithMassMatrix(solver, x2, rhs);
 
     // stage 3:
     // ytmp = y + rhs2*stepSize_half;
     this->rk4_stage_update_impl(auxState, odeState, x2, stepSize_half);
     // rhs3 = rhs(y_tmp)
-    systemObj_.get().massMatrixAndRhs(auxState, t_phalf, massMatrix_, rhs);
+    this->evaluateMassMatrixAndRhs(auxState, t_phalf, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs);
-    solver.solve(massMatrix_, x3, rhs);
+    this->solveWithMassMatrix(solver, x3, rhs);
 
     // stage 4:
     // ytmp = y + rhs3*stepSize;
     this->rk4_stage_update_impl(auxState, odeState, x3, stepSize);
     // rhs3 = rhs(y_tmp)
-    systemObj_.get().massMatrixAndRhs(auxState, t_next, massMatrix_, rhs);
+    this->evaluateMassMatrixAndRhs(auxState, t_next, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(3), t_next, rhs);
-    solver.solve(massMatrix_, x4, rhs);
+    this->solveWithMassMatrix(solver, x4, rhs);
 
     ::pressio::ops::update(odeState, one,
 			   x1, stepSize6, x2, stepSize3,
@@ -49,7 +49,7 @@
 #ifndef ODE_IMPL_ODE_EXPLICIT_STEPPER_WITHOUT_MASS_MATRIX_HPP_
 #define ODE_IMPL_ODE_EXPLICIT_STEPPER_WITHOUT_MASS_MATRIX_HPP_
 
-#include <array>
+#include <vector>
 
 namespace pressio{ namespace ode{ namespace impl{
 
@@ -72,7 +72,7 @@ private:
   StepScheme name_;
   ::pressio::utils::InstanceOrReferenceWrapper<SystemType> systemObj_;
   std::vector<RightHandSideType> rhsInstances_;
-  StateType auxiliaryState_;
+  std::vector<StateType> auxiliaryStates_;
 
 public:
   ExplicitStepperNoMassMatrixImpl() = delete;
@@ -85,7 +85,7 @@ public:
     : name_(StepScheme::ForwardEuler),
       systemObj_(std::forward<SystemType>(systemObj)),
       rhsInstances_{systemObj.createRhs()},
-      auxiliaryState_{systemObj.createState()}
+      auxiliaryStates_{systemObj.createState()}
   {}
 
   ExplicitStepperNoMassMatrixImpl(ode::RungeKutta4,
@@ -96,7 +96,7 @@ public:
 		    systemObj.createRhs(),
 		    systemObj.createRhs(),
 		    systemObj.createRhs()},
-      auxiliaryState_{systemObj.createState()}
+      auxiliaryStates_{systemObj.createState()}
   {}
 
   ExplicitStepperNoMassMatrixImpl(ode::AdamsBashforth2,
@@ -105,7 +105,7 @@ public:
       systemObj_(std::forward<SystemType>(systemObj)),
       rhsInstances_{systemObj.createRhs(),
 		    systemObj.createRhs()},
-      auxiliaryState_{systemObj.createState()}
+      auxiliaryStates_{systemObj.createState()}
   {}
 
   ExplicitStepperNoMassMatrixImpl(ode::SSPRungeKutta3,
@@ -113,7 +113,7 @@ public:
     : name_(StepScheme::SSPRungeKutta3),
       systemObj_(std::forward<SystemType>(systemObj)),
       rhsInstances_{systemObj.createRhs()},
-      auxiliaryState_{systemObj.createState()}
+      auxiliaryStates_{systemObj.createState()}
   {}
 
 public:
@@ -138,219 +138,35 @@ public:
 		  ::pressio::ode::StepSize<independent_variable_type> stepSize,
 		  RhsObserverType & rhsObserver)
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("ode::explicit_stepper");
     if (name_ == ode::StepScheme::ForwardEuler){
-      doStepImpl(ode::ForwardEuler(), odeState,
-		 stepStartVal.get(), stepSize.get(),
-		 step, rhsObserver);
+      explicit_step_no_mass_matrix(ode::ForwardEuler(), systemObj_.get(),
+				   odeState, auxiliaryStates_, rhsInstances_,
+				   stepStartVal.get(), stepSize.get(),
+				   step, rhsObserver);
     }
 
     else if (name_ == ode::StepScheme::RungeKutta4){
-      doStepImpl(ode::RungeKutta4(), odeState,
-		 stepStartVal.get(), stepSize.get(),
-		 step, rhsObserver);
+      explicit_step_no_mass_matrix(ode::RungeKutta4(), systemObj_.get(),
+				   odeState, auxiliaryStates_, rhsInstances_,
+				   stepStartVal.get(), stepSize.get(),
+				   step, rhsObserver);
     }
 
     else if (name_ == ode::StepScheme::AdamsBashforth2){
-      doStepImpl(ode::AdamsBashforth2(), odeState,
-		 stepStartVal.get(), stepSize.get(),
-		 step, rhsObserver);
+      explicit_step_no_mass_matrix(ode::AdamsBashforth2(), systemObj_.get(),
+				   odeState, auxiliaryStates_, rhsInstances_,
+				   stepStartVal.get(), stepSize.get(),
+				   step, rhsObserver);
     }
 
     else if (name_ == ode::StepScheme::SSPRungeKutta3){
-      doStepImpl(ode::SSPRungeKutta3(), odeState,
-		 stepStartVal.get(), stepSize.get(),
-		 step, rhsObserver);
+      explicit_step_no_mass_matrix(ode::SSPRungeKutta3(), systemObj_.get(),
+				   odeState, auxiliaryStates_, rhsInstances_,
+				   stepStartVal.get(), stepSize.get(),
+				   step, rhsObserver);
     }
   }
-
-private:
-  template<class RhsObserverType>
-  void doStepImpl(ode::ForwardEuler,
-		  StateType & odeState,
-		  const independent_variable_type & stepStartTime,
-		  const independent_variable_type & stepSize,
-		  ::pressio::ode::StepCount stepNumber,
-		  RhsObserverType & rhsObserver)
-  {
-    PRESSIOLOG_DEBUG("euler forward stepper: do step");
-
-    //eval rhs
-    auto & rhs = rhsInstances_[0];
-    systemObj_.get().rhs(odeState, stepStartTime, rhs);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
-
-    // y = y + stepSize * rhs
-    using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
-    constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
-    ::pressio::ops::update(odeState, one, rhs, stepSize);
-  }
-
-  template<class RhsObserverType>
-  void doStepImpl(ode::AdamsBashforth2,
-		  StateType & odeState,
-		  const independent_variable_type & stepStartTime,
-		  const independent_variable_type & stepSize,
-		  ::pressio::ode::StepCount stepNumber,
-		  RhsObserverType & rhsObserver)
-  {
-    PRESSIOLOG_DEBUG("adams-bashforth2 stepper: do step");
-
-    // // y_n+1 = y_n + stepSize*[ (3/2)*f(y_n, t_n) - (1/2)*f(y_n-1, t_n-1) ]
-
-    using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
-    const auto cfn   = ::pressio::utils::Constants<scalar_type>::threeOvTwo()*stepSize;
-    const auto cfnm1 = ::pressio::utils::Constants<scalar_type>::negOneHalf()*stepSize;
-
-    if (stepNumber.get()==1){
-      // use Euler forward or we could use something else here maybe RK4
-      auto & rhs = rhsInstances_[0];
-      systemObj_.get().rhs(odeState, stepStartTime, rhs);
-      rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
-
-      using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
-      constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
-      ::pressio::ops::update(odeState, one, rhs, stepSize);
-    }
-    else{
-      auto & fn   = rhsInstances_[0];
-      auto & fnm1 = rhsInstances_[1];
-      // fn -> fnm1
-      ::pressio::ops::deep_copy(fnm1, fn);
-
-      systemObj_.get().rhs(odeState, stepStartTime, fn);
-      rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, fn);
-
-      using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
-      constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
-      ::pressio::ops::update(odeState, one, fn, cfn, fnm1, cfnm1);
-    }
-  }
-
-  template<class RhsObserverType>
-  void doStepImpl(ode::SSPRungeKutta3,
-		  StateType & odeState,
-		  const independent_variable_type & stepStartTime,
-		  const independent_variable_type & stepSize,
-		  ::pressio::ode::StepCount stepNumber,
-		  RhsObserverType & rhsObserver)
-  {
-    PRESSIOLOG_DEBUG("ssprk3 stepper: do step");
-
-    using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
-    constexpr auto zero  = ::pressio::utils::Constants<scalar_type>::zero();
-    constexpr auto one   = ::pressio::utils::Constants<scalar_type>::one();
-    constexpr auto two   = ::pressio::utils::Constants<scalar_type>::two();
-    constexpr auto three = ::pressio::utils::Constants<scalar_type>::three();
-    constexpr auto four  = ::pressio::utils::Constants<scalar_type>::four();
-    constexpr auto oneOvThree = one/three;
-    constexpr auto twoOvThree = two/three;
-    constexpr auto threeOvFour = three/four;
-    constexpr auto fourInv = one/four;
-
-    auto & rhs0 = rhsInstances_[0];
-
-    // see e.g. https://gkeyll.readthedocs.io/en/latest/dev/ssp-rk.html
-
-    const scalar_type stepSize_half{stepSize/two};
-    const independent_variable_type t_phalf{stepStartTime + stepSize_half};
-    const independent_variable_type t_next{stepStartTime + stepSize};
-
-    // rhs(u_n, t_n)
-    systemObj_.get().rhs(odeState, stepStartTime, rhs0);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs0);
-    // u_1 = u_n + stepSize * rhs(u_n, t_n)
-    ::pressio::ops::update(auxiliaryState_, zero,
-                           odeState,        one,
-                           rhs0,            stepSize);
-
-    // rhs(u_1, t_n+stepSize)
-    systemObj_.get().rhs(auxiliaryState_, t_next, rhs0);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_next, rhs0);
-    // u_2 = 3/4*u_n + 1/4*u_1 + 1/4*stepSize*rhs(u_1, t_n+stepSize)
-    ::pressio::ops::update(auxiliaryState_, fourInv,
-			   odeState,        threeOvFour,
-                           rhs0,            fourInv*stepSize);
-
-    // rhs(u_2, t_n + 0.5*stepSize)
-    systemObj_.get().rhs(auxiliaryState_, t_phalf, rhs0);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs0);
-    // u_n+1 = 1/3*u_n + 2/3*u_2 + 2/3*stepSize*rhs(u_2, t_n+0.5*stepSize)
-    ::pressio::ops::update(odeState,        oneOvThree,
-			   auxiliaryState_, twoOvThree,
-                           rhs0,            twoOvThree*stepSize);
-  }
-
-  template<class RhsObserverType>
-  void doStepImpl(ode::RungeKutta4,
-		  StateType & odeState,
-		  const independent_variable_type & stepStartTime,
-		  const independent_variable_type & stepSize,
-		  ::pressio::ode::StepCount stepNumber,
-		  RhsObserverType & rhsObserver)
-  {
-    PRESSIOLOG_DEBUG("rk4 stepper: do step");
-
-    auto & rhs1 = rhsInstances_[0];
-    auto & rhs2 = rhsInstances_[1];
-    auto & rhs3 = rhsInstances_[2];
-    auto & rhs4 = rhsInstances_[3];
-
-    using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
-    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
-    constexpr auto two  = ::pressio::utils::Constants<scalar_type>::two();
-    constexpr auto three  = ::pressio::utils::Constants<scalar_type>::three();
-    constexpr auto six  = two * three;
-
-    const scalar_type stepSize_half{stepSize/two};
-    const independent_variable_type t_phalf{stepStartTime + stepSize_half};
-    const independent_variable_type t_next{stepStartTime + stepSize};
-    const scalar_type stepSize6{stepSize/six};
-    const scalar_type stepSize3{stepSize/three};
-
-    // stage 1:
-    // rhs1 = rhs(y_n, t_n)
-    systemObj_.get().rhs(odeState, stepStartTime, rhs1);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs1);
-
-    // stage 2:
-    // ytmp = y + rhs1*stepSize_half;
-    this->rk4_stage_update_impl(auxiliaryState_, odeState, rhs1, stepSize_half);
-    // rhs2 = rhs(y_tmp, t_n+stepSize/2)
-    systemObj_.get().rhs(auxiliaryState_, t_phalf, rhs2);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_phalf, rhs2);
-
-    // stage 3:
-    // ytmp = y + rhs2*stepSize_half;
-    this->rk4_stage_update_impl(auxiliaryState_, odeState, rhs2, stepSize_half);
-    // rhs3 = rhs(y_tmp)
-    systemObj_.get().rhs(auxiliaryState_, t_phalf, rhs3);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs3);
-
-    // stage 4:
-    // ytmp = y + rhs3*stepSize;
-    this->rk4_stage_update_impl(auxiliaryState_, odeState, rhs3, stepSize);
-    // rhs3 = rhs(y_tmp)
-    systemObj_.get().rhs(auxiliaryState_, t_next, rhs4);
-    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(3), t_next, rhs4);
-
-    // y_n += stepSize/6 * ( rhs1 + 2*rhs2 + 2*rhs3 + rhs4 )
-    ::pressio::ops::update(odeState, one,
-			   rhs1, stepSize6, rhs2, stepSize3,
-			   rhs3, stepSize3, rhs4, stepSize6);
-  }
-
-  template<class rhs_t, class FactorType>
-  void rk4_stage_update_impl(StateType & yIn,
-			     const StateType & stateIn,
-			     const rhs_t & rhsIn,
-			     const FactorType & rhsFactor)
-  {
-    using scalar_type   = typename ::pressio::Traits<StateType>::scalar_type;
-    constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
-    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
-    ::pressio::ops::update(yIn, zero, stateIn, one, rhsIn, rhsFactor);
-  }
-
 };
 
 }}}//end namespace pressio::ode::explicitmethods::impl
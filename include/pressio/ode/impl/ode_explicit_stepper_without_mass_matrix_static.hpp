@@ -0,0 +1,153 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_explicit_stepper_without_mass_matrix_static.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_IMPL_ODE_EXPLICIT_STEPPER_WITHOUT_MASS_MATRIX_STATIC_HPP_
+#define ODE_IMPL_ODE_EXPLICIT_STEPPER_WITHOUT_MASS_MATRIX_STATIC_HPP_
+
+#include <array>
+#include <utility>
+
+namespace pressio{ namespace ode{ namespace impl{
+
+template<class T, class CreatorType, std::size_t ... Is>
+std::array<T, sizeof...(Is)>
+create_instances_array(CreatorType && creator,
+		       std::index_sequence<Is...>)
+{
+  return {{ ((void)Is, creator())... }};
+}
+
+// same as ExplicitStepperNoMassMatrixImpl but the scheme is a template
+// parameter: there is no runtime dispatch on the scheme and the rhs
+// and auxiliary states are stored in std::arrays sized for the given scheme.
+// This class is NOT meant for direct instantiation.
+// One needs to use the public create_* functions because
+// templates are handled and passed properly there.
+template<
+  class SchemeTag,
+  class StateType,
+  class IndVarType,
+  class SystemType,
+  class RightHandSideType
+  >
+class ExplicitStepperNoMassMatrixStaticImpl{
+
+public:
+  using independent_variable_type  = IndVarType;
+  using state_type  = StateType;
+  using scheme_tag  = SchemeTag;
+  static constexpr std::size_t num_rhs = explicit_scheme_num_rhs<SchemeTag>::value;
+  static constexpr std::size_t num_aux_states = explicit_scheme_num_aux_states<SchemeTag>::value;
+
+private:
+  ::pressio::utils::InstanceOrReferenceWrapper<SystemType> systemObj_;
+  std::array<RightHandSideType, num_rhs> rhsInstances_;
+  std::array<StateType, num_aux_states> auxiliaryStates_;
+
+public:
+  ExplicitStepperNoMassMatrixStaticImpl() = delete;
+  ExplicitStepperNoMassMatrixStaticImpl(const ExplicitStepperNoMassMatrixStaticImpl &) = default;
+  ExplicitStepperNoMassMatrixStaticImpl & operator=(const ExplicitStepperNoMassMatrixStaticImpl &) = delete;
+  ~ExplicitStepperNoMassMatrixStaticImpl() = default;
+
+  explicit ExplicitStepperNoMassMatrixStaticImpl(SystemType && systemObj)
+    : systemObj_(std::forward<SystemType>(systemObj)),
+      rhsInstances_(create_instances_array<RightHandSideType>
+		    ([this](){ return systemObj_.get().createRhs(); },
+		     std::make_index_sequence<num_rhs>{})),
+      auxiliaryStates_(create_instances_array<StateType>
+		       ([this](){ return systemObj_.get().createState(); },
+			std::make_index_sequence<num_aux_states>{}))
+  {}
+
+public:
+  void operator()(StateType & odeState,
+		  const ::pressio::ode::StepStartAt<independent_variable_type> & stepStartVal,
+		  ::pressio::ode::StepCount step,
+		  ::pressio::ode::StepSize<independent_variable_type> stepSize)
+  {
+    auto dummyRhsObserver = [](::pressio::ode::StepCount /*unused*/,
+			       ::pressio::ode::IntermediateStepCount /*unused*/,
+			       const independent_variable_type & /*unused*/,
+			       const RightHandSideType & /*unused*/)
+    { /*no op*/ };
+
+    (*this)(odeState, stepStartVal, step, stepSize, dummyRhsObserver);
+  }
+
+  template<class RhsObserverType>
+  void operator()(StateType & odeState,
+		  const ::pressio::ode::StepStartAt<independent_variable_type> & stepStartVal,
+		  ::pressio::ode::StepCount step,
+		  ::pressio::ode::StepSize<independent_variable_type> stepSize,
+		  RhsObserverType & rhsObserver)
+  {
+    PRESSIO_INSTRUMENTATION_SCOPE("ode::explicit_stepper");
+    explicit_step_no_mass_matrix(SchemeTag(), systemObj_.get(),
+				 odeState, auxiliaryStates_, rhsInstances_,
+				 stepStartVal.get(), stepSize.get(),
+				 step, rhsObserver);
+  }
+
+  // only for schemes computing a local error estimate (embedded pairs):
+  // the estimate for the most recent step, and the order of that estimate
+  template<class T = SchemeTag>
+  std::enable_if_t<explicit_scheme_has_error_estimate<T>::value, const StateType &>
+  localErrorEstimate() const{
+    return auxiliaryStates_[explicit_scheme_has_error_estimate<T>::aux_state_index];
+  }
+
+  template<class T = SchemeTag>
+  std::enable_if_t<explicit_scheme_has_error_estimate<T>::value, int>
+  errorEstimateOrder() const{
+    return explicit_scheme_has_error_estimate<T>::order;
+  }
+};
+
+}}}//end namespace pressio::ode::impl
+#endif  // ODE_IMPL_ODE_EXPLICIT_STEPPER_WITHOUT_MASS_MATRIX_STATIC_HPP_
@@ -66,15 +66,51 @@ auto create_implicit_stepper_impl(StepScheme name,
 		    std::forward<Args>(args)...);
   }
 
+  else if (name == StepScheme::BDF3){
+    return ImplType(::pressio::ode::BDF3(),
+		    std::forward<Args>(args)...);
+  }
+
+  else if (name == StepScheme::BDF4){
+    return ImplType(::pressio::ode::BDF4(),
+		    std::forward<Args>(args)...);
+  }
+
   else if (name == StepScheme::CrankNicolson){
     return ImplType(::pressio::ode::CrankNicolson(),
 		    std::forward<Args>(args)...);
   }
 
+  else if (name == StepScheme::SDIRK22){
+    return ImplType(::pressio::ode::SDIRK22(),
+		    std::forward<Args>(args)...);
+  }
+
+  else if (name == StepScheme::SDIRK33){
+    return ImplType(::pressio::ode::SDIRK33(),
+		    std::forward<Args>(args)...);
+  }
+
   else{
     throw std::runtime_error("ode:: create_implicit_stepper: invalid StepScheme enum value");
   }
 }
 
+// the standard stepper type with the scheme fixed at compile time
+template<class StepperType, class SchemeTag>
+struct ImplicitStepperWithFixedScheme;
+
+template<class IndVarType, class StateType, class ResidualType,
+	 class JacobianType, class PolicyType, class SchemeTag>
+struct ImplicitStepperWithFixedScheme<
+  ImplicitStepperStandardImpl<IndVarType, StateType, ResidualType,
+			      JacobianType, PolicyType, void>,
+  SchemeTag
+  >
+{
+  using type = ImplicitStepperStandardImpl<IndVarType, StateType, ResidualType,
+					   JacobianType, PolicyType, SchemeTag>;
+};
+
 }}}
 #endif  // ODE_IMPL_ODE_IMPLICIT_CREATE_IMPL_HPP_
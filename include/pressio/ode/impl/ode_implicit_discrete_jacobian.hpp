@@ -146,6 +146,100 @@ discrete_jacobian(::pressio::ode::BDF2,
   ::pressio::ops::update(jac, cf, M_np1, cnp1);
 }
 
+/*
+  BDF3: J(y_n+1) = I - (6/11)*dt*df_n+1/dy_n+1
+  - on input jac contains  df_n+1/dy_n+1
+  - on output, jac contains the discrete jacobian
+*/
+template <class JacobianType, class StepSizeType>
+std::enable_if_t<
+  std::is_convertible<
+    StepSizeType, typename Traits<JacobianType>::scalar_type
+    >::value
+  >
+discrete_jacobian(::pressio::ode::BDF3,
+		  JacobianType & jac,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<JacobianType>::scalar_type;
+  constexpr sc_t cnp1 = ::pressio::ode::constants::bdf3<sc_t>::c_np1_;
+  const sc_t cf   = ::pressio::ode::constants::bdf3<sc_t>::c_f_ * dt;
+  ::pressio::ops::scale(jac, cf);
+  ::pressio::ops::add_to_diagonal(jac, cnp1);
+}
+
+/*
+  BDF3 WITH MM: J(y_n+1) = M_n+1 - (6/11)*dt*df_n+1/dy_n+1
+  - on input jac contains  df_n+1/dy_n+1
+  - on output, jac contains the discrete jacobian
+*/
+template <class JacobianType, class MassMatrixType, class StepSizeType>
+std::enable_if_t<
+  ::pressio::all_have_traits_and_same_scalar<JacobianType, MassMatrixType>::value
+  && std::is_convertible<
+    StepSizeType, typename Traits<JacobianType>::scalar_type
+    >::value
+  >
+discrete_jacobian(::pressio::ode::BDF3,
+		  JacobianType & jac,
+		  const MassMatrixType & M_np1,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<JacobianType>::scalar_type;
+  constexpr sc_t cnp1 = ::pressio::ode::constants::bdf3<sc_t>::c_np1_;
+  const sc_t cf   = ::pressio::ode::constants::bdf3<sc_t>::c_f_ * dt;
+  ::pressio::ops::update(jac, cf, M_np1, cnp1);
+}
+
+/*
+  BDF4: J(y_n+1) = I - (12/25)*dt*df_n+1/dy_n+1
+  - on input jac contains  df_n+1/dy_n+1
+  - on output, jac contains the discrete jacobian
+*/
+template <class JacobianType, class StepSizeType>
+std::enable_if_t<
+  std::is_convertible<
+    StepSizeType, typename Traits<JacobianType>::scalar_type
+    >::value
+  >
+discrete_jacobian(::pressio::ode::BDF4,
+		  JacobianType & jac,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<JacobianType>::scalar_type;
+  constexpr sc_t cnp1 = ::pressio::ode::constants::bdf4<sc_t>::c_np1_;
+  const sc_t cf   = ::pressio::ode::constants::bdf4<sc_t>::c_f_ * dt;
+  ::pressio::ops::scale(jac, cf);
+  ::pressio::ops::add_to_diagonal(jac, cnp1);
+}
+
+/*
+  BDF4 WITH MM: J(y_n+1) = M_n+1 - (12/25)*dt*df_n+1/dy_n+1
+  - on input jac contains  df_n+1/dy_n+1
+  - on output, jac contains the discrete jacobian
+*/
+template <class JacobianType, class MassMatrixType, class StepSizeType>
+std::enable_if_t<
+  ::pressio::all_have_traits_and_same_scalar<JacobianType, MassMatrixType>::value
+  && std::is_convertible<
+    StepSizeType, typename Traits<JacobianType>::scalar_type
+    >::value
+  >
+discrete_jacobian(::pressio::ode::BDF4,
+		  JacobianType & jac,
+		  const MassMatrixType & M_np1,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<JacobianType>::scalar_type;
+  constexpr sc_t cnp1 = ::pressio::ode::constants::bdf4<sc_t>::c_np1_;
+  const sc_t cf   = ::pressio::ode::constants::bdf4<sc_t>::c_f_ * dt;
+  ::pressio::ops::update(jac, cf, M_np1, cnp1);
+}
+
 /*
   CRANK NICOLSON: J(y_n+1) = I - 0.5*dt*df_n+1/dy_n+1
   - on input jac contains  df_n+1/dy_n+1
@@ -218,6 +218,182 @@ discrete_residual(::pressio::ode::BDF2,
   ::pressio::ops::update(R, one, f_np1, cf);
 }
 
+/*
+  BDF3 residual:
+  R(y_n+1) = y_n+1 - (18/11)*y_n + (9/11)*y_n-1 - (2/11)*y_n-2 - (6/11)*dt*f(t_n+1, y_n+1)
+
+  on entry R contains the application RHS: R = f(t_n+1, y_n+1, ...)
+*/
+template <
+  class StateType,
+  class ResidualType,
+  class StencilStatesContainerType,
+  class StepSizeType
+  >
+std::enable_if_t<
+  ::pressio::all_have_traits_and_same_scalar<StateType, ResidualType>::value
+  && std::is_convertible<
+    StepSizeType, typename Traits<ResidualType>::scalar_type
+    >::value
+  >
+discrete_residual(::pressio::ode::BDF3,
+		  const StateType & y_np1,
+		  ResidualType & R,
+		  const StencilStatesContainerType & stencilStates,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<ResidualType>::scalar_type;
+  using cnst = ::pressio::ode::constants::bdf3<sc_t>;
+  const sc_t cf = cnst::c_f_ * dt;
+
+  const auto & y_n   = stencilStates(::pressio::ode::n());
+  const auto & y_nm1 = stencilStates(::pressio::ode::nMinusOne());
+  const auto & y_nm2 = stencilStates(::pressio::ode::nMinusTwo());
+
+  ::pressio::ops::update(R, cf, y_np1, cnst::c_np1_,
+			 y_n, cnst::c_n_, y_nm1, cnst::c_nm1_, y_nm2, cnst::c_nm2_);
+}
+
+/*
+  BDF3 with MM:
+  R(y_n+1) = M_n+1(y_n+1 - (18/11)*y_n + (9/11)*y_n-1 - (2/11)*y_n-2) - (6/11)*dt*f(t_n+1, y_n+1)
+
+  on entry R is empty
+  on entry f_np1 contains f(t_n+1, y_n+1, ...)
+  on output, R contains the discrete residual
+*/
+template <
+  class StateType,
+  class MassMatrixType,
+  class ResidualType,
+  class StencilStatesContainerType,
+  class StepSizeType
+  >
+std::enable_if_t<
+  ::pressio::all_have_traits_and_same_scalar<StateType, ResidualType, MassMatrixType>::value
+  && std::is_convertible<
+    StepSizeType, typename Traits<ResidualType>::scalar_type
+    >::value
+  >
+discrete_residual(::pressio::ode::BDF3,
+		  const StateType & y_np1,
+		  StateType & scratchState,
+		  const ResidualType & f_np1,
+		  const MassMatrixType & M_np1,
+		  ResidualType & R,
+		  const StencilStatesContainerType & stencilStates,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<ResidualType>::scalar_type;
+  using cnst = ::pressio::ode::constants::bdf3<sc_t>;
+  constexpr sc_t zero = ::pressio::utils::Constants<sc_t>::zero();
+  constexpr sc_t one  = ::pressio::utils::Constants<sc_t>::one();
+  const sc_t cf = cnst::c_f_ * dt;
+
+  const auto & y_n   = stencilStates(::pressio::ode::n());
+  const auto & y_nm1 = stencilStates(::pressio::ode::nMinusOne());
+  const auto & y_nm2 = stencilStates(::pressio::ode::nMinusTwo());
+
+  ::pressio::ops::update(scratchState, zero, y_np1, cnst::c_np1_,
+			 y_n, cnst::c_n_, y_nm1, cnst::c_nm1_, y_nm2, cnst::c_nm2_);
+  ::pressio::ops::product(::pressio::nontranspose(), one, M_np1, scratchState, zero, R);
+  ::pressio::ops::update(R, one, f_np1, cf);
+}
+
+/*
+  BDF4 residual:
+  R(y_n+1) = y_n+1 - (48/25)*y_n + (36/25)*y_n-1 - (16/25)*y_n-2 + (3/25)*y_n-3
+             - (12/25)*dt*f(t_n+1, y_n+1)
+
+  on entry R contains the application RHS: R = f(t_n+1, y_n+1, ...)
+*/
+template <
+  class StateType,
+  class ResidualType,
+  class StencilStatesContainerType,
+  class StepSizeType
+  >
+std::enable_if_t<
+  ::pressio::all_have_traits_and_same_scalar<StateType, ResidualType>::value
+  && std::is_convertible<
+    StepSizeType, typename Traits<ResidualType>::scalar_type
+    >::value
+  >
+discrete_residual(::pressio::ode::BDF4,
+		  const StateType & y_np1,
+		  ResidualType & R,
+		  const StencilStatesContainerType & stencilStates,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<ResidualType>::scalar_type;
+  using cnst = ::pressio::ode::constants::bdf4<sc_t>;
+  constexpr sc_t one = ::pressio::utils::Constants<sc_t>::one();
+  const sc_t cf = cnst::c_f_ * dt;
+
+  const auto & y_n   = stencilStates(::pressio::ode::n());
+  const auto & y_nm1 = stencilStates(::pressio::ode::nMinusOne());
+  const auto & y_nm2 = stencilStates(::pressio::ode::nMinusTwo());
+  const auto & y_nm3 = stencilStates(::pressio::ode::nMinusThree());
+
+  // update supports at most four operands, so do this in two passes
+  ::pressio::ops::update(R, cf, y_np1, cnst::c_np1_,
+			 y_n, cnst::c_n_, y_nm1, cnst::c_nm1_, y_nm2, cnst::c_nm2_);
+  ::pressio::ops::update(R, one, y_nm3, cnst::c_nm3_);
+}
+
+/*
+  BDF4 with MM:
+  R(y_n+1) = M_n+1(y_n+1 - (48/25)*y_n + (36/25)*y_n-1 - (16/25)*y_n-2 + (3/25)*y_n-3)
+             - (12/25)*dt*f(t_n+1, y_n+1)
+
+  on entry R is empty
+  on entry f_np1 contains f(t_n+1, y_n+1, ...)
+  on output, R contains the discrete residual
+*/
+template <
+  class StateType,
+  class MassMatrixType,
+  class ResidualType,
+  class StencilStatesContainerType,
+  class StepSizeType
+  >
+std::enable_if_t<
+  ::pressio::all_have_traits_and_same_scalar<StateType, ResidualType, MassMatrixType>::value
+  && std::is_convertible<
+    StepSizeType, typename Traits<ResidualType>::scalar_type
+    >::value
+  >
+discrete_residual(::pressio::ode::BDF4,
+		  const StateType & y_np1,
+		  StateType & scratchState,
+		  const ResidualType & f_np1,
+		  const MassMatrixType & M_np1,
+		  ResidualType & R,
+		  const StencilStatesContainerType & stencilStates,
+		  const StepSizeType & dt)
+{
+
+  using sc_t = typename ::pressio::Traits<ResidualType>::scalar_type;
+  using cnst = ::pressio::ode::constants::bdf4<sc_t>;
+  constexpr sc_t zero = ::pressio::utils::Constants<sc_t>::zero();
+  constexpr sc_t one  = ::pressio::utils::Constants<sc_t>::one();
+  const sc_t cf = cnst::c_f_ * dt;
+
+  const auto & y_n   = stencilStates(::pressio::ode::n());
+  const auto & y_nm1 = stencilStates(::pressio::ode::nMinusOne());
+  const auto & y_nm2 = stencilStates(::pressio::ode::nMinusTwo());
+  const auto & y_nm3 = stencilStates(::pressio::ode::nMinusThree());
+
+  ::pressio::ops::update(scratchState, zero, y_np1, cnst::c_np1_,
+			 y_n, cnst::c_n_, y_nm1, cnst::c_nm1_, y_nm2, cnst::c_nm2_);
+  ::pressio::ops::update(scratchState, one, y_nm3, cnst::c_nm3_);
+  ::pressio::ops::product(::pressio::nontranspose(), one, M_np1, scratchState, zero, R);
+  ::pressio::ops::update(R, one, f_np1, cf);
+}
+
 /*
   CrankNicolson residual:
   R(y_n+1) = y_n+1 - y_n - 0.5*dt*[ f(t_n+1, y_n+1) + f(t_n, y_n) ]
@@ -135,16 +135,34 @@ public:
 	 dt.get(), step.get(), R, Jo);
     }
 
+    else if (name == StepScheme::BDF3){
+      (*this).template compute_impl_bdf3
+	(predictedState, stencilStatesManager,
+	 stencilVelocities, rhsEvaluationTime.get(),
+	 dt.get(), step.get(), R, Jo);
+    }
+
+    else if (name == StepScheme::BDF4){
+      (*this).template compute_impl_bdf4
+	(predictedState, stencilStatesManager,
+	 stencilVelocities, rhsEvaluationTime.get(),
+	 dt.get(), step.get(), R, Jo);
+    }
+
     else if (name == StepScheme::CrankNicolson){
       throw std::runtime_error("CrankNicolson with mass matrix not yet implemented");
     }
   }
 
 private:
+  //
+  // BDF1
+  //
   template <
   class StencilStatesContainerType,
   class StencilVelocitiesContainerType,
-  class StepType>
+  class StepType
+  >
   void compute_impl_bdf1(const StateType & predictedState,
 			 const StencilStatesContainerType & stencilStatesManager,
 			 StencilVelocitiesContainerType & /*unused*/,
@@ -153,38 +171,59 @@ private:
 			 const StepType & step,
 			 ResidualType & R,
 #ifdef PRESSIO_ENABLE_CXX17
-			 std::optional<jacobian_type*> & Jo) const
+		         std::optional<jacobian_type*> Jo) const
 #else
                          jacobian_type* Jo) const
 #endif
   {
+    stepTracker_ = step;
+    compute_impl_bdf_fixed_order(BDF1(), predictedState, stencilStatesManager,
+				 evalTime, dt, R, Jo);
+  }
 
-    try{
-      stepTracker_ = step;
-      systemObj_.get().massMatrixAndRhsAndJacobian(predictedState, evalTime,
-						   massMatrix_, rhs_, Jo);
-      discrete_residual(BDF1(), predictedState, scratchState_, rhs_,
-			massMatrix_, R, stencilStatesManager, dt);
-
-      if (Jo){
+  //
+  // BDF2: first step uses BDF1
+  //
+  template <
+  class StencilStatesContainerType,
+  class StencilVelocitiesContainerType,
+  class StepType
+  >
+  void compute_impl_bdf2(const StateType & predictedState,
+			 const StencilStatesContainerType & stencilStatesManager,
+			 StencilVelocitiesContainerType & /*unused*/,
+			 const IndVarType & evalTime,
+			 const IndVarType & dt,
+			 const StepType & step,
+			 ResidualType & R,
 #ifdef PRESSIO_ENABLE_CXX17
-	auto & Jv = *(Jo.value());
+		         std::optional<jacobian_type*> Jo) const
 #else
-	auto & Jv = *Jo;
+                         jacobian_type* Jo) const
 #endif
-	discrete_jacobian(BDF1(), Jv, massMatrix_, dt);
-      }
+  {
+    stepTracker_ = step;
+    if (step == ::pressio::ode::first_step_value){
+      compute_impl_bdf_fixed_order(BDF1(), predictedState, stencilStatesManager,
+				   evalTime, dt, R, Jo);
     }
-    catch (::pressio::eh::VelocityFailureUnrecoverable const & e){
-      throw ::pressio::eh::ResidualEvaluationFailureUnrecoverable();
+    else{
+      compute_impl_bdf_fixed_order(BDF2(), predictedState, stencilStatesManager,
+				   evalTime, dt, R, Jo);
     }
   }
 
+  //
+  // BDF3: the stepper computes the first two steps itself
+  // (see ImplicitStepperStandardImpl::doStartupStepImpl)
+  // and only asks for the bdf1 residual while doing so
+  //
   template <
   class StencilStatesContainerType,
   class StencilVelocitiesContainerType,
-  class StepType>
-  void compute_impl_bdf2(const StateType & predictedState,
+  class StepType
+  >
+  void compute_impl_bdf3(const StateType & predictedState,
 			 const StencilStatesContainerType & stencilStatesManager,
 			 StencilVelocitiesContainerType & /*unused*/,
 			 const IndVarType & evalTime,
@@ -197,37 +236,64 @@ private:
                          jacobian_type* Jo) const
 #endif
   {
+    stepTracker_ = step;
+    compute_impl_bdf_fixed_order(BDF3(), predictedState, stencilStatesManager,
+				 evalTime, dt, R, Jo);
+  }
 
+  //
+  // BDF4: same as BDF3, the stepper handles the first three steps
+  //
+  template <
+  class StencilStatesContainerType,
+  class StencilVelocitiesContainerType,
+  class StepType
+  >
+  void compute_impl_bdf4(const StateType & predictedState,
+			 const StencilStatesContainerType & stencilStatesManager,
+			 StencilVelocitiesContainerType & /*unused*/,
+			 const IndVarType & evalTime,
+			 const IndVarType & dt,
+			 const StepType & step,
+			 ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		         std::optional<jacobian_type*> Jo) const
+#else
+                         jacobian_type* Jo) const
+#endif
+  {
     stepTracker_ = step;
-    auto cond = [=](){ return (step == ::pressio::ode::first_step_value); };
+    compute_impl_bdf_fixed_order(BDF4(), predictedState, stencilStatesManager,
+				 evalTime, dt, R, Jo);
+  }
+
+  template <class BdfTag, class StencilStatesContainerType>
+  void compute_impl_bdf_fixed_order(BdfTag tag,
+				    const StateType & predictedState,
+				    const StencilStatesContainerType & stencilStatesManager,
+				    const IndVarType & evalTime,
+				    const IndVarType & dt,
+				    ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+				    std::optional<jacobian_type*> Jo) const
+#else
+                                    jacobian_type* Jo) const
+#endif
+  {
 
     try{
       systemObj_.get().massMatrixAndRhsAndJacobian(predictedState, evalTime,
 						   massMatrix_, rhs_, Jo);
-      if (cond()){
-	discrete_residual(BDF1(), predictedState, scratchState_, rhs_,
-			  massMatrix_, R, stencilStatesManager, dt);
+      discrete_residual(tag, predictedState, scratchState_, rhs_,
+			massMatrix_, R, stencilStatesManager, dt);
 
-	if (Jo){
-#ifdef PRESSIO_ENABLE_CXX17
-	  auto & Jv = *(Jo.value());
-#else
-	  auto & Jv = *Jo;
-#endif
-	  discrete_jacobian(BDF1(), Jv, massMatrix_, dt);
-	}
-      }
-      else{
-	discrete_residual(BDF2(), predictedState, scratchState_, rhs_,
-			  massMatrix_, R, stencilStatesManager, dt);
-	if (Jo){
+      if (Jo){
 #ifdef PRESSIO_ENABLE_CXX17
-	  auto & Jv = *(Jo.value());
+	auto & Jv = *(Jo.value());
 #else
-	  auto & Jv = *Jo;
+	auto & Jv = *Jo;
 #endif
-	  discrete_jacobian(BDF2(), Jv, massMatrix_, dt);
-	}
+	discrete_jacobian(tag, Jv, massMatrix_, dt);
       }
     }
     catch (::pressio::eh::VelocityFailureUnrecoverable const & e){
@@ -129,6 +129,14 @@ private:
       (*this).template compute_impl_bdf2(std::forward<Args>(args)...);
     }
 
+    else if (name == StepScheme::BDF3){
+      (*this).template compute_impl_bdf3(std::forward<Args>(args)...);
+    }
+
+    else if (name == StepScheme::BDF4){
+      (*this).template compute_impl_bdf4(std::forward<Args>(args)...);
+    }
+
     else if (name == StepScheme::CrankNicolson){
       this->compute_impl_cn(std::forward<Args>(args)...);
     }
@@ -159,37 +167,54 @@ private:
                          jacobian_type* Jo) const
 #endif
   {
+    stepTracker_ = step;
+    compute_impl_bdf_fixed_order(BDF1(), predictedState, stencilStatesManager,
+				 rhsEvaluationTime, dt, R, Jo);
+  }
 
-    try{
-      stepTracker_ = step;
-
-      systemObj_.get().rhsAndJacobian(predictedState, rhsEvaluationTime, R, Jo);
-      ::pressio::ode::impl::discrete_residual(BDF1(), predictedState,
-					      R, stencilStatesManager, dt);
-
-      if (Jo){
+  //
+  // BDF2: first step uses BDF1
+  //
+  template <
+  class StencilStatesContainerType,
+  class StencilVelocitiesContainerType,
+  class StepType
+  >
+  void compute_impl_bdf2(const StateType & predictedState,
+			 const StencilStatesContainerType & stencilStatesManager,
+			 StencilVelocitiesContainerType & /*unused*/,
+			 const IndVarType & rhsEvaluationTime,
+			 const IndVarType & dt,
+			 const StepType & step,
+			 ResidualType & R,
 #ifdef PRESSIO_ENABLE_CXX17
-	auto & Jv = *(Jo.value());
+		         std::optional<jacobian_type*> Jo) const
 #else
-	auto & Jv = *Jo;
+                         jacobian_type* Jo) const
 #endif
-       	::pressio::ode::impl::discrete_jacobian(BDF1(), Jv, dt);
-      }
+  {
+    stepTracker_ = step;
+    if (step == ::pressio::ode::first_step_value){
+      compute_impl_bdf_fixed_order(BDF1(), predictedState, stencilStatesManager,
+				   rhsEvaluationTime, dt, R, Jo);
     }
-    catch (::pressio::eh::VelocityFailureUnrecoverable const & e){
-      throw ::pressio::eh::ResidualEvaluationFailureUnrecoverable();
+    else{
+      compute_impl_bdf_fixed_order(BDF2(), predictedState, stencilStatesManager,
+				   rhsEvaluationTime, dt, R, Jo);
     }
   }
 
   //
-  // BDF2
+  // BDF3: the stepper computes the first two steps itself
+  // (see ImplicitStepperStandardImpl::doStartupStepImpl)
+  // and only asks for the bdf1 residual while doing so
   //
   template <
   class StencilStatesContainerType,
   class StencilVelocitiesContainerType,
   class StepType
   >
-  void compute_impl_bdf2(const StateType & predictedState,
+  void compute_impl_bdf3(const StateType & predictedState,
 			 const StencilStatesContainerType & stencilStatesManager,
 			 StencilVelocitiesContainerType & /*unused*/,
 			 const IndVarType & rhsEvaluationTime,
@@ -202,49 +227,67 @@ private:
                          jacobian_type* Jo) const
 #endif
   {
-
     stepTracker_ = step;
+    compute_impl_bdf_fixed_order(BDF3(), predictedState, stencilStatesManager,
+				 rhsEvaluationTime, dt, R, Jo);
+  }
 
-    if (step == ::pressio::ode::first_step_value){
-
-      try{
-	systemObj_.get().rhsAndJacobian(predictedState, rhsEvaluationTime, R, Jo);
-	::pressio::ode::impl::discrete_residual(BDF1(), predictedState,
-						R, stencilStatesManager, dt);
+  //
+  // BDF4: same as BDF3, the stepper handles the first three steps
+  //
+  template <
+  class StencilStatesContainerType,
+  class StencilVelocitiesContainerType,
+  class StepType
+  >
+  void compute_impl_bdf4(const StateType & predictedState,
+			 const StencilStatesContainerType & stencilStatesManager,
+			 StencilVelocitiesContainerType & /*unused*/,
+			 const IndVarType & rhsEvaluationTime,
+			 const IndVarType & dt,
+			 const StepType & step,
+			 ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		         std::optional<jacobian_type*> Jo) const
+#else
+                         jacobian_type* Jo) const
+#endif
+  {
+    stepTracker_ = step;
+    compute_impl_bdf_fixed_order(BDF4(), predictedState, stencilStatesManager,
+				 rhsEvaluationTime, dt, R, Jo);
+  }
 
-	if (Jo){
+  template <class BdfTag, class StencilStatesContainerType>
+  void compute_impl_bdf_fixed_order(BdfTag tag,
+				    const StateType & predictedState,
+				    const StencilStatesContainerType & stencilStatesManager,
+				    const IndVarType & rhsEvaluationTime,
+				    const IndVarType & dt,
+				    ResidualType & R,
 #ifdef PRESSIO_ENABLE_CXX17
-	  auto & Jv = *(Jo.value());
+				    std::optional<jacobian_type*> Jo) const
 #else
-	  auto & Jv = *Jo;
+                                    jacobian_type* Jo) const
 #endif
-	  ::pressio::ode::impl::discrete_jacobian(BDF1(), Jv, dt);
-	}
-      }
-      catch (::pressio::eh::VelocityFailureUnrecoverable const & e){
-	throw ::pressio::eh::ResidualEvaluationFailureUnrecoverable();
-      }
-    }
-    else{
+  {
 
-      try{
-	systemObj_.get().rhsAndJacobian(predictedState, rhsEvaluationTime, R, Jo);
-	::pressio::ode::impl::discrete_residual(BDF2(), predictedState,
-						R, stencilStatesManager, dt);
+    try{
+      systemObj_.get().rhsAndJacobian(predictedState, rhsEvaluationTime, R, Jo);
+      ::pressio::ode::impl::discrete_residual(tag, predictedState,
+					      R, stencilStatesManager, dt);
 
-	if (Jo){
+      if (Jo){
 #ifdef PRESSIO_ENABLE_CXX17
-	  auto & Jv = *(Jo.value());
+	auto & Jv = *(Jo.value());
 #else
-	  auto & Jv = *Jo;
+	auto & Jv = *Jo;
 #endif
-	  ::pressio::ode::impl::discrete_jacobian(BDF2(), Jv, dt);
-	}
-      }
-      catch (::pressio::eh::VelocityFailureUnrecoverable const & e){
-	throw ::pressio::eh::ResidualEvaluationFailureUnrecoverable();
+	::pressio::ode::impl::discrete_jacobian(tag, Jv, dt);
       }
-
+    }
+    catch (::pressio::eh::VelocityFailureUnrecoverable const & e){
+      throw ::pressio::eh::ResidualEvaluationFailureUnrecoverable();
     }
   }
 
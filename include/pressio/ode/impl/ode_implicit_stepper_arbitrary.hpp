@@ -116,6 +116,7 @@ public:
 		  SolverType & solver,
 		  Args && ...args)
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("ode::implicit_stepper");
     PRESSIOLOG_DEBUG("arbitrary stepper: do step");
     dt_ = stepSize.get();
     rhsEvaluationTime_ = stepStartVal.get() + dt_;
@@ -205,73 +206,28 @@ public:
   }
 
 private:
-  // one aux states
+  /* rotating the stencil makes y_n become y_n-1, etc, without copying data,
+     and recycles the storage of the oldest state as the new y_n.
+     The oldest state is saved into recoveryState_ before being overwritten
+     so that we can roll back if the step fails. */
   template<std::size_t nAux>
-  std::enable_if_t<nAux==1>
+  std::enable_if_t<(nAux>=1)>
   updateAuxiliaryStorage(const StateType & odeState)
   {
+    stencilStates_.rotateForward();
     auto & y_n = stencilStates_(ode::n());
     ::pressio::ops::deep_copy(recoveryState_, y_n);
     ::pressio::ops::deep_copy(y_n, odeState);
   }
 
   template<std::size_t nAux>
-  std::enable_if_t<nAux==1>
+  std::enable_if_t<(nAux>=1)>
   rollBackStates(StateType & odeState)
   {
     auto & y_n = stencilStates_(ode::n());
     ::pressio::ops::deep_copy(odeState, y_n);
     ::pressio::ops::deep_copy(y_n, recoveryState_);
-  }
-
-  // two aux states
-  template<std::size_t nAux>
-  std::enable_if_t<nAux==2>
-  updateAuxiliaryStorage(const StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    ::pressio::ops::deep_copy(recoveryState_, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, y_n);
-    ::pressio::ops::deep_copy(y_n, odeState);
-  }
-
-  template<std::size_t nAux>
-  std::enable_if_t<nAux==2>
-  rollBackStates(StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    ::pressio::ops::deep_copy(odeState, y_n);
-    ::pressio::ops::deep_copy(y_n, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, recoveryState_);
-  }
-
-  // three aux states
-  template<std::size_t nAux>
-  std::enable_if_t<nAux==3>
-  updateAuxiliaryStorage(const StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    auto & y_nm2 = stencilStates_(ode::nMinusTwo());
-    ::pressio::ops::deep_copy(recoveryState_, y_nm2);
-    ::pressio::ops::deep_copy(y_nm2, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, y_n);
-    ::pressio::ops::deep_copy(y_n, odeState);
-  }
-
-  template<std::size_t nAux>
-  std::enable_if_t<nAux==3>
-  rollBackStates(StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    auto & y_nm2 = stencilStates_(ode::nMinusTwo());
-    ::pressio::ops::deep_copy(odeState, y_n);
-    ::pressio::ops::deep_copy(y_n, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, y_nm2);
-    ::pressio::ops::deep_copy(y_nm2, recoveryState_);
+    stencilStates_.rotateBackward();
   }
 };
 
@@ -51,12 +51,19 @@
 
 namespace pressio{ namespace ode{ namespace impl{
 
+/*
+  SchemeTag is void when the scheme is chosen at runtime via the
+  StepScheme enum. With SchemeTag = BDF1 the scheme is fixed at compile
+  time and the stepper also exposes the local error estimate needed
+  for adaptive stepping, see create_bdf1_stepper.
+*/
 template<
   class IndVarType,
   class StateType,
   class ResidualType,
   class JacobianType,
-  class ResidualJacobianPolicyType
+  class ResidualJacobianPolicyType,
+  class SchemeTag = void
   >
 class ImplicitStepperStandardImpl
 {
@@ -67,6 +74,7 @@ public:
   using state_type  = StateType;
   using residual_type = ResidualType;
   using jacobian_type = JacobianType;
+  using policy_type = ResidualJacobianPolicyType;
 
 private:
   ::pressio::ode::StepScheme name_;
@@ -81,16 +89,39 @@ private:
   // stencilStates contains:
   // for bdf1: y_n
   // for bdf2: y_n, y_n-1
+  // for bdf3: y_n, y_n-1, y_n-2
+  // for bdf4: y_n, y_n-1, y_n-2, y_n-3
   // for cn  : y_n
+  // for sdirk: the start of the current stage (see doSdirkStepImpl)
   ImplicitStencilStatesDynamicContainer<StateType> stencil_states_;
 
   ::pressio::utils::InstanceOrReferenceWrapper<ResidualJacobianPolicyType> rj_policy_;
 
   // stencilRightHandSide contains:
-  // for bdf1,2: nothing
+  // for bdf1,2,3,4, sdirk: nothing
   // for cn:  f(y_n,t_n) and f(y_np1, t_np1)
   mutable ImplicitStencilRightHandSideDynamicContainer<ResidualType> stencil_rhs_;
 
+  // bdf3, bdf4 only: the first k-1 steps are computed by extrapolating
+  // implicit euler sub-steps (see doStartupStepImpl), which needs
+  // the intermediate levels of the extrapolation and, while sub-stepping,
+  // the policy is called for bdf1 with a negative count for each sub-step
+  // (the sdirk stages are counted in the same way)
+  std::vector<state_type> startup_levels_;
+  bool in_startup_ = false;
+  int32_t startup_substep_count_ = -1;
+
+  // sdirk only: Y_j - Z_j for the previous stages j of the current step
+  std::vector<state_type> sdirk_increments_;
+
+  // bdf1 only, once enableLocalErrorEstimate is called:
+  // [0] = local error estimate of the last step,
+  // [1] = y_n-1, i.e. the state at the start of the previous step
+  std::vector<state_type> error_estimate_states_;
+  IndVarType previous_dt_ = {};
+  IndVarType last_dt_ = {};
+  int32_t last_estimated_step_ = {};
+
 public:
   ImplicitStepperStandardImpl() = delete;
   ImplicitStepperStandardImpl(const ImplicitStepperStandardImpl & other)  = default;
@@ -116,6 +147,34 @@ public:
       rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj))
   {}
 
+  // *** BDF3 ***//
+  ImplicitStepperStandardImpl(::pressio::ode::BDF3,
+			      ResidualJacobianPolicyType && rjPolicyObj)
+    : name_(StepScheme::BDF3),
+      recovery_state_{rjPolicyObj.createState()},
+      stencil_states_{rjPolicyObj.createState(),
+		      rjPolicyObj.createState(),
+		      rjPolicyObj.createState()},
+      rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj))
+  {
+    startup_levels_.push_back(rj_policy_.get().createState());
+  }
+
+  // *** BDF4 ***//
+  ImplicitStepperStandardImpl(::pressio::ode::BDF4,
+			      ResidualJacobianPolicyType && rjPolicyObj)
+    : name_(StepScheme::BDF4),
+      recovery_state_{rjPolicyObj.createState()},
+      stencil_states_{rjPolicyObj.createState(),
+		      rjPolicyObj.createState(),
+		      rjPolicyObj.createState(),
+		      rjPolicyObj.createState()},
+      rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj))
+  {
+    startup_levels_.push_back(rj_policy_.get().createState());
+    startup_levels_.push_back(rj_policy_.get().createState());
+  }
+
   // *** CN ***//
   ImplicitStepperStandardImpl(::pressio::ode::CrankNicolson,
 			      ResidualJacobianPolicyType && rjPolicyObj)
@@ -127,6 +186,29 @@ public:
                    rj_policy_.get().createResidual()}
   {}
 
+  // *** SDIRK22 ***//
+  ImplicitStepperStandardImpl(::pressio::ode::SDIRK22,
+			      ResidualJacobianPolicyType && rjPolicyObj)
+    : name_(StepScheme::SDIRK22),
+      recovery_state_{rjPolicyObj.createState()},
+      stencil_states_{rjPolicyObj.createState()},
+      rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj))
+  {
+    sdirk_increments_.push_back(rj_policy_.get().createState());
+  }
+
+  // *** SDIRK33 ***//
+  ImplicitStepperStandardImpl(::pressio::ode::SDIRK33,
+			      ResidualJacobianPolicyType && rjPolicyObj)
+    : name_(StepScheme::SDIRK33),
+      recovery_state_{rjPolicyObj.createState()},
+      stencil_states_{rjPolicyObj.createState()},
+      rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj))
+  {
+    sdirk_increments_.push_back(rj_policy_.get().createState());
+    sdirk_increments_.push_back(rj_policy_.get().createState());
+  }
+
 public:
   template<class SolverType, class ...SolverArgs>
   void operator()(StateType & odeState,
@@ -136,6 +218,7 @@ public:
 		  SolverType & solver,
 		  SolverArgs && ...argsForSolver)
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("ode::implicit_stepper");
     PRESSIOLOG_DEBUG("implicit stepper: do step");
 
     if (name_==::pressio::ode::StepScheme::BDF1){
@@ -152,14 +235,75 @@ public:
 		 std::forward<SolverArgs>(argsForSolver)...);
     }
 
+    else if (name_==::pressio::ode::StepScheme::BDF3){
+      doStepImpl(::pressio::ode::BDF3(),
+		 odeState, stepStartVal.get(), stepSize.get(),
+		 stepNumber.get(), solver,
+		 std::forward<SolverArgs>(argsForSolver)...);
+    }
+
+    else if (name_==::pressio::ode::StepScheme::BDF4){
+      doStepImpl(::pressio::ode::BDF4(),
+		 odeState, stepStartVal.get(), stepSize.get(),
+		 stepNumber.get(), solver,
+		 std::forward<SolverArgs>(argsForSolver)...);
+    }
+
     else if (name_==::pressio::ode::StepScheme::CrankNicolson){
       doStepImpl(::pressio::ode::CrankNicolson(),
 		 odeState, stepStartVal.get(), stepSize.get(),
 		 stepNumber.get(), solver,
 		 std::forward<SolverArgs>(argsForSolver)...);
     }
+
+    else if (name_==::pressio::ode::StepScheme::SDIRK22){
+      doSdirkStepImpl<::pressio::ode::tableaus::Alexander2Sdirk>
+	(odeState, stepStartVal.get(), stepSize.get(),
+	 stepNumber.get(), solver,
+	 std::forward<SolverArgs>(argsForSolver)...);
+    }
+
+    else if (name_==::pressio::ode::StepScheme::SDIRK33){
+      doSdirkStepImpl<::pressio::ode::tableaus::Alexander3Sdirk>
+	(odeState, stepStartVal.get(), stepSize.get(),
+	 stepNumber.get(), solver,
+	 std::forward<SolverArgs>(argsForSolver)...);
+    }
   }
 
+  /* local error estimate for adaptive stepping, only available for bdf1
+     since the fixed coefficients of bdf2,3,4 assume a constant step size,
+     so these are only enabled when the scheme is BDF1 at compile time.
+     It has to be enabled before stepping because it keeps one more past state. */
+  template<
+    class _SchemeTag = SchemeTag,
+    std::enable_if_t< std::is_same<_SchemeTag, ::pressio::ode::BDF1>::value, int > = 0
+    >
+  void enableLocalErrorEstimate(){
+    if (error_estimate_states_.empty()){
+      error_estimate_states_.push_back(rj_policy_.get().createState());
+      error_estimate_states_.push_back(rj_policy_.get().createState());
+    }
+  }
+
+  template<
+    class _SchemeTag = SchemeTag,
+    std::enable_if_t< std::is_same<_SchemeTag, ::pressio::ode::BDF1>::value, int > = 0
+    >
+  const StateType & localErrorEstimate() const{
+    if (error_estimate_states_.empty()){
+      throw std::runtime_error("The local error estimate of the implicit stepper is not enabled");
+    }
+    return error_estimate_states_[0];
+  }
+
+  // the estimate is O(dt^2), like the embedded pairs of order 1
+  template<
+    class _SchemeTag = SchemeTag,
+    std::enable_if_t< std::is_same<_SchemeTag, ::pressio::ode::BDF1>::value, int > = 0
+    >
+  int errorEstimateOrder() const{ return 1; }
+
   StateType createState() const{ return rj_policy_.get().createState(); }
   ResidualType createResidual() const{ return rj_policy_.get().createResidual(); }
   JacobianType createJacobian() const{ return rj_policy_.get().createJacobian(); }
@@ -172,7 +316,11 @@ public:
                            jacobian_type* Jo) const
 #endif
   {
-    rj_policy_.get()(name_, odeState, stencil_states_, stencil_rhs_,
+    // the bdf3/bdf4 startup sub-steps and the sdirk stages are bdf1 solves
+    const bool isSdirk = name_ == ::pressio::ode::StepScheme::SDIRK22
+      || name_ == ::pressio::ode::StepScheme::SDIRK33;
+    const auto scheme = (in_startup_ || isSdirk) ? ::pressio::ode::StepScheme::BDF1 : name_;
+    rj_policy_.get()(scheme, odeState, stencil_states_, stencil_rhs_,
 		     ::pressio::ode::StepEndAt<IndVarType>(t_np1_),
 		     ::pressio::ode::StepCount(step_number_),
 		     ::pressio::ode::StepSize<IndVarType>(dt_),
@@ -207,24 +355,121 @@ private:
     t_np1_ = currentTime + dt_;
     step_number_ = stepNumber;
 
+    // with the error estimate, y_n is still the start of the previous
+    // step here: keep it as y_n-1 unless this step is being retried
+    const bool estimateError = !error_estimate_states_.empty();
+    const bool hasHistory = estimateError && stepNumber != ::pressio::ode::first_step_value;
+    if (hasHistory && stepNumber != last_estimated_step_){
+      ::pressio::ops::deep_copy(error_estimate_states_[1], stencil_states_(ode::n()));
+      previous_dt_ = last_dt_;
+      last_estimated_step_ = stepNumber;
+    }
+    if (estimateError && !hasHistory){
+      ::pressio::ops::deep_copy(recovery_state_, odeState);
+    }
+
     // copy current solution into y_n
     auto & odeState_n = stencil_states_(ode::n());
     ::pressio::ops::deep_copy(odeState_n, odeState);
 
     try{
       solver.solve(*this, odeState, std::forward<SolverArgs>(argsForSolver)...);
+
+      if (hasHistory){
+	computeErrorEstimateFromPredictor(odeState, dt);
+      }
+      else if (estimateError){
+	computeErrorEstimateWithHalfSteps(odeState, currentTime, dt, solver,
+					  std::forward<SolverArgs>(argsForSolver)...);
+	step_number_ = stepNumber;
+	last_estimated_step_ = stepNumber;
+      }
     }
     catch (::pressio::eh::NonlinearSolveFailure const & e)
     {
+      dt_ = dt;
+      t_np1_ = currentTime + dt;
+      step_number_ = stepNumber;
+
+      // the half steps overwrite y_n, which is kept in the recovery state
+      if (estimateError && !hasHistory){
+	::pressio::ops::deep_copy(odeState_n, recovery_state_);
+      }
+
       // if failure, then revert odeState to what it was before
       // attempting the solve, which was stored into y_n,
-      auto & stateBeforeTryingSolve = stencil_states_(ode::n());
-      ::pressio::ops::deep_copy(odeState, stateBeforeTryingSolve);
+      ::pressio::ops::deep_copy(odeState, odeState_n);
 
       throw ::pressio::eh::TimeStepFailure();
     }
   }
 
+  /*
+    bdf1 local error estimate from the difference between the
+    corrector and the linear extrapolation predictor:
+      y_p = y_n + dt/dt_prev*(y_n - y_n-1)
+      err = dt/(2*dt + dt_prev) * (y_n+1 - y_p)
+    which follows from the leading error terms, -dt^2/2*y'' for
+    backward euler and dt*(dt + dt_prev)/2*y'' for the predictor.
+    It only uses states, so it works for any residual policy.
+  */
+  void computeErrorEstimateFromPredictor(const state_type & odeState,
+					 const IndVarType & dt)
+  {
+    using sc_t = typename ::pressio::Traits<state_type>::scalar_type;
+    constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<sc_t>::one();
+    constexpr auto two  = ::pressio::utils::Constants<sc_t>::two();
+
+    const sc_t ratio = dt/previous_dt_;
+    const sc_t coeff = dt/(two*dt + previous_dt_);
+    ::pressio::ops::update(error_estimate_states_[0], zero,
+			   odeState, coeff,
+			   stencil_states_(ode::n()), -coeff*(one + ratio),
+			   error_estimate_states_[1], coeff*ratio);
+    last_dt_ = dt;
+  }
+
+  /*
+    the first step has no history for the predictor, so it is redone
+    with two half steps and the estimate is the difference between the
+    two solutions (Richardson for a first order scheme).
+    The more accurate solution is kept, and the next step uses the state
+    after the first half step as y_n-1. The half steps are counted with
+    negative step numbers, as the bdf3/bdf4 startup sub-steps.
+  */
+  template<class solver_type, class ...SolverArgs>
+  void computeErrorEstimateWithHalfSteps(state_type & odeState,
+					 const IndVarType & currentTime,
+					 const IndVarType & dt,
+					 solver_type & solver,
+					 SolverArgs&& ...argsForSolver)
+  {
+    using sc_t = typename ::pressio::Traits<state_type>::scalar_type;
+    constexpr auto one  = ::pressio::utils::Constants<sc_t>::one();
+    constexpr auto two  = ::pressio::utils::Constants<sc_t>::two();
+
+    auto & odeState_n = stencil_states_(ode::n());
+    auto & errorEstimate = error_estimate_states_[0];
+    ::pressio::ops::deep_copy(errorEstimate, odeState);
+    ::pressio::ops::deep_copy(odeState, odeState_n);
+
+    const IndVarType halfDt = dt/two;
+    dt_ = halfDt;
+    t_np1_ = currentTime + halfDt;
+    step_number_ = --startup_substep_count_;
+    solver.solve(*this, odeState, std::forward<SolverArgs>(argsForSolver)...);
+
+    ::pressio::ops::deep_copy(odeState_n, odeState);
+    t_np1_ = currentTime + dt;
+    step_number_ = --startup_substep_count_;
+    solver.solve(*this, odeState, std::forward<SolverArgs>(argsForSolver)...);
+
+    ::pressio::ops::update(errorEstimate, -one, odeState, one);
+    dt_ = dt;
+    last_dt_ = halfDt;
+  }
+
   template<class solver_type, class ...SolverArgs>
   void doStepImpl(::pressio::ode::BDF2,
 		  state_type & odeState,
@@ -234,6 +479,49 @@ private:
 		  solver_type & solver,
 		  SolverArgs&& ...argsForSolver)
   {
+    doMultiStepImpl(2, odeState, currentTime, dt, stepNumber, solver,
+		    std::forward<SolverArgs>(argsForSolver)...);
+  }
+
+  template<class solver_type, class ...SolverArgs>
+  void doStepImpl(::pressio::ode::BDF3,
+		  state_type & odeState,
+		  const IndVarType & currentTime,
+		  const IndVarType & dt,
+		  const int32_t & stepNumber,
+		  solver_type & solver,
+		  SolverArgs&& ...argsForSolver)
+  {
+    doMultiStepImpl(3, odeState, currentTime, dt, stepNumber, solver,
+		    std::forward<SolverArgs>(argsForSolver)...);
+  }
+
+  template<class solver_type, class ...SolverArgs>
+  void doStepImpl(::pressio::ode::BDF4,
+		  state_type & odeState,
+		  const IndVarType & currentTime,
+		  const IndVarType & dt,
+		  const int32_t & stepNumber,
+		  solver_type & solver,
+		  SolverArgs&& ...argsForSolver)
+  {
+    doMultiStepImpl(4, odeState, currentTime, dt, stepNumber, solver,
+		    std::forward<SolverArgs>(argsForSolver)...);
+  }
+
+  // shared by the multistep bdf schemes: the stencil states
+  // are shifted by rotation. Since a bdf scheme of order k needs k
+  // past states, bdf2 takes its first step with bdf1, while bdf3 and
+  // bdf4 compute their first k-1 steps with doStartupStepImpl
+  template<class solver_type, class ...SolverArgs>
+  void doMultiStepImpl(int order,
+		       state_type & odeState,
+		       const IndVarType & currentTime,
+		       const IndVarType & dt,
+		       const int32_t & stepNumber,
+		       solver_type & solver,
+		       SolverArgs&& ...argsForSolver)
+  {
 
     dt_ = dt;
     t_np1_ = currentTime + dt;
@@ -259,35 +547,120 @@ private:
       /* for step == 2, we are going from t_1 to t_2 and:
 	 odeState = the state at t1
 
-	 for step >= 3, copy y_n -> y_n-1, and then odeState -> y_n
+	 for step >= 2, y_n becomes y_n-1, y_n-1 becomes y_n-2, etc,
+	 by rotating the stencil (no data is copied),
+	 and then copy odeState -> y_n
       */
 
-      auto & odeState_n   = stencil_states_(ode::n());
-      auto & odeState_nm1 = stencil_states_(ode::nMinusOne());
-      ::pressio::ops::deep_copy(odeState_nm1, odeState_n);
+      stencil_states_.rotateForward();
+      auto & odeState_n = stencil_states_(ode::n());
       ::pressio::ops::deep_copy(odeState_n, odeState);
     }
 
+    const auto numStepsTaken = stepNumber - ::pressio::ode::first_step_value;
+    const bool isStartupStep = order > 2 && numStepsTaken < order - 1;
     try{
-      solver.solve(*this, odeState, std::forward<SolverArgs>(argsForSolver)...);
+      if (isStartupStep){
+	doStartupStepImpl(order - 1, odeState, currentTime, dt, solver,
+			  std::forward<SolverArgs>(argsForSolver)...);
+	step_number_ = stepNumber;
+      }
+      else{
+	solver.solve(*this, odeState, std::forward<SolverArgs>(argsForSolver)...);
+      }
     }
     catch (::pressio::eh::NonlinearSolveFailure const & e)
     {
+      in_startup_ = false;
+      dt_ = dt;
+      t_np1_ = currentTime + dt;
+      step_number_ = stepNumber;
+
+      // the startup overwrites y_n while sub-stepping, and keeps a copy
+      if (isStartupStep){
+	::pressio::ops::deep_copy(stencil_states_(ode::n()), recovery_state_);
+      }
+
       auto & odeState_n = stencil_states_(ode::n());
-      auto & odeState_nm1 = stencil_states_(ode::nMinusOne());
+      ::pressio::ops::deep_copy(odeState, odeState_n);
 
-      if (stepNumber == ::pressio::ode::first_step_value){
-	::pressio::ops::deep_copy(odeState, odeState_n);
-      }
-      else{
-	::pressio::ops::deep_copy(odeState, odeState_n);
-	::pressio::ops::deep_copy(odeState_n, odeState_nm1);
+      // undo the rotation so that y_n-1 goes back to being y_n
+      if (stepNumber != ::pressio::ode::first_step_value){
+	stencil_states_.rotateBackward();
       }
 
       throw ::pressio::eh::TimeStepFailure();
     }
   }
 
+  /*
+    Startup for bdf3 and bdf4: a bdf scheme of order k is only
+    of order k globally if the first k-1 states are accurate to O(dt^k),
+    which taking the first steps with the lower order bdf schemes
+    and the same dt does not give (bdf1 alone puts an O(dt^2) error
+    into the history). So each of these steps is computed by
+    extrapolating implicit euler over [t_n, t_n + dt]:
+
+      level j = 1..numLevels:  T_j = j implicit euler sub-steps of size dt/j
+      numLevels = 2 (bdf3):    y_n+1 = 2*T_2 - T_1
+      numLevels = 3 (bdf4):    y_n+1 = 9/2*T_3 - 4*T_2 + 1/2*T_1
+
+    which is the Aitken-Neville extrapolation for the harmonic sequence
+    and has local error O(dt^(numLevels+1)). Implicit euler and these
+    combinations damp the stiff modes, and only the bdf1 residual is
+    needed, so this works for any residual policy. The cost is
+    3 (bdf3) or 6 (bdf4) nonlinear solves for each of the first k-1 steps.
+    The policy is called for bdf1 with the sub-step size, and each
+    sub-step is counted with a distinct negative step number (-2, -3, ...)
+    so that policies which cache data per step see a new step.
+  */
+  template<class solver_type, class ...SolverArgs>
+  void doStartupStepImpl(int numLevels,
+			 state_type & odeState,
+			 const IndVarType & currentTime,
+			 const IndVarType & dt,
+			 solver_type & solver,
+			 SolverArgs&& ...argsForSolver)
+  {
+    using sc_t = typename ::pressio::Traits<state_type>::scalar_type;
+    auto & odeState_n = stencil_states_(ode::n());
+    ::pressio::ops::deep_copy(recovery_state_, odeState_n);
+
+    in_startup_ = true;
+    for (int level=1; level<=numLevels; ++level)
+    {
+      const IndVarType subDt = dt/static_cast<IndVarType>(level);
+      ::pressio::ops::deep_copy(odeState, recovery_state_);
+      for (int i=1; i<=level; ++i){
+	::pressio::ops::deep_copy(odeState_n, odeState);
+	dt_ = subDt;
+	t_np1_ = (i == level) ? currentTime + dt : currentTime + subDt*i;
+	step_number_ = --startup_substep_count_;
+	solver.solve(*this, odeState, std::forward<SolverArgs>(argsForSolver)...);
+      }
+
+      if (level < numLevels){
+	::pressio::ops::deep_copy(startup_levels_[level-1], odeState);
+      }
+    }
+    in_startup_ = false;
+
+    if (numLevels == 2){
+      ::pressio::ops::update(odeState, static_cast<sc_t>(2),
+			     startup_levels_[0], static_cast<sc_t>(-1));
+    }
+    else{
+      ::pressio::ops::update(odeState, static_cast<sc_t>(4.5),
+			     startup_levels_[1], static_cast<sc_t>(-4),
+			     startup_levels_[0], static_cast<sc_t>(0.5));
+    }
+
+    // restore y_n and the step data
+    ::pressio::ops::deep_copy(odeState_n, recovery_state_);
+    dt_ = dt;
+    t_np1_ = currentTime + dt;
+  }
+
   template<class solver_type, class ...SolverArgs>
   void doStepImpl(::pressio::ode::CrankNicolson,
 		  state_type & odeState,
@@ -322,6 +695,78 @@ private:
     }
   }
 
+  /*
+    SDIRK with a stiffly accurate tableau, stage i = 0,...,s-1 solves
+      Y_i = y_n + dt * sum_{j<i} a_ij f(Y_j) + gamma*dt*f(Y_i, t_n + c_i*dt)
+    and y_n+1 = Y_s-1. Since the solve of stage j gives
+    gamma*dt*f(Y_j) = Y_j - Z_j, where Z_j is the start of stage j,
+    stage i is the bdf1 residual with step gamma*dt starting from
+      Z_i = y_n + sum_{j<i} a_ij/gamma * (Y_j - Z_j)
+    So only the bdf1 residual is needed, which works for any residual
+    policy (e.g. lspg), and f is not evaluated outside of the solves.
+    Z_i is stored as y_n in the stencil and y_n itself in the recovery
+    state. Each stage is counted with a distinct negative step number,
+    as the bdf3/bdf4 startup sub-steps, so that policies which cache
+    data per step, e.g. the lspg FOM states, see a new y_n.
+  */
+  template<class TableauType, class solver_type, class ...SolverArgs>
+  void doSdirkStepImpl(state_type & odeState,
+		       const IndVarType & currentTime,
+		       const IndVarType & dt,
+		       const int32_t & stepNumber,
+		       solver_type & solver,
+		       SolverArgs&& ...argsForSolver)
+  {
+    using sc_t = typename ::pressio::Traits<state_type>::scalar_type;
+    constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<sc_t>::one();
+    constexpr std::size_t numStages = TableauType::stages;
+    static_assert(numStages >= 1, "");
+    const sc_t gamma = static_cast<sc_t>(TableauType::gamma);
+
+    auto & stageStart = stencil_states_(ode::n());
+    ::pressio::ops::deep_copy(recovery_state_, odeState);
+
+    dt_ = static_cast<IndVarType>(TableauType::gamma)*dt;
+    try{
+      for (std::size_t i=0; i<numStages; ++i)
+      {
+	::pressio::ops::deep_copy(stageStart, recovery_state_);
+	for (std::size_t j=0; j<i; ++j){
+	  const sc_t coeff = static_cast<sc_t>(TableauType::a(i,j))/gamma;
+	  ::pressio::ops::update(stageStart, one, sdirk_increments_[j], coeff);
+	}
+
+	// the initial guess is the previous stage
+	t_np1_ = currentTime + static_cast<IndVarType>(TableauType::c(i))*dt;
+	step_number_ = --startup_substep_count_;
+	solver.solve(*this, odeState, std::forward<SolverArgs>(argsForSolver)...);
+
+	if (i + 1 < numStages){
+	  ::pressio::ops::update(sdirk_increments_[i], zero,
+				 odeState, one, stageStart, -one);
+	}
+      }
+    }
+    catch (::pressio::eh::NonlinearSolveFailure const & e)
+    {
+      dt_ = dt;
+      t_np1_ = currentTime + dt;
+      step_number_ = stepNumber;
+
+      // revert odeState and y_n to the start of the step
+      ::pressio::ops::deep_copy(odeState, recovery_state_);
+      ::pressio::ops::deep_copy(stageStart, recovery_state_);
+      throw ::pressio::eh::TimeStepFailure();
+    }
+
+    // restore the step data, y_n+1 is the last stage
+    ::pressio::ops::deep_copy(stageStart, recovery_state_);
+    dt_ = dt;
+    t_np1_ = currentTime + dt;
+    step_number_ = stepNumber;
+  }
+
 };
 
 }}} // end namespace pressio::ode::implicitmethods
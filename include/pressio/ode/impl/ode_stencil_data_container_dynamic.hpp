@@ -84,51 +84,72 @@ public:
 public:
   std::size_t size() const{ return size_; }
 
+  /* rotate the stencil forward by one position without copying data:
+     each stored object moves one position back in the stencil
+     (e.g. what was at n becomes n-1) and the storage of the oldest
+     one becomes the most recent position. The content of the latter
+     is stale and has to be overwritten by the caller. */
+  void rotateForward(){
+    assert(size_>=1);
+    head_ = (head_ + size_ - 1) % size_;
+  }
+
+  // undo the effect of rotateForward
+  void rotateBackward(){
+    assert(size_>=1);
+    head_ = (head_ + 1) % size_;
+  }
+
   // non-const overloads
   ValueType & operator()(::pressio::ode::nPlusOne){
     assert(size_>=1);
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType & operator()(::pressio::ode::n){
     assert( size_>=2);
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusOne){
     assert( size_>=3);
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusTwo){
     assert( size_>=4);
-    return data_[3];
+    return data_[slot(3)];
   }
 
   // const overloads
   ValueType const & operator()(::pressio::ode::nPlusOne) const {
     assert( size_>=1);
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType const & operator()(::pressio::ode::n) const {
     assert( size_>=2);
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusOne) const {
     assert( size_>=3);
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusTwo) const {
     assert( size_>=4);
-    return data_[3];
+    return data_[slot(3)];
   }
 
+private:
+  // maps a logical stencil position to the index in data_
+  std::size_t slot(std::size_t i) const{ return (head_ + i) % size_; }
+
 private:
   data_type data_;
   std::size_t size_;
+  std::size_t head_ = 0;
 };
 
 
@@ -162,51 +183,72 @@ public:
 public:
   std::size_t size() const{ return size_; }
 
+  /* rotate the stencil forward by one position without copying data:
+     each stored object moves one position back in the stencil
+     (e.g. what was at n becomes n-1) and the storage of the oldest
+     one becomes the most recent position. The content of the latter
+     is stale and has to be overwritten by the caller. */
+  void rotateForward(){
+    assert(size_>=1);
+    head_ = (head_ + size_ - 1) % size_;
+  }
+
+  // undo the effect of rotateForward
+  void rotateBackward(){
+    assert(size_>=1);
+    head_ = (head_ + 1) % size_;
+  }
+
   // non-const overloads
   ValueType & operator()(::pressio::ode::n){
     assert( size_>=1);
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusOne){
     assert( size_>=2);
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusTwo){
     assert( size_>=3);
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusThree){
     assert( size_>=4);
-    return data_[3];
+    return data_[slot(3)];
   }
 
   // const overloads
   ValueType const & operator()(::pressio::ode::n) const {
     assert( size_>=1);
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusOne) const {
     assert( size_>=2);
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusTwo) const {
     assert( size_>=3);
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusThree) const {
     assert( size_>=4);
-    return data_[3];
+    return data_[slot(3)];
   }
 
+private:
+  // maps a logical stencil position to the index in data_
+  std::size_t slot(std::size_t i) const{ return (head_ + i) % size_; }
+
 private:
   data_type data_;
   std::size_t size_;
+  std::size_t head_ = 0;
 
 };
 
@@ -65,6 +65,7 @@ public:
 
 private:
   data_type data_;
+  std::size_t head_ = 0;
 
 public:
   template <std::size_t _N = N, std::enable_if_t<_N == 0, int> = 0>
@@ -114,55 +115,74 @@ public:
 public:
   static constexpr std::size_t size(){ return N; }
 
+  /* rotate the stencil forward by one position without copying data:
+     each stored object moves one position back in the stencil
+     (e.g. what was at n becomes n-1) and the storage of the oldest
+     one becomes the most recent position. The content of the latter
+     is stale and has to be overwritten by the caller. */
+  void rotateForward(){
+    static_assert( N>=1, "Calling rotateForward() requires N>=1");
+    head_ = (head_ + N - 1) % N;
+  }
+
+  // undo the effect of rotateForward
+  void rotateBackward(){
+    static_assert( N>=1, "Calling rotateBackward() requires N>=1");
+    head_ = (head_ + 1) % N;
+  }
+
   ValueType & operator()(::pressio::ode::nPlusOne){
     static_assert( N>=1,
       "Calling operator()(::pressio::ode::nPlusOne) requires N>=1");
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType & operator()(::pressio::ode::n){
     static_assert( N>=2,
       "Calling operator()(::pressio::ode::n) requires N>=2");
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusOne){
     static_assert( N>=3,
       "Calling operator()(::pressio::ode::nMinusOne) requires N>=3");
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusTwo){
     static_assert( N>=4,
       "Calling operator()(::pressio::ode::nMinusTwo) requires N>=4");
-    return data_[3];
+    return data_[slot(3)];
   }
 
   ValueType const & operator()(::pressio::ode::nPlusOne) const {
     static_assert( N>=1,
       "Calling operator()(::pressio::ode::nPlusOne) requires N>=1");
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType const & operator()(::pressio::ode::n) const {
     static_assert( N>=2,
       "Calling operator()(::pressio::ode::n) requires N>=2");
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusOne) const {
     static_assert( N>=3,
       "Calling operator()(::pressio::ode::nMinusOne) requires N>=3");
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusTwo) const {
     static_assert( N>=4,
       "Calling operator()(::pressio::ode::nMinusTwo) requires N>=4");
-    return data_[3];
+    return data_[slot(3)];
   }
 
 private:
+  // maps a logical stencil position to the index in data_
+  std::size_t slot(std::size_t i) const{ return (head_ + i) % N; }
+
   void setZero(){
     for (auto & it : data_){
       ::pressio::ops::set_zero(it);
@@ -182,6 +202,7 @@ public:
 
 private:
   data_type data_;
+  std::size_t head_ = 0;
 
 public:
   template <std::size_t _N = N, std::enable_if_t<_N == 0, int> = 0>
@@ -230,55 +251,74 @@ public:
 public:
   static constexpr std::size_t size(){ return N; }
 
+  /* rotate the stencil forward by one position without copying data:
+     each stored object moves one position back in the stencil
+     (e.g. what was at n becomes n-1) and the storage of the oldest
+     one becomes the most recent position. The content of the latter
+     is stale and has to be overwritten by the caller. */
+  void rotateForward(){
+    static_assert( N>=1, "Calling rotateForward() requires N>=1");
+    head_ = (head_ + N - 1) % N;
+  }
+
+  // undo the effect of rotateForward
+  void rotateBackward(){
+    static_assert( N>=1, "Calling rotateBackward() requires N>=1");
+    head_ = (head_ + 1) % N;
+  }
+
   ValueType & operator()(::pressio::ode::n){
     static_assert( N>=1,
       "Calling operator()(::pressio::ode::n) requires N>=1");
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusOne){
     static_assert( N>=2,
       "Calling operator()(::pressio::ode::nMinusOne) requires N>=2");
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusTwo){
     static_assert( N>=3,
       "Calling operator()(::pressio::ode::nMinusTwo) requires N>=3");
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType & operator()(::pressio::ode::nMinusThree){
     static_assert( N>=4,
       "Calling operator()(::pressio::ode::nMinusThree) requires N>=4");
-    return data_[3];
+    return data_[slot(3)];
   }
 
   ValueType const & operator()(::pressio::ode::n) const {
     static_assert( N>=1,
       "Calling operator()(::pressio::ode::n) requires N>=1");
-    return data_[0];
+    return data_[slot(0)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusOne) const {
     static_assert( N>=2,
       "Calling operator()(::pressio::ode::nMinusOne) requires N>=2");
-    return data_[1];
+    return data_[slot(1)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusTwo) const {
     static_assert( N>=3,
       "Calling operator()(::pressio::ode::nMinusTwo) requires N>=3");
-    return data_[2];
+    return data_[slot(2)];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusThree) const {
     static_assert( N>=4,
       "Calling operator()(::pressio::ode::nMinusThree) requires N>=4");
-    return data_[3];
+    return data_[slot(3)];
   }
 
 private:
+  // maps a logical stencil position to the index in data_
+  std::size_t slot(std::size_t i) const{ return (head_ + i) % N; }
+
   void setZero(){
     for (auto & it : data_){
       ::pressio::ops::set_zero(it);
@@ -0,0 +1,202 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_adaptive_step_size_controller.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_ODE_ADAPTIVE_STEP_SIZE_CONTROLLER_HPP_
+#define ODE_ODE_ADAPTIVE_STEP_SIZE_CONTROLLER_HPP_
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+namespace pressio{ namespace ode{
+
+template<class IndVarType>
+struct AdaptiveStepRecord{
+  typename StepCount::value_type step;
+  IndVarType startTime;
+  IndVarType stepSize;
+  IndVarType errorNorm;
+  bool accepted;
+};
+
+/*
+  PI step size controller for advance_to_target_point_with_adaptive_step.
+
+  The local error estimate e provided by the stepper is measured in the
+  weighted RMS norm:
+    ||e|| = sqrt( 1/N sum_i ( e_i / (absTol + relTol*|y_i|) )^2 )
+  where y is the state at the end of the step. A step is accepted if ||e|| <= 1.
+
+  With k = order of the error estimate + 1, the step size is scaled by
+    - after an accepted step:
+        safety * ||e_n||^(-beta1/k) * ||e_n-1||^(beta2/k)
+    - after a rejected step:
+        safety * ||e_n||^(-1/k)
+  clipped to [minFactor, maxFactor]. The step size is not allowed to grow
+  on the step immediately following a rejection.
+  If the stepper fails to compute the step (TimeStepFailure), the step is
+  rejected and the step size is scaled by minFactor.
+*/
+template<class IndVarType>
+class PIStepSizeController
+{
+  static_assert(std::is_floating_point<IndVarType>::value,
+		"PIStepSizeController requires a floating point independent variable");
+
+public:
+  using independent_variable_type = IndVarType;
+  using record_type = AdaptiveStepRecord<IndVarType>;
+
+private:
+  IndVarType absTol_;
+  IndVarType relTol_;
+  IndVarType safety_    = static_cast<IndVarType>(0.9);
+  IndVarType minFactor_ = static_cast<IndVarType>(0.2);
+  IndVarType maxFactor_ = static_cast<IndVarType>(5);
+  IndVarType beta1_     = static_cast<IndVarType>(0.7);
+  IndVarType beta2_     = static_cast<IndVarType>(0.4);
+  IndVarType minStepSize_ = std::numeric_limits<IndVarType>::epsilon();
+  IndVarType prevErrorNorm_ = ::pressio::utils::Constants<IndVarType>::one();
+  bool lastStepRejected_ = false;
+  bool recordHistory_ = true;
+  std::size_t numAccepted_ = 0;
+  std::size_t numRejected_ = 0;
+  std::vector<record_type> history_;
+
+public:
+  PIStepSizeController(IndVarType absTol, IndVarType relTol)
+    : absTol_(absTol), relTol_(relTol)
+  {
+    if (absTol_ < 0 || relTol_ < 0 || (absTol_ == 0 && relTol_ == 0)){
+      throw std::runtime_error("PIStepSizeController: tolerances must be non-negative and not both zero");
+    }
+  }
+
+  void setSafetyFactor(IndVarType value){ safety_ = value; }
+  void setStepSizeFactorBounds(IndVarType minFactor, IndVarType maxFactor){
+    if (minFactor <= 0 || minFactor >= 1 || maxFactor <= 1){
+      throw std::runtime_error("PIStepSizeController: factor bounds must satisfy 0 < min < 1 < max");
+    }
+    minFactor_ = minFactor;
+    maxFactor_ = maxFactor;
+  }
+  void setGains(IndVarType beta1, IndVarType beta2){ beta1_ = beta1; beta2_ = beta2; }
+  void setMinStepSize(IndVarType value){ minStepSize_ = value; }
+  void recordHistory(bool value){ recordHistory_ = value; }
+
+  IndVarType absoluteTolerance() const{ return absTol_; }
+  IndVarType relativeTolerance() const{ return relTol_; }
+  IndVarType minStepSize() const{ return minStepSize_; }
+  std::size_t numAcceptedSteps() const{ return numAccepted_; }
+  std::size_t numRejectedSteps() const{ return numRejected_; }
+  const std::vector<record_type> & history() const{ return history_; }
+
+  void reset(){
+    prevErrorNorm_ = ::pressio::utils::Constants<IndVarType>::one();
+    lastStepRejected_ = false;
+    numAccepted_ = 0;
+    numRejected_ = 0;
+    history_.clear();
+  }
+
+  /* called by the advancer after each attempted step:
+     returns true if the step is accepted, and overwrites dt
+     with the step size to use for the next attempt */
+  bool evaluateStep(typename StepCount::value_type step,
+		    IndVarType startTime,
+		    IndVarType errorNorm,
+		    int errorEstimateOrder,
+		    IndVarType & dt)
+  {
+    constexpr auto one = ::pressio::utils::Constants<IndVarType>::one();
+    const bool accepted = errorNorm <= one;
+    if (recordHistory_){
+      history_.push_back(record_type{step, startTime, dt, errorNorm, accepted});
+    }
+
+    const IndVarType k = static_cast<IndVarType>(errorEstimateOrder + 1);
+    // avoid dividing by zero when the estimate vanishes
+    const IndVarType err = std::max(errorNorm, static_cast<IndVarType>(1e-10));
+    IndVarType factor = {};
+    if (accepted){
+      factor = safety_ * std::pow(err, -beta1_/k) * std::pow(prevErrorNorm_, beta2_/k);
+      factor = std::min(lastStepRejected_ ? one : maxFactor_, factor);
+      prevErrorNorm_ = std::max(errorNorm, static_cast<IndVarType>(1e-4));
+      lastStepRejected_ = false;
+      ++numAccepted_;
+    }
+    else{
+      factor = std::min(safety_ * std::pow(err, -one/k), one);
+      lastStepRejected_ = true;
+      ++numRejected_;
+    }
+
+    dt *= std::max(minFactor_, factor);
+    return accepted;
+  }
+
+  /* called by the advancer when the step could not be computed,
+     e.g. because the nonlinear solve failed: the step is rejected
+     and dt is reduced by the smallest allowed factor */
+  void evaluateFailedStep(typename StepCount::value_type step,
+			  IndVarType startTime,
+			  IndVarType & dt)
+  {
+    if (recordHistory_){
+      history_.push_back(record_type{step, startTime, dt,
+	    std::numeric_limits<IndVarType>::infinity(), false});
+    }
+    lastStepRejected_ = true;
+    ++numRejected_;
+    dt *= minFactor_;
+  }
+};
+
+}}//end namespace pressio::ode
+#endif  // ODE_ODE_ADAPTIVE_STEP_SIZE_CONTROLLER_HPP_
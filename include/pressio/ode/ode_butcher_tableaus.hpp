@@ -0,0 +1,318 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_butcher_tableaus.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_ODE_BUTCHER_TABLEAUS_HPP_
+#define ODE_ODE_BUTCHER_TABLEAUS_HPP_
+
+namespace pressio{ namespace ode{ namespace tableaus{
+
+/*
+  Tableaus to use with the scheme tags ExplicitRungeKutta<> and
+  LowStorageRungeKutta<>, e.g.:
+
+    create_explicit_stepper<ExplicitRungeKutta<tableaus::Kutta3>>(system)
+
+  A (standard) explicit Butcher tableau must provide:
+    - static constexpr std::size_t stages
+    - static constexpr int order
+    - static constexpr double a(std::size_t i, std::size_t j), for j < i
+    - static constexpr double b(std::size_t i)
+    - static constexpr double c(std::size_t i)
+
+  A tableau used with EmbeddedRungeKutta<> must, in addition, provide
+  the weights of the embedded lower order method:
+    - static constexpr int embedded_order
+    - static constexpr double bhat(std::size_t i)
+  so that the stepper also computes the local error estimate
+    dt * sum_i (b_i - bhat_i) k_i
+
+  A low-storage (Williamson 2N) tableau must provide:
+    - static constexpr std::size_t stages
+    - static constexpr int order
+    - static constexpr double A(std::size_t i), with A(0) == 0
+    - static constexpr double B(std::size_t i)
+    - static constexpr double C(std::size_t i)
+  and a step is computed as, for i = 0,...,stages-1:
+    dy = A_i * dy + dt * f(y, t_n + C_i*dt)
+    y  = y + B_i * dy
+
+  A singly diagonally implicit (SDIRK) tableau, used by the implicit
+  stepper for StepScheme::SDIRK22 and StepScheme::SDIRK33, must provide:
+    - static constexpr std::size_t stages
+    - static constexpr int order
+    - static constexpr double gamma, the diagonal entry a(i,i)
+    - static constexpr double a(std::size_t i, std::size_t j), for j <= i
+    - static constexpr double b(std::size_t i)
+    - static constexpr double c(std::size_t i)
+  and must be stiffly accurate, i.e. b(i) == a(stages-1, i), so that
+  the last stage is the new state.
+*/
+
+struct Heun2{
+  static constexpr std::size_t stages = 2;
+  static constexpr int order = 2;
+
+  static constexpr double a(std::size_t i, std::size_t j){
+    constexpr double A[stages][stages] = {{0., 0.},
+					  {1., 0.}};
+    return A[i][j];
+  }
+  static constexpr double b(std::size_t i){
+    constexpr double B[stages] = {0.5, 0.5};
+    return B[i];
+  }
+  static constexpr double c(std::size_t i){
+    constexpr double C[stages] = {0., 1.};
+    return C[i];
+  }
+};
+
+struct Kutta3{
+  static constexpr std::size_t stages = 3;
+  static constexpr int order = 3;
+
+  static constexpr double a(std::size_t i, std::size_t j){
+    constexpr double A[stages][stages] = {{ 0.,  0., 0.},
+					  { 0.5, 0., 0.},
+					  {-1.,  2., 0.}};
+    return A[i][j];
+  }
+  static constexpr double b(std::size_t i){
+    constexpr double B[stages] = {1./6., 2./3., 1./6.};
+    return B[i];
+  }
+  static constexpr double c(std::size_t i){
+    constexpr double C[stages] = {0., 0.5, 1.};
+    return C[i];
+  }
+};
+
+struct ClassicRK4{
+  static constexpr std::size_t stages = 4;
+  static constexpr int order = 4;
+
+  static constexpr double a(std::size_t i, std::size_t j){
+    constexpr double A[stages][stages] = {{0.,  0.,  0., 0.},
+					  {0.5, 0.,  0., 0.},
+					  {0.,  0.5, 0., 0.},
+					  {0.,  0.,  1., 0.}};
+    return A[i][j];
+  }
+  static constexpr double b(std::size_t i){
+    constexpr double B[stages] = {1./6., 1./3., 1./3., 1./6.};
+    return B[i];
+  }
+  static constexpr double c(std::size_t i){
+    constexpr double C[stages] = {0., 0.5, 0.5, 1.};
+    return C[i];
+  }
+};
+
+// Bogacki and Shampine, Appl. Math. Lett. 2 (1989), 3(2) pair
+struct BogackiShampine32{
+  static constexpr std::size_t stages = 4;
+  static constexpr int order = 3;
+  static constexpr int embedded_order = 2;
+
+  static constexpr double a(std::size_t i, std::size_t j){
+    constexpr double A[stages][stages] = {{0.,    0.,    0.,    0.},
+					  {0.5,   0.,    0.,    0.},
+					  {0.,    0.75,  0.,    0.},
+					  {2./9., 1./3., 4./9., 0.}};
+    return A[i][j];
+  }
+  static constexpr double b(std::size_t i){
+    constexpr double B[stages] = {2./9., 1./3., 4./9., 0.};
+    return B[i];
+  }
+  static constexpr double bhat(std::size_t i){
+    constexpr double B[stages] = {7./24., 1./4., 1./3., 1./8.};
+    return B[i];
+  }
+  static constexpr double c(std::size_t i){
+    constexpr double C[stages] = {0., 0.5, 0.75, 1.};
+    return C[i];
+  }
+};
+
+// Dormand and Prince, J. Comput. Appl. Math. 6 (1980), 5(4) pair
+struct DormandPrince54{
+  static constexpr std::size_t stages = 7;
+  static constexpr int order = 5;
+  static constexpr int embedded_order = 4;
+
+  static constexpr double a(std::size_t i, std::size_t j){
+    constexpr double A[stages][stages] = {
+      {0., 0., 0., 0., 0., 0., 0.},
+      {1./5., 0., 0., 0., 0., 0., 0.},
+      {3./40., 9./40., 0., 0., 0., 0., 0.},
+      {44./45., -56./15., 32./9., 0., 0., 0., 0.},
+      {19372./6561., -25360./2187., 64448./6561., -212./729., 0., 0., 0.},
+      {9017./3168., -355./33., 46732./5247., 49./176., -5103./18656., 0., 0.},
+      {35./384., 0., 500./1113., 125./192., -2187./6784., 11./84., 0.}};
+    return A[i][j];
+  }
+  static constexpr double b(std::size_t i){
+    constexpr double B[stages] = {35./384., 0., 500./1113., 125./192.,
+				  -2187./6784., 11./84., 0.};
+    return B[i];
+  }
+  static constexpr double bhat(std::size_t i){
+    constexpr double B[stages] = {5179./57600., 0., 7571./16695., 393./640.,
+				  -92097./339200., 187./2100., 1./40.};
+    return B[i];
+  }
+  static constexpr double c(std::size_t i){
+    constexpr double C[stages] = {0., 1./5., 3./10., 4./5., 8./9., 1., 1.};
+    return C[i];
+  }
+};
+
+// Williamson, J. Comput. Phys. 35 (1980), 3-stage third order
+struct Williamson3LowStorage{
+  static constexpr std::size_t stages = 3;
+  static constexpr int order = 3;
+
+  static constexpr double A(std::size_t i){
+    constexpr double v[stages] = {0., -5./9., -153./128.};
+    return v[i];
+  }
+  static constexpr double B(std::size_t i){
+    constexpr double v[stages] = {1./3., 15./16., 8./15.};
+    return v[i];
+  }
+  static constexpr double C(std::size_t i){
+    constexpr double v[stages] = {0., 1./3., 3./4.};
+    return v[i];
+  }
+};
+
+// Carpenter and Kennedy, NASA TM-109112 (1994), RK4(5)[2N]: 5-stage fourth order
+struct CarpenterKennedy4LowStorage{
+  static constexpr std::size_t stages = 5;
+  static constexpr int order = 4;
+
+  static constexpr double A(std::size_t i){
+    constexpr double v[stages] = {
+      0.,
+      -567301805773./1357537059087.,
+      -2404267990393./2016746695238.,
+      -3550918686646./2091501179385.,
+      -1275806237668./842570457699.};
+    return v[i];
+  }
+  static constexpr double B(std::size_t i){
+    constexpr double v[stages] = {
+      1432997174477./9575080441755.,
+      5161836677717./13612068292357.,
+      1720146321549./2090206949498.,
+      3134564353537./4481467310338.,
+      2277821191437./14882151754819.};
+    return v[i];
+  }
+  static constexpr double C(std::size_t i){
+    constexpr double v[stages] = {
+      0.,
+      1432997174477./9575080441755.,
+      2526269341429./6820363962896.,
+      2006345519317./3224310063776.,
+      2802321613138./2924317926251.};
+    return v[i];
+  }
+};
+
+// Alexander, SIAM J. Numer. Anal. 14 (1977), 2-stage second order,
+// L-stable, with gamma = 1 - 1/sqrt(2)
+struct Alexander2Sdirk{
+  static constexpr std::size_t stages = 2;
+  static constexpr int order = 2;
+  static constexpr double gamma = 0.29289321881345247559915563789515;
+
+  static constexpr double a(std::size_t i, std::size_t j){
+    constexpr double A[stages][stages] = {{gamma,      0.},
+					  {1. - gamma, gamma}};
+    return A[i][j];
+  }
+  static constexpr double b(std::size_t i){
+    constexpr double B[stages] = {1. - gamma, gamma};
+    return B[i];
+  }
+  static constexpr double c(std::size_t i){
+    constexpr double C[stages] = {gamma, 1.};
+    return C[i];
+  }
+};
+
+// Alexander, SIAM J. Numer. Anal. 14 (1977), 3-stage third order,
+// L-stable, gamma is the root in (1/6, 1/2) of x^3 - 3x^2 + 3/2x - 1/6
+struct Alexander3Sdirk{
+  static constexpr std::size_t stages = 3;
+  static constexpr int order = 3;
+  static constexpr double gamma = 0.43586652150845899941601945119356;
+
+  static constexpr double a(std::size_t i, std::size_t j){
+    constexpr double A[stages][stages] = {
+      {gamma,                                 0.,                                    0.},
+      {0.28206673924577050029199027440322,    gamma,                                 0.},
+      {1.2084966491760100703364776840633,    -0.64436317068446906975249713525688,    gamma}};
+    return A[i][j];
+  }
+  static constexpr double b(std::size_t i){
+    constexpr double B[stages] = {1.2084966491760100703364776840633,
+				  -0.64436317068446906975249713525688,
+				  gamma};
+    return B[i];
+  }
+  static constexpr double c(std::size_t i){
+    constexpr double C[stages] = {gamma, 0.71793326075422949970800972559678, 1.};
+    return C[i];
+  }
+};
+
+}}}//end namespace pressio::ode::tableaus
+#endif  // ODE_ODE_BUTCHER_TABLEAUS_HPP_
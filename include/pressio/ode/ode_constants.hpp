@@ -72,6 +72,29 @@ struct bdf2{
   static constexpr scalar_t c_f_   = cnst::negOne()*cnst::twoOvThree();
 };
 
+// y_n+1 - (18/11)*y_n + (9/11)*y_n-1 - (2/11)*y_n-2 = (6/11)*dt*f_n+1
+template <typename scalar_t>
+struct bdf3{
+  using cnst = ::pressio::utils::Constants<scalar_t>;
+  static constexpr scalar_t c_np1_ = cnst::one();
+  static constexpr scalar_t c_n_   = static_cast<scalar_t>(-18)/static_cast<scalar_t>(11);
+  static constexpr scalar_t c_nm1_ = static_cast<scalar_t>(9)/static_cast<scalar_t>(11);
+  static constexpr scalar_t c_nm2_ = static_cast<scalar_t>(-2)/static_cast<scalar_t>(11);
+  static constexpr scalar_t c_f_   = static_cast<scalar_t>(-6)/static_cast<scalar_t>(11);
+};
+
+// y_n+1 - (48/25)*y_n + (36/25)*y_n-1 - (16/25)*y_n-2 + (3/25)*y_n-3 = (12/25)*dt*f_n+1
+template <typename scalar_t>
+struct bdf4{
+  using cnst = ::pressio::utils::Constants<scalar_t>;
+  static constexpr scalar_t c_np1_ = cnst::one();
+  static constexpr scalar_t c_n_   = static_cast<scalar_t>(-48)/static_cast<scalar_t>(25);
+  static constexpr scalar_t c_nm1_ = static_cast<scalar_t>(36)/static_cast<scalar_t>(25);
+  static constexpr scalar_t c_nm2_ = static_cast<scalar_t>(-16)/static_cast<scalar_t>(25);
+  static constexpr scalar_t c_nm3_ = static_cast<scalar_t>(3)/static_cast<scalar_t>(25);
+  static constexpr scalar_t c_f_   = static_cast<scalar_t>(-12)/static_cast<scalar_t>(25);
+};
+
 template <typename scalar_t>
 struct cranknicolson{
   using cnst = ::pressio::utils::Constants<scalar_t>;
@@ -49,7 +49,10 @@
 #ifndef ODE_ODE_CREATE_EXPLICIT_STEPPER_HPP_
 #define ODE_ODE_CREATE_EXPLICIT_STEPPER_HPP_
 
+#include "./ode_butcher_tableaus.hpp"
+#include "./impl/ode_explicit_stepper_kernels.hpp"
 #include "./impl/ode_explicit_stepper_without_mass_matrix.hpp"
+#include "./impl/ode_explicit_stepper_without_mass_matrix_static.hpp"
 #include "./impl/ode_explicit_stepper_with_mass_matrix.hpp"
 #include "./impl/ode_explicit_create_impl.hpp"
 
@@ -61,6 +64,7 @@ namespace pressio{ namespace ode{
 #if defined PRESSIO_ENABLE_CXX20
 template<class SystemType>
   requires RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>
+  && (!RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank == 1)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank == 1)
   && requires(      typename mpl::remove_cvref_t<SystemType>::state_type & s1,
@@ -81,7 +85,8 @@ template<class SystemType>
 template<
   class SystemType,
   std::enable_if_t<
-    RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>::value,
+    RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>::value
+    && !RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>::value,
     int > = 0
   >
 #endif
@@ -110,12 +115,65 @@ auto create_explicit_stepper(StepScheme schemeName,                     // (1)
     (schemeName, std::forward<SystemType>(odeSystem));
 }
 
+//
+// basic, no mass matrix, scheme known at compile time:
+// e.g. create_explicit_stepper<ode::RungeKutta4>(system)
+// the step is dispatched statically and the rhs storage
+// is a std::array sized for the scheme.
+//
+#if defined PRESSIO_ENABLE_CXX20
+template<class SchemeTag, class SystemType>
+  requires is_explicit_scheme_tag<SchemeTag>::value
+  && RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>
+  && (!RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank == 1)
+  && requires(      typename mpl::remove_cvref_t<SystemType>::state_type & s1,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s2,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f1,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f2,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f3,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f4,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > alpha)
+  {
+    { ::pressio::ops::deep_copy(s1, s2) };
+    { ::pressio::ops::update(s1, alpha, s2, alpha, f1, alpha) };
+    { ::pressio::ops::update(s1, alpha, f1, alpha) };
+    { ::pressio::ops::update(s1, alpha, f1, alpha, f2, alpha) };
+    { ::pressio::ops::update(s1, alpha, f1, alpha, f2, alpha, f3, alpha, f4, alpha) };
+  }
+#else
+template<
+  class SchemeTag,
+  class SystemType,
+  std::enable_if_t<
+    is_explicit_scheme_tag<SchemeTag>::value
+    && RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>::value
+    && !RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>::value,
+    int > = 0
+  >
+#endif
+auto create_explicit_stepper(SystemType && odeSystem)                   // (3)
+{
+
+  using sys_type = mpl::remove_cvref_t<SystemType>;
+  using ind_var_type = typename sys_type::independent_variable_type;
+  using state_type   = typename sys_type::state_type;
+  using rhs_type = typename sys_type::rhs_type;
+
+  // use "SystemType" as template arg, see (1) for reason
+  using impl_type = impl::ExplicitStepperNoMassMatrixStaticImpl<
+    SchemeTag, state_type, ind_var_type, SystemType, rhs_type>;
+  return impl_type(std::forward<SystemType>(odeSystem));
+}
+
 //
 // WITH mass matrix
 //
 #if defined PRESSIO_ENABLE_CXX20
 template<class SystemType>
   requires RealValuedOdeSystemFusingMassMatrixAndRhs<mpl::remove_cvref_t<SystemType>>
+  && (!RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank == 1)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank == 1)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::mass_matrix_type>::rank == 2)
@@ -135,7 +193,8 @@ template<class SystemType>
 template<
   class SystemType,
   std::enable_if_t<
-    RealValuedOdeSystemFusingMassMatrixAndRhs<mpl::remove_cvref_t<SystemType>>::value,
+    RealValuedOdeSystemFusingMassMatrixAndRhs<mpl::remove_cvref_t<SystemType>>::value
+    && !RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>::value,
     int > = 0
   >
 #endif
@@ -155,6 +214,54 @@ auto create_explicit_stepper(StepScheme schemeName,                     // (2)
     (schemeName, std::forward<SystemType>(odeSystem));
 }
 
+//
+// WITH constant mass matrix: the system provides rhs(y, t, f)
+// and massMatrix(M), the latter being queried only once.
+// If the linear solver exposes resetLinearSystem(M) and solve(b, x),
+// the factorization of M is also computed once and reused.
+//
+#if defined PRESSIO_ENABLE_CXX20
+template<class SystemType>
+  requires RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::mass_matrix_type>::rank == 2)
+  && requires(      typename mpl::remove_cvref_t<SystemType>::state_type & s1,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s2,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s3,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s4,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s5,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > alpha)
+  {
+    { ::pressio::ops::deep_copy(s1, s2) };
+    { ::pressio::ops::update(s1, alpha, s2, alpha) };
+    { ::pressio::ops::update(s1, alpha, s2, alpha, s3, alpha) };
+    { ::pressio::ops::update(s1, alpha, s2, alpha, s3, alpha, s4, alpha, s5, alpha) };
+  }
+#else
+template<
+  class SystemType,
+  std::enable_if_t<
+    RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>::value,
+    int > = 0
+  >
+#endif
+auto create_explicit_stepper(StepScheme schemeName,                     // (4)
+			     SystemType && odeSystem)
+{
+
+  using sys_type = mpl::remove_cvref_t<SystemType>;
+  using ind_var_type = typename sys_type::independent_variable_type;
+  using state_type   = typename sys_type::state_type;
+  using rhs_type = typename sys_type::rhs_type;
+
+  // use "SystemType" as template arg, see (1) for reason
+  using impl_type = impl::ExplicitStepperWithMassMatrixImpl<
+    state_type, ind_var_type, SystemType, rhs_type>;
+  return impl::create_explicit_stepper<impl_type>
+    (schemeName, std::forward<SystemType>(odeSystem));
+}
+
 //
 // auxiliary scheme-specific functions
 //
@@ -72,6 +72,7 @@ template<class SystemType>
 	      const typename mpl::remove_cvref_t<SystemType>::state_type & s1,
 	      const typename mpl::remove_cvref_t<SystemType>::state_type & s2,
 	      const typename mpl::remove_cvref_t<SystemType>::state_type & s3,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s4,
 	      const typename mpl::remove_cvref_t<SystemType>::rhs_type   & r1,
 	      const typename mpl::remove_cvref_t<SystemType>::rhs_type   & r2,
 	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > a,
@@ -84,6 +85,8 @@ template<class SystemType>
     { ::pressio::ops::update(r, a, s1, b, s2, c) };
     { ::pressio::ops::update(r, a, s1, b, s2, c, s3, d) };
     { ::pressio::ops::update(r, a, s1, b, s2, c, r1, d, r2, e) };
+    { ::pressio::ops::update(r, a, s1, b, s2, c, s3, d, s4, e) };
+    { ::pressio::ops::update(r, a, s1, b) };
     { ::pressio::ops::scale(J, a) };
     { ::pressio::ops::add_to_diagonal(J, a) };
   }
@@ -101,7 +104,11 @@ auto create_implicit_stepper(StepScheme schemeName,                     // (1)
 
   assert(schemeName == StepScheme::BDF1 ||
 	 schemeName == StepScheme::BDF2 ||
-	 schemeName == StepScheme::CrankNicolson);
+	 schemeName == StepScheme::BDF3 ||
+	 schemeName == StepScheme::BDF4 ||
+	 schemeName == StepScheme::CrankNicolson ||
+	 schemeName == StepScheme::SDIRK22 ||
+	 schemeName == StepScheme::SDIRK33);
 
   using system_type   = mpl::remove_cvref_t<SystemType>;
   using ind_var_type  = typename system_type::independent_variable_type;
@@ -142,17 +149,21 @@ template<class SystemType>
 	      const typename mpl::remove_cvref_t<SystemType>::state_type & s1,
 	      const typename mpl::remove_cvref_t<SystemType>::state_type & s2,
 	      const typename mpl::remove_cvref_t<SystemType>::state_type & s3,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s4,
 	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & r1,
 	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > a,
 	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > b,
 	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > c,
-	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > d)
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > d,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > e)
   {
     { ::pressio::ops::deep_copy(s, s1) };
 
-    // bdf1 and bdf2
+    // bdf1, bdf2, bdf3, bdf4
     { ::pressio::ops::update(s, a, s1, b, s2, c) };
     { ::pressio::ops::update(s, a, s1, b, s2, c, s3, d) };
+    { ::pressio::ops::update(s, a, s1, b, s2, c, s3, d, s4, e) };
+    { ::pressio::ops::update(s, a, s1, b) };
     { ::pressio::ops::product(::pressio::nontranspose(), a, M, s1, b, r) };
     { ::pressio::ops::update(r, a, r1, b) };
     { ::pressio::ops::update(J, a, M, b)  };
@@ -170,7 +181,11 @@ auto create_implicit_stepper(StepScheme schemeName,                     // (2)
 {
 
   assert(schemeName == StepScheme::BDF1 ||
-	 schemeName == StepScheme::BDF2);
+	 schemeName == StepScheme::BDF2 ||
+	 schemeName == StepScheme::BDF3 ||
+	 schemeName == StepScheme::BDF4 ||
+	 schemeName == StepScheme::SDIRK22 ||
+	 schemeName == StepScheme::SDIRK33);
 
   using system_type   = mpl::remove_cvref_t<SystemType>;
   using ind_var_type  = typename system_type::independent_variable_type;
@@ -213,7 +228,11 @@ auto create_implicit_stepper(StepScheme schemeName,
 
   assert(schemeName == StepScheme::BDF1 ||
 	 schemeName == StepScheme::BDF2 ||
-	 schemeName == StepScheme::CrankNicolson);
+	 schemeName == StepScheme::BDF3 ||
+	 schemeName == StepScheme::BDF4 ||
+	 schemeName == StepScheme::CrankNicolson ||
+	 schemeName == StepScheme::SDIRK22 ||
+	 schemeName == StepScheme::SDIRK33);
 
   using policy_type   = mpl::remove_cvref_t<ResidualJacobianPolicyType>;
   using ind_var_type  = typename policy_type::independent_variable_type;
@@ -232,10 +251,18 @@ auto create_implicit_stepper(StepScheme schemeName,
 //
 // auxiliary API
 //
-template<class ...Args>
-auto create_bdf1_stepper(Args && ... args){
-  return create_implicit_stepper(StepScheme::BDF1,
-				 std::forward<Args>(args)...);
+/* same stepper as the one for StepScheme::BDF1, but with the scheme
+   fixed at compile time, so that it also provides the local error
+   estimate used by advance_to_target_point_with_adaptive_step */
+template<class SystemOrPolicyType>
+auto create_bdf1_stepper(SystemOrPolicyType && systemOrPolicy){
+  using stepper_type = decltype(create_implicit_stepper
+				(StepScheme::BDF1, std::forward<SystemOrPolicyType>(systemOrPolicy)));
+  using return_type = typename impl::ImplicitStepperWithFixedScheme<
+    stepper_type, ::pressio::ode::BDF1>::type;
+  using policy_type = typename return_type::policy_type;
+  return return_type(::pressio::ode::BDF1(),
+		     policy_type(std::forward<SystemOrPolicyType>(systemOrPolicy)));
 }
 
 template<class ...Args>
@@ -244,12 +271,36 @@ auto create_bdf2_stepper(Args && ... args){
 				 std::forward<Args>(args)...);
 }
 
+template<class ...Args>
+auto create_bdf3_stepper(Args && ... args){
+  return create_implicit_stepper(StepScheme::BDF3,
+				 std::forward<Args>(args)...);
+}
+
+template<class ...Args>
+auto create_bdf4_stepper(Args && ... args){
+  return create_implicit_stepper(StepScheme::BDF4,
+				 std::forward<Args>(args)...);
+}
+
 template<class ...Args>
 auto create_cranknicolson_stepper(Args && ... args){
   return create_implicit_stepper(StepScheme::CrankNicolson,
 				 std::forward<Args>(args)...);
 }
 
+template<class ...Args>
+auto create_sdirk22_stepper(Args && ... args){
+  return create_implicit_stepper(StepScheme::SDIRK22,
+				 std::forward<Args>(args)...);
+}
+
+template<class ...Args>
+auto create_sdirk33_stepper(Args && ... args){
+  return create_implicit_stepper(StepScheme::SDIRK33,
+				 std::forward<Args>(args)...);
+}
+
 
 //
 // num of states as template arg constructs the arbitrary stepper
@@ -60,7 +60,11 @@ enum class StepScheme{
   // implicit
   BDF1,
   BDF2,
+  BDF3,
+  BDF4,
   CrankNicolson,
+  SDIRK22,
+  SDIRK33,
   ImplicitArbitrary
 };
 
@@ -84,9 +88,29 @@ struct RungeKutta4{};
 struct AdamsBashforth2{};
 struct SSPRungeKutta3{};
 
+// explicit Runge-Kutta schemes defined by a tableau, see ode_butcher_tableaus.hpp
+template<class TableauType> struct ExplicitRungeKutta{};
+template<class TableauType> struct EmbeddedRungeKutta{};
+template<class TableauType> struct LowStorageRungeKutta{};
+
+template<class T> struct is_explicit_scheme_tag : std::false_type{};
+template<> struct is_explicit_scheme_tag<ForwardEuler>    : std::true_type{};
+template<> struct is_explicit_scheme_tag<RungeKutta4>     : std::true_type{};
+template<> struct is_explicit_scheme_tag<AdamsBashforth2> : std::true_type{};
+template<> struct is_explicit_scheme_tag<SSPRungeKutta3>  : std::true_type{};
+template<class T> struct is_explicit_scheme_tag<ExplicitRungeKutta<T>>   : std::true_type{};
+template<class T> struct is_explicit_scheme_tag<EmbeddedRungeKutta<T>>   : std::true_type{};
+template<class T> struct is_explicit_scheme_tag<LowStorageRungeKutta<T>> : std::true_type{};
+
 struct BDF1{};
 struct BDF2{};
+struct BDF3{};
+struct BDF4{};
 struct CrankNicolson{};
+// singly diagonally implicit Runge-Kutta: SDIRK<stages><order>,
+// see tableaus::Alexander2Sdirk and tableaus::Alexander3Sdirk
+struct SDIRK22{};
+struct SDIRK33{};
 struct ImplicitArbitrary{};
 
 class nPlusOne{};
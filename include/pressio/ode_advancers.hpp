@@ -66,5 +66,6 @@
 #include "./ode/ode_advance_to_target_point_variadic.hpp"
 #include "./ode/ode_advance_to_target_point_with_step_recovery.hpp"
 #include "./ode/ode_advance_to_target_point_with_step_recovery_variadic.hpp"
+#include "./ode/ode_advance_to_target_point_with_adaptive_step.hpp"
 
 #endif
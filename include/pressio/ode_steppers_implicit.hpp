@@ -60,6 +60,7 @@
 #include "./ode/ode_strong_types.hpp"
 #include "./ode/ode_constants.hpp"
 #include "./ode/ode_enum_and_tags.hpp"
+#include "./ode/ode_butcher_tableaus.hpp"
 #include "./ode/ode_create_implicit_stepper.hpp"
 
 #endif
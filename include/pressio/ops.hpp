@@ -90,6 +90,8 @@ template<class ...> struct matching_extents;
 #include "ops/eigen/ops_elementwise_multiply.hpp"
 #include "ops/eigen/ops_level2.hpp"
 #include "ops/eigen/ops_level3.hpp"
+#include "ops/eigen/ops_normal_equations_product.hpp"
+#include "ops/eigen/ops_product_with_offset.hpp"
 #endif
 
 // Kokkos
@@ -111,6 +113,8 @@ template<class ...> struct matching_extents;
 #include "ops/kokkos/ops_elementwise_multiply.hpp"
 #include "ops/kokkos/ops_level2.hpp"
 #include "ops/kokkos/ops_level3.hpp"
+#include "ops/kokkos/ops_normal_equations_product.hpp"
+#include "ops/kokkos/ops_product_with_offset.hpp"
 #endif
 
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
@@ -140,6 +144,8 @@ template<class ...> struct matching_extents;
 #include "ops/tpetra/ops_multi_vector_update.hpp"
 #include "ops/tpetra/ops_level2.hpp"
 #include "ops/tpetra/ops_level3.hpp"
+#include "ops/tpetra/ops_normal_equations_product.hpp"
+#include "ops/tpetra/ops_product_with_offset.hpp"
 
 // Tpetra block
 #include "ops/tpetra_block/ops_clone.hpp"
@@ -60,6 +60,7 @@ std::enable_if_t<
   >
 clone(const T & clonable)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(Clone);
  return T(clonable);
 }
 
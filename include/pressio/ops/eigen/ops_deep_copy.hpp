@@ -63,6 +63,7 @@ std::enable_if_t<
   >
 deep_copy(T2 & dest, const T1 & src)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(DeepCopy);
   assert((matching_extents<T2, T1>::compare(dest, src)));
 
   auto && src_n = impl::get_native(src);
@@ -109,8 +109,12 @@ product(::pressio::nontranspose /*unused*/,
   if (alpha_ == zero) {
     ::pressio::ops::scale(y_n, beta_);
   } else {
-    if (has_beta) { y_n = beta_ * y_n + alpha_ * A_n * x_n; }
-    else { y_n = alpha_ * A_n * x_n; }
+    // y does not alias A or x, so we can avoid Eigen's temporary
+    if (has_beta) {
+      y_n *= beta_;
+      y_n.noalias() += alpha_ * A_n * x_n;
+    }
+    else { y_n.noalias() = alpha_ * A_n * x_n; }
   }
 
 }
@@ -202,8 +206,12 @@ product(::pressio::transpose /*unused*/,
   if (alpha_ == zero) {
     ::pressio::ops::scale(y_n, beta_);
   } else {
-    if (has_beta) { y_n = beta_ * y_n + alpha_ * A_n.transpose() * x_n; }
-    else { y_n = alpha_ * A_n.transpose() * x_n; }
+    // y does not alias A or x, so we can avoid Eigen's temporary
+    if (has_beta) {
+      y_n *= beta_;
+      y_n.noalias() += alpha_ * A_n.transpose() * x_n;
+    }
+    else { y_n.noalias() = alpha_ * A_n.transpose() * x_n; }
   }
 }
 
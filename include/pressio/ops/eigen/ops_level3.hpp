@@ -99,11 +99,13 @@ product(::pressio::transpose /*unused*/,
   const sc_t alpha_(alpha);
   const sc_t beta_(beta);
 
+  // C does not alias A or B, so we can avoid Eigen's temporary
   if (beta_ == zero) {
-    C = alpha_ * A.transpose() * B;
+    C.noalias() = alpha_ * A.transpose() * B;
   }
   else {
-    C = beta_ * C + alpha_ * A.transpose() * B;
+    C *= beta_;
+    C.noalias() += alpha_ * A.transpose() * B;
   }
 }
 
@@ -151,14 +153,55 @@ product(::pressio::nontranspose /*unused*/,
   const sc_t alpha_(alpha);
   const sc_t beta_(beta);
 
+  // C does not alias A or B, so we can avoid Eigen's temporary
   if (beta_ == zero) {
-    C = alpha_ * A * B;
+    C.noalias() = alpha_ * A * B;
   }
   else {
-    C = beta_ * C + alpha_ * A * B;
+    C *= beta_;
+    C.noalias() += alpha_ * A * B;
   }
 }
 
+namespace impl{
+template <class A_type, class C_type>
+struct supports_syrk_eigen : std::integral_constant<bool,
+  ::pressio::is_dense_matrix_eigen<A_type>::value
+  && ::pressio::is_dense_matrix_eigen<C_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+  >{};
+
+template <class C_type>
+void mirror_lower_to_upper(C_type & C)
+{
+  const auto n = C.rows();
+  for (std::remove_const_t<decltype(n)> j=1; j<n; ++j){
+    for (std::remove_const_t<decltype(n)> i=0; i<j; ++i){
+      C(i,j) = C(j,i);
+    }
+  }
+}
+
+/* C = alpha * A^T * A computed as a symmetric rank-k update (SYRK):
+   only the lower triangle is computed and then mirrored,
+   which halves the flops compared to a general product */
+template <class A_type, class C_type, class sc_t>
+void self_transpose_product(std::true_type /*syrk*/,
+			    const sc_t & alpha, const A_type & A, C_type & C)
+{
+  C.setZero();
+  C.template selfadjointView<Eigen::Lower>().rankUpdate(A.transpose(), alpha);
+  mirror_lower_to_upper(C);
+}
+
+template <class A_type, class C_type, class sc_t>
+void self_transpose_product(std::false_type /*syrk*/,
+			    const sc_t & alpha, const A_type & A, C_type & C)
+{
+  C.noalias() = alpha * A.transpose() * A;
+}
+}//end namespace impl
+
 /***********************************
 * special case A==B and op(A) = transpose
 **********************************/
@@ -196,10 +239,13 @@ product(::pressio::transpose /*unused*/,
   const sc_t alpha_(alpha);
   const sc_t beta_(beta);
 
+  // for dense matrices, exploit the symmetry of A^T A when C is overwritten.
+  // When beta != 0, C is not assumed symmetric so we use the general product.
   if (beta_ == zero) {
-    C = alpha_ * A.transpose() * A;
+    impl::self_transpose_product(impl::supports_syrk_eigen<A_type, C_type>{}, alpha_, A, C);
   } else {
-    C = beta_ * C + alpha_ * A.transpose() * A;
+    C *= beta_;
+    C.noalias() += alpha_ * A.transpose() * A;
   }
 }
 
@@ -230,7 +276,7 @@ product(::pressio::transpose modeA,
   using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
   constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
   C_type C(::pressio::ops::extent(A, 1), ::pressio::ops::extent(A, 1));
-  product(modeA, modeB, alpha, A, A, zero, C);
+  product(modeA, modeB, alpha, A, zero, C);
   return C;
 }
 
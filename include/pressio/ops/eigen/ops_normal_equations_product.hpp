@@ -0,0 +1,144 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_normal_equations_product.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_EIGEN_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
+#define OPS_EIGEN_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
+
+namespace pressio{ namespace ops{
+
+namespace impl{
+/*
+  H += alpha * A^T A (lower triangle only) and g += alpha * A^T b
+
+  A is traversed in blocks of rows small enough to stay in cache,
+  and each block is used for both H and g, so that A is only
+  streamed once from memory.
+*/
+template <class A_type, class b_type, class H_type, class g_type, class sc_t>
+void normal_equations_product_lower_accumulate(const sc_t & alpha,
+					       const A_type & A,
+					       const b_type & b,
+					       H_type & H,
+					       g_type & g)
+{
+  using index_t = typename A_type::Index;
+  // ~256KB of A per block
+  constexpr index_t targetBlockSize = (index_t(1) << 18)/index_t(sizeof(sc_t));
+  const index_t m = A.rows();
+  const index_t n = A.cols();
+  const index_t blockRows = std::max<index_t>(index_t(1), targetBlockSize/std::max<index_t>(n, 1));
+
+  for (index_t r0 = 0; r0 < m; r0 += blockRows){
+    const index_t numRows = std::min(blockRows, m - r0);
+    const auto Ablock = A.middleRows(r0, numRows);
+    H.template selfadjointView<Eigen::Lower>().rankUpdate(Ablock.transpose(), alpha);
+    g.noalias() += alpha * Ablock.transpose() * b.segment(r0, numRows);
+  }
+}
+}//end namespace impl
+
+/*
+  H = beta * H + alpha * A^T * A
+  g = beta * g + alpha * A^T * b
+
+  computed in a single pass over A, which is what the normal equations of
+  Gauss-Newton need, instead of two products that both stream A.
+  Only one triangle of A^T A is computed: if beta != 0, H must be symmetric.
+*/
+template <class A_type, class b_type, class H_type, class g_type, class alpha_t, class beta_t>
+std::enable_if_t<
+     ::pressio::Traits<A_type>::rank == 2
+  && ::pressio::Traits<b_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_dense_matrix_eigen<A_type>::value
+  && ::pressio::is_vector_eigen<b_type>::value
+  && ::pressio::is_dense_matrix_eigen<H_type>::value
+  && ::pressio::is_vector_eigen<g_type>::value
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<A_type, b_type, H_type, g_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<beta_t,  typename ::pressio::Traits<A_type>::scalar_type>::value
+  >
+normal_equations_product(const alpha_t & alpha,
+			 const A_type & A,
+			 const b_type & b,
+			 const beta_t & beta,
+			 H_type & H,
+			 g_type & g)
+{
+  assert( ::pressio::ops::extent(A, 0) == ::pressio::ops::extent(b, 0) );
+  assert( ::pressio::ops::extent(H, 0) == ::pressio::ops::extent(A, 1) );
+  assert( ::pressio::ops::extent(H, 1) == ::pressio::ops::extent(A, 1) );
+  assert( ::pressio::ops::extent(g, 0) == ::pressio::ops::extent(A, 1) );
+
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+  const sc_t alpha_(alpha);
+  const sc_t beta_(beta);
+
+  if (beta_ == zero) {
+    H.setZero();
+    g.setZero();
+  } else {
+    H *= beta_;
+    g *= beta_;
+  }
+
+  if (alpha_ == zero) {
+    return;
+  }
+
+  impl::normal_equations_product_lower_accumulate(alpha_, A, b, H, g);
+  impl::mirror_lower_to_upper(H);
+}
+
+}}//end namespace pressio::ops
+#endif  // OPS_EIGEN_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
@@ -0,0 +1,126 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_product_with_offset.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_EIGEN_OPS_PRODUCT_WITH_OFFSET_HPP_
+#define OPS_EIGEN_OPS_PRODUCT_WITH_OFFSET_HPP_
+
+namespace pressio{ namespace ops{
+
+/*
+  y = alpha * A * x + beta * b
+
+  e.g. reconstructing an affine state y = phi*q + yRef.
+  y is computed in blocks of rows: each block is first set from b
+  and then accumulates A*x while it is still in cache, so neither
+  a temporary for A*x nor a second full pass over y is needed.
+  y and b must not alias.
+*/
+template <
+  class A_type, class x_type, class b_type, class y_type,
+  class alpha_t, class beta_t
+  >
+std::enable_if_t<
+     ::pressio::Traits<A_type>::rank == 2
+  && ::pressio::Traits<x_type>::rank == 1
+  && ::pressio::Traits<b_type>::rank == 1
+  && ::pressio::Traits<y_type>::rank == 1
+  // TPL/container specific
+  && (::pressio::is_native_container_eigen<A_type>::value
+   || ::pressio::is_expression_acting_on_eigen<A_type>::value)
+  && (::pressio::is_vector_eigen<x_type>::value
+   || ::pressio::is_expression_acting_on_eigen<x_type>::value)
+  && (::pressio::is_vector_eigen<b_type>::value
+   || ::pressio::is_expression_acting_on_eigen<b_type>::value)
+  && (::pressio::is_vector_eigen<y_type>::value
+   || ::pressio::is_expression_acting_on_eigen<y_type>::value)
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<A_type, x_type, b_type, y_type>::value
+  && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<beta_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && (std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value)
+  >
+product_with_offset(::pressio::nontranspose /*unused*/,
+		    const alpha_t & alpha,
+		    const A_type & A,
+		    const x_type & x,
+		    const beta_t & beta,
+		    const b_type & b,
+		    y_type & y)
+{
+  assert( (std::size_t)::pressio::ops::extent(y, 0) == (std::size_t)::pressio::ops::extent(A, 0) );
+  assert( (std::size_t)::pressio::ops::extent(b, 0) == (std::size_t)::pressio::ops::extent(A, 0) );
+  assert( (std::size_t)::pressio::ops::extent(x, 0) == (std::size_t)::pressio::ops::extent(A, 1) );
+
+  using sc_t = typename ::pressio::Traits<y_type>::scalar_type;
+  constexpr sc_t zero{0};
+  const sc_t alpha_(alpha);
+  const sc_t beta_(beta);
+  auto & y_n = impl::get_native(y);
+  const auto & A_n = impl::get_native(A);
+  const auto & x_n = impl::get_native(x);
+  const auto & b_n = impl::get_native(b);
+
+  using index_t = Eigen::Index;
+  // ~32KB of y per block, so that the block of y and b stay in cache
+  constexpr index_t blockRows = (index_t(1) << 15)/index_t(sizeof(sc_t));
+  const index_t m = A_n.rows();
+  for (index_t r0 = 0; r0 < m; r0 += blockRows){
+    const index_t numRows = std::min(blockRows, m - r0);
+    auto yblock = y_n.segment(r0, numRows);
+    if (beta_ == zero) { yblock.setZero(); }
+    else { yblock = beta_ * b_n.segment(r0, numRows); }
+
+    if (alpha_ != zero) {
+      yblock.noalias() += alpha_ * A_n.middleRows(r0, numRows) * x_n;
+    }
+  }
+}
+
+}}//end namespace pressio::ops
+#endif  // OPS_EIGEN_OPS_PRODUCT_WITH_OFFSET_HPP_
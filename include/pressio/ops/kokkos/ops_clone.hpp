@@ -57,6 +57,7 @@ std::enable_if_t<
   && ::pressio::is_native_container_kokkos<T>::value, T>
 clone(const T & clonable)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(Clone);
   T r(clonable.label()+"_clone", clonable.extent(0));
   Kokkos::deep_copy(r, clonable);
   return r;
@@ -68,6 +69,7 @@ std::enable_if_t<
   && ::pressio::is_native_container_kokkos<T>::value, T>
 clone(const T & clonable)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(Clone);
   T r(clonable.label()+"_clone", clonable.extent(0), clonable.extent(1));
   Kokkos::deep_copy(r, clonable);
   return r;
@@ -63,6 +63,7 @@ std::enable_if_t<
   >
 deep_copy(const T1 & dest, const T2 & src)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(DeepCopy);
   assert((matching_extents<T1, T2>::compare(dest, src)));
 
   const auto src_view = impl::get_native(src);
@@ -0,0 +1,258 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_normal_equations_product.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_KOKKOS_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
+#define OPS_KOKKOS_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
+
+namespace pressio{ namespace ops{
+
+namespace impl{
+
+/*
+  Single pass over the rows of A and b for the normal equations:
+  row i contributes A(i,:)^T A(i,:) and A(i,:)^T b(i), so each row is read
+  once and both products are accumulated by the same kernel.
+  The result is packed: the upper triangle of A^T A column by column,
+  i.e. entry (j,k) with j <= k at k(k+1)/2 + j, followed by A^T b.
+  This is an array reduction of size n(n+1)/2 + n, which is meant for
+  the small number of columns of the (reduced) operators used here.
+*/
+template <class AViewType, class bViewType>
+class NormalEquationsPackedProduct
+{
+public:
+  using scalar_type = typename AViewType::non_const_value_type;
+  using value_type = scalar_type[];
+  using size_type = std::size_t;
+
+  // the name is required by Kokkos for array reductions
+  size_type value_count;
+
+  NormalEquationsPackedProduct(const AViewType & A, const bViewType & b)
+    : value_count(packed_size(A.extent(1))), A_(A), b_(b), n_(A.extent(1)){}
+
+  static size_type packed_size(size_type n){ return n*(n + 1)/2 + n; }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type acc) const{
+    for (size_type i = 0; i < value_count; ++i){ acc[i] = scalar_type(0); }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type dst, const value_type src) const{
+    for (size_type i = 0; i < value_count; ++i){ dst[i] += src[i]; }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type i, value_type acc) const{
+    size_type pos = 0;
+    for (size_type k = 0; k < n_; ++k){
+      const scalar_type aik = A_(i,k);
+      for (size_type j = 0; j <= k; ++j){
+	acc[pos++] += A_(i,j)*aik;
+      }
+    }
+    const scalar_type bi = b_(i);
+    for (size_type j = 0; j < n_; ++j){
+      acc[pos++] += A_(i,j)*bi;
+    }
+  }
+
+private:
+  AViewType A_;
+  bViewType b_;
+  size_type n_;
+};
+
+template <class AViewType, class bViewType, class PackedViewType>
+void normal_equations_packed_product(const AViewType & A,
+				     const bViewType & b,
+				     const PackedViewType & packed)
+{
+  using exe_space = typename AViewType::execution_space;
+  const NormalEquationsPackedProduct<AViewType, bViewType> functor(A, b);
+  assert(b.extent(0) == A.extent(0));
+  assert(packed.extent(0) == functor.value_count);
+  // with no rows the result is the one of init, i.e. zero
+  Kokkos::parallel_reduce("pressio::ops::normalEquationsPackedProduct",
+			  Kokkos::RangePolicy<exe_space>(0, A.extent(0)),
+			  functor, packed);
+}
+
+/*
+  Buffers for the packed [H | g] of normal_equations_product.
+  This is called at every nonlinear iteration with the same number
+  of columns, so the buffers are kept across calls and only
+  reallocated when the number of columns changes.
+  The host buffers are only used by the distributed versions,
+  which reduce the packed local products over the ranks.
+  The buffers are released when Kokkos is finalized.
+*/
+template <class ScalarType, class DeviceType>
+class NormalEquationsProductBuffers
+{
+public:
+  using device_view_type = Kokkos::View<ScalarType*, DeviceType>;
+  using host_mirror_type = decltype(Kokkos::create_mirror_view(std::declval<device_view_type &>()));
+  using host_view_type = Kokkos::View<ScalarType*, Kokkos::HostSpace>;
+
+  static NormalEquationsProductBuffers & instance(){
+    static NormalEquationsProductBuffers buffers;
+    return buffers;
+  }
+
+  void resize(std::size_t n)
+  {
+    const auto size = n*(n + 1)/2 + n;
+    if (n_ == n && packed_.extent(0) == size){
+      return;
+    }
+
+    if (!finalizeHookRegistered_){
+      Kokkos::push_finalize_hook([](){
+	auto & buffers = NormalEquationsProductBuffers::instance();
+	buffers.packed_ = {};
+	buffers.packedHost_ = {};
+	buffers.global_ = {};
+	buffers.n_ = 0;
+	buffers.finalizeHookRegistered_ = false;
+      });
+      finalizeHookRegistered_ = true;
+    }
+
+    n_ = n;
+    packed_ = device_view_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+						  "normalEquationsPacked"), size);
+    packedHost_ = Kokkos::create_mirror_view(packed_);
+    global_ = host_view_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+						"normalEquationsGlobal"), size);
+  }
+
+  device_view_type packed_;
+  host_mirror_type packedHost_;
+  host_view_type global_;
+
+private:
+  std::size_t n_ = 0;
+  bool finalizeHookRegistered_ = false;
+};
+
+}//end namespace impl
+
+/*
+  H = beta * H + alpha * A^T * A
+  g = beta * g + alpha * A^T * b
+
+  A and b are read once: both products are accumulated in a single
+  kernel over the rows (see impl::NormalEquationsPackedProduct),
+  and a second small kernel scatters the packed result into H and g.
+*/
+template <class A_type, class b_type, class H_type, class g_type, class alpha_t, class beta_t>
+std::enable_if_t<
+     ::pressio::Traits<A_type>::rank == 2
+  && ::pressio::Traits<b_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_dense_matrix_kokkos<A_type>::value
+  && ::pressio::is_vector_kokkos<b_type>::value
+  && ::pressio::is_dense_matrix_kokkos<H_type>::value
+  && ::pressio::is_vector_kokkos<g_type>::value
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<A_type, b_type, H_type, g_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<beta_t,  typename ::pressio::Traits<A_type>::scalar_type>::value
+  >
+normal_equations_product(const alpha_t & alpha,
+			 const A_type & A,
+			 const b_type & b,
+			 const beta_t & beta,
+			 H_type & H,
+			 g_type & g)
+{
+  assert( ::pressio::ops::extent(A, 0) == ::pressio::ops::extent(b, 0) );
+  assert( ::pressio::ops::extent(H, 0) == ::pressio::ops::extent(A, 1) );
+  assert( ::pressio::ops::extent(H, 1) == ::pressio::ops::extent(A, 1) );
+  assert( ::pressio::ops::extent(g, 0) == ::pressio::ops::extent(A, 1) );
+
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  using exe_space = typename A_type::execution_space;
+  constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+  const sc_t alpha_(alpha);
+  const sc_t beta_(beta);
+
+  const std::size_t n = ::pressio::ops::extent(A, 1);
+  auto & buffers = impl::NormalEquationsProductBuffers<
+    sc_t, typename A_type::device_type>::instance();
+  buffers.resize(n);
+  const auto packed = buffers.packed_;
+  impl::normal_equations_packed_product(A, b, packed);
+
+  // as for gemm/gemv, H and g are not read if beta is zero
+  const bool betaIsZero = (beta_ == zero);
+  const auto H_ = H;
+  const auto g_ = g;
+  Kokkos::parallel_for("pressio::ops::normalEquationsUnpack",
+		       Kokkos::RangePolicy<exe_space>(0, n),
+		       KOKKOS_LAMBDA (const std::size_t k){
+			 const std::size_t offset = k*(k + 1)/2;
+			 for (std::size_t j = 0; j <= k; ++j){
+			   const sc_t v = alpha_*packed(offset + j);
+			   H_(j,k) = betaIsZero ? v : beta_*H_(j,k) + v;
+			   if (j != k){
+			     H_(k,j) = betaIsZero ? v : beta_*H_(k,j) + v;
+			   }
+			 }
+			 const sc_t v = alpha_*packed(n*(n + 1)/2 + k);
+			 g_(k) = betaIsZero ? v : beta_*g_(k) + v;
+		       });
+}
+
+}}//end namespace pressio::ops
+#endif  // OPS_KOKKOS_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
@@ -0,0 +1,140 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_product_with_offset.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_KOKKOS_OPS_PRODUCT_WITH_OFFSET_HPP_
+#define OPS_KOKKOS_OPS_PRODUCT_WITH_OFFSET_HPP_
+
+namespace pressio{ namespace ops{
+
+namespace impl{
+/*
+  y(i) = alpha * sum_j A(i,j) x(j) + beta * b(i)
+
+  one thread per row: each entry of y is written once, and b is read
+  once, so this is a single sweep over the rows of A, b and y.
+  Meant for tall-skinny A (e.g. a basis), where the inner loop is short.
+*/
+template <class ExeSpace, class A_view, class x_view, class b_view, class y_view, class sc_t>
+void product_with_offset_kernel(const sc_t alpha,
+				const A_view & A,
+				const x_view & x,
+				const sc_t beta,
+				const b_view & b,
+				const y_view & y)
+{
+  const auto zero = Kokkos::Details::ArithTraits<sc_t>::zero();
+  const std::size_t n = A.extent(1);
+  Kokkos::parallel_for("pressio::ops::product_with_offset",
+		       Kokkos::RangePolicy<ExeSpace>(0, A.extent(0)),
+		       KOKKOS_LAMBDA (const std::size_t i){
+			 sc_t Ax_i = zero;
+			 if (alpha != zero) {
+			   for (std::size_t j = 0; j < n; ++j) {
+			     Ax_i += A(i,j) * x(j);
+			   }
+			 }
+			 y(i) = (beta == zero) ? alpha*Ax_i : alpha*Ax_i + beta*b(i);
+		       });
+}
+}//end namespace impl
+
+/*
+  y = alpha * A * x + beta * b
+
+  e.g. reconstructing an affine state y = phi*q + yRef
+  without a separate pass over y to add yRef.
+  y and b must not alias.
+*/
+template <
+  class A_type, class x_type, class b_type, class y_type,
+  class alpha_t, class beta_t
+  >
+std::enable_if_t<
+  ::pressio::Traits<A_type>::rank == 2 and
+  ::pressio::Traits<x_type>::rank == 1 and
+  ::pressio::Traits<b_type>::rank == 1 and
+  ::pressio::Traits<y_type>::rank == 1 and
+  // TPL/container specific
+  (::pressio::is_native_container_kokkos<A_type>::value or
+   ::pressio::is_expression_acting_on_kokkos<A_type>::value) and
+  (::pressio::is_native_container_kokkos<x_type>::value or
+   ::pressio::is_expression_acting_on_kokkos<x_type>::value) and
+  (::pressio::is_native_container_kokkos<b_type>::value or
+   ::pressio::is_expression_acting_on_kokkos<b_type>::value) and
+  (::pressio::is_native_container_kokkos<y_type>::value or
+   ::pressio::is_expression_acting_on_kokkos<y_type>::value) and
+  // scalar compatibility
+  ::pressio::all_have_traits_and_same_scalar<A_type, x_type, b_type, y_type>::value and
+  std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value and
+  std::is_convertible<beta_t, typename ::pressio::Traits<A_type>::scalar_type>::value and
+  (std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value or
+   std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value)
+  >
+product_with_offset(::pressio::nontranspose /*unused*/,
+		    const alpha_t alpha,
+		    const A_type & A,
+		    const x_type & x,
+		    const beta_t beta,
+		    const b_type & b,
+		    y_type & y)
+{
+  assert( ::pressio::ops::extent(y, 0) == ::pressio::ops::extent(A, 0) );
+  assert( ::pressio::ops::extent(b, 0) == ::pressio::ops::extent(A, 0) );
+  assert( ::pressio::ops::extent(x, 0) == ::pressio::ops::extent(A, 1) );
+
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  auto y_n = impl::get_native(y);
+  const auto A_n = impl::get_native(A);
+  const auto x_n = impl::get_native(x);
+  const auto b_n = impl::get_native(b);
+  using exe_space = typename decltype(y_n)::execution_space;
+  impl::product_with_offset_kernel<exe_space>(sc_t(alpha), A_n, x_n, sc_t(beta), b_n, y_n);
+}
+
+}}//end namespace pressio::ops
+#endif  // OPS_KOKKOS_OPS_PRODUCT_WITH_OFFSET_HPP_
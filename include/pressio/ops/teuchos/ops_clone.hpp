@@ -56,6 +56,7 @@ std::enable_if_t<
   ::pressio::is_dense_vector_teuchos<T>::value, T>
 clone(const T & clonable)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(Clone);
   return T(Teuchos::Copy, clonable);
 }
 
@@ -59,6 +59,7 @@ std::enable_if_t<
   >
 deep_copy(T & dest, const T & src)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(DeepCopy);
   assert((matching_extents<T, T>::compare(dest, src)));
   dest.assign(src);
 }
@@ -51,6 +51,123 @@
 
 namespace pressio{ namespace ops{
 
+namespace impl{
+
+/*
+  The level-3 products below compute a small dense C by viewing it as
+  a multivector over a locally replicated map. Constructing that map is
+  collective and allocates, and these products are called several times
+  per nonlinear iteration, so we keep the maps (and the multivector that
+  wraps the last C seen for each map) alive across calls.
+  Entries are keyed on (comm, number of rows, index base). All ranks
+  issue the same sequence of products, so the cache evolves identically
+  on every rank and a miss (hence the collective map construction)
+  happens on all ranks together.
+  The cache is emptied when Kokkos is finalized.
+*/
+template <class mv_type>
+class LocallyReplicatedProductCache
+{
+  using map_type  = typename mv_type::map_type;
+  using go_type   = typename map_type::global_ordinal_type;
+  using comm_type = Teuchos::Comm<int>;
+
+  struct Entry{
+    Teuchos::RCP<const comm_type> comm;
+    Tpetra::global_size_t numRows;
+    go_type indexBase;
+    Teuchos::RCP<const map_type> map;
+    // wrapper of the last C used with this map
+    Teuchos::RCP<mv_type> wrapper;
+    const void * wrappedData = nullptr;
+    std::size_t wrappedCols = 0;
+  };
+
+  static constexpr std::size_t maxEntries_ = 8;
+  std::vector<Entry> entries_;
+  bool finalizeHookRegistered_ = false;
+
+public:
+  static LocallyReplicatedProductCache & instance(){
+    static LocallyReplicatedProductCache cache;
+    return cache;
+  }
+
+  /* returns a multivector over a locally replicated map viewing C,
+     C must be a LayoutLeft rank-2 kokkos view which stays alive for
+     as long as the returned multivector is used */
+  template <class view_type>
+  mv_type & wrap(const view_type & C, const map_type & distributedMap)
+  {
+    Entry & e = findOrCreate(C.extent(0), distributedMap);
+    if (e.wrapper.is_null()
+	|| e.wrappedData != static_cast<const void*>(C.data())
+	|| e.wrappedCols != std::size_t(C.extent(1)))
+    {
+      e.wrapper = Teuchos::rcp(new mv_type(e.map, C));
+      e.wrappedData = C.data();
+      e.wrappedCols = C.extent(1);
+    }
+    return *e.wrapper;
+  }
+
+private:
+  Entry & findOrCreate(std::size_t numRows, const map_type & distributedMap)
+  {
+    const auto comm = distributedMap.getComm();
+    const auto indexBase = distributedMap.getIndexBase();
+    for (auto & e : entries_){
+      if (e.comm.get() == comm.get()
+	  && e.numRows == Tpetra::global_size_t(numRows)
+	  && e.indexBase == indexBase){
+	return e;
+      }
+    }
+
+    if (!finalizeHookRegistered_){
+      // maps and wrappers hold kokkos views, release them before kokkos goes away
+      Kokkos::push_finalize_hook([](){
+	auto & cache = LocallyReplicatedProductCache::instance();
+	cache.entries_.clear();
+	cache.finalizeHookRegistered_ = false;
+      });
+      finalizeHookRegistered_ = true;
+    }
+
+    if (entries_.size() == maxEntries_){
+      entries_.erase(entries_.begin());
+    }
+    Entry e;
+    e.comm = comm;
+    e.numRows = numRows;
+    e.indexBase = indexBase;
+    e.map = Teuchos::rcp(new map_type(numRows, indexBase, comm,
+				      Tpetra::LocallyReplicated));
+    entries_.push_back(e);
+    return entries_.back();
+  }
+};
+
+// the cached wrappers must not extend the lifetime of a kokkos C
+template <class view_type>
+auto unmanaged_view_of(const view_type & C)
+{
+  using unmanaged_t = Kokkos::View<
+    typename view_type::data_type, Kokkos::LayoutLeft,
+    typename view_type::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  return unmanaged_t(C.data(), C.extent(0), C.extent(1));
+}
+
+template <class mv_type, class view_type>
+mv_type & locally_replicated_multivector_view(const view_type & C,
+					      const mv_type & distributed)
+{
+  auto & cache = LocallyReplicatedProductCache<mv_type>::instance();
+  return cache.wrap(C, *distributed.getMap());
+}
+
+}//end namespace impl
+
 /* -------------------------------------------------------------------
 C = beta * C + alpha * A^T * B
 
@@ -104,12 +221,7 @@ product(::pressio::transpose /*unused*/,
   const C_sc_t alpha_(alpha);
   const C_sc_t beta_(beta);
 
-  using map_t = typename A_type::map_type;
-  const auto indexBase = A.getMap()->getIndexBase();
-  const auto comm = A.getMap()->getComm();
-  Teuchos::RCP<const map_t> replMap(new map_t(Cview.extent(0), indexBase,
-					      comm, Tpetra::LocallyReplicated));
-  A_type Cmv(replMap, Cview);
+  auto & Cmv = impl::locally_replicated_multivector_view(Cview, A);
   Cmv.multiply(Teuchos::ETransp::TRANS, Teuchos::ETransp::NO_TRANS, alpha_, A, B, beta_);
 
 
@@ -300,17 +412,10 @@ product(::pressio::transpose /*unused*/,
   assert( (std::size_t)::pressio::ops::extent(C, 0) == (std::size_t) A.getNumVectors() );
   assert( (std::size_t)::pressio::ops::extent(C, 1) == (std::size_t) A.getNumVectors() );
 
-  using map_t      = typename A_type::map_type;
-  // using tpetra_mv_t = typename ::pressio::Traits<A_type>::wrapped_type;
-  const auto indexBase = A.getMap()->getIndexBase();
-  const auto comm = A.getMap()->getComm();
-
   // C should be square matrix
   assert(C.extent(0) == C.extent(1));
-  const auto n = C.extent(0);
-  Teuchos::RCP<const map_t> replMap(new map_t(n, indexBase, comm, Tpetra::LocallyReplicated));
-  // create multivector that views the Kokkos matrix
-  A_type Cmv(replMap, C);
+  // multivector that views the Kokkos matrix
+  auto & Cmv = impl::locally_replicated_multivector_view(impl::unmanaged_view_of(C), A);
 
   // do the operation
   using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
@@ -393,14 +498,8 @@ product(::pressio::transpose /*unused*/,
   assert( (std::size_t)::pressio::ops::extent(C, 0) == (std::size_t) A.getNumVectors() );
   assert( (std::size_t)::pressio::ops::extent(C, 1) == (std::size_t) B.getNumVectors() );
 
-  using map_t = typename A_type::map_type;
-  const auto indexBase = A.getMap()->getIndexBase();
-  const auto comm = A.getMap()->getComm();
-
-  const auto n = C.extent(0);
-  Teuchos::RCP<const map_t> replMap(new map_t(n, indexBase, comm, Tpetra::LocallyReplicated));
-  // create multivector that views the Kokkos matrix
-  A_type Cmv(replMap, C);
+  // multivector that views the Kokkos matrix
+  auto & Cmv = impl::locally_replicated_multivector_view(impl::unmanaged_view_of(C), A);
 
   // do the operation
   using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
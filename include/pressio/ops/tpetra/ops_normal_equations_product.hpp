@@ -0,0 +1,139 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_normal_equations_product.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_TPETRA_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
+#define OPS_TPETRA_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
+
+#include <Teuchos_CommHelpers.hpp>
+
+namespace pressio{ namespace ops{
+
+/* -------------------------------------------------------------------
+H = beta * H + alpha * A^T * A
+g = beta * g + alpha * A^T * b
+
+A = tpetra multivector
+b = tpetra vector
+H = Eigen dense matrix
+g = Eigen vector
+
+Each rank computes its local contributions with the single-pass kernel
+of the kokkos version on the device views of A and b, which accumulates
+the upper triangle of H and g into one packed buffer, so that a single
+reduction of n(n+1)/2 + n values is done rather than one per product.
+Only the packed buffer is copied to the host.
+*-------------------------------------------------------------------*/
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+template <class A_type, class b_type, class H_type, class g_type, class alpha_t, class beta_t>
+std::enable_if_t<
+     ::pressio::Traits<A_type>::rank == 2
+  && ::pressio::Traits<b_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_multi_vector_tpetra<A_type>::value
+  && ::pressio::is_vector_tpetra<b_type>::value
+  && ::pressio::is_dense_matrix_eigen<H_type>::value
+  && ::pressio::is_vector_eigen<g_type>::value
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<A_type, b_type, H_type, g_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<beta_t,  typename ::pressio::Traits<A_type>::scalar_type>::value
+  >
+normal_equations_product(const alpha_t & alpha,
+			 const A_type & A,
+			 const b_type & b,
+			 const beta_t & beta,
+			 H_type & H,
+			 g_type & g)
+{
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+  const sc_t alpha_(alpha);
+  const sc_t beta_(beta);
+
+  const auto n = static_cast<std::size_t>(A.getNumVectors());
+  assert( (std::size_t)::pressio::ops::extent(H, 0) == n );
+  assert( (std::size_t)::pressio::ops::extent(H, 1) == n );
+  assert( (std::size_t)::pressio::ops::extent(g, 0) == n );
+
+  using device_t = typename A_type::device_type;
+  auto & buffers = impl::NormalEquationsProductBuffers<sc_t, device_t>::instance();
+  buffers.resize(n);
+
+  const auto A_d = A.getLocalViewDevice(Tpetra::Access::ReadOnly);
+  const auto b_d = Kokkos::subview(b.getLocalViewDevice(Tpetra::Access::ReadOnly), Kokkos::ALL(), 0);
+  impl::normal_equations_packed_product(A_d, b_d, buffers.packed_);
+  Kokkos::deep_copy(buffers.packedHost_, buffers.packed_);
+
+  const auto comm = A.getMap()->getComm();
+  const auto bufferSize = static_cast<int>(buffers.global_.extent(0));
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, bufferSize,
+		     buffers.packedHost_.data(), buffers.global_.data());
+
+  const auto & packed = buffers.global_;
+  std::size_t pos = 0;
+  for (std::size_t k = 0; k < n; ++k){
+    for (std::size_t j = 0; j <= k; ++j){
+      const sc_t v = alpha_*packed(pos++);
+      H(j,k) = (beta_ == zero) ? v : beta_*H(j,k) + v;
+      if (j != k){
+	H(k,j) = (beta_ == zero) ? v : beta_*H(k,j) + v;
+      }
+    }
+  }
+  for (std::size_t j = 0; j < n; ++j){
+    const sc_t v = alpha_*packed(pos++);
+    g(j) = (beta_ == zero) ? v : beta_*g(j) + v;
+  }
+}
+#endif
+
+}}//end namespace pressio::ops
+#endif  // OPS_TPETRA_OPS_NORMAL_EQUATIONS_PRODUCT_HPP_
@@ -0,0 +1,166 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_product_with_offset.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_TPETRA_OPS_PRODUCT_WITH_OFFSET_HPP_
+#define OPS_TPETRA_OPS_PRODUCT_WITH_OFFSET_HPP_
+
+namespace pressio{ namespace ops{
+
+/*
+  y = alpha * A * x + beta * b
+
+  A = tpetra::MultiVector (e.g. a basis), x is a replicated vector,
+  b and y are tpetra vectors (or column expressions) with the map of A.
+  Purely local: each process runs the single-sweep kernel on its rows.
+  y and b must not alias.
+*/
+
+// x is Kokkos Vector: use device views
+template <
+  class A_type, class x_type, class b_type, class y_type,
+  class alpha_t, class beta_t
+  >
+std::enable_if_t<
+     ::pressio::Traits<A_type>::rank == 2
+  && ::pressio::Traits<x_type>::rank == 1
+  && ::pressio::Traits<b_type>::rank == 1
+  && ::pressio::Traits<y_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_multi_vector_tpetra<A_type>::value
+  && ::pressio::is_vector_kokkos<x_type>::value
+  && (::pressio::is_vector_tpetra<b_type>::value
+   || ::pressio::is_expression_column_acting_on_tpetra<b_type>::value)
+  && (::pressio::is_vector_tpetra<y_type>::value
+   || ::pressio::is_expression_column_acting_on_tpetra<y_type>::value)
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<A_type, x_type, b_type, y_type>::value
+  && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<beta_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && (std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value)
+  >
+product_with_offset(::pressio::nontranspose /*unused*/,
+		    const alpha_t & alpha,
+		    const A_type & A,
+		    const x_type & x,
+		    const beta_t & beta,
+		    const b_type & bin,
+		    y_type & yin)
+{
+  assert(size_t(A.getNumVectors()) == size_t(::pressio::ops::extent(x, 0)));
+
+  auto y = impl::get_native(yin);
+  const auto b = impl::get_native(bin);
+  const auto A_d = A.getLocalViewDevice(Tpetra::Access::ReadOnly);
+  const auto b_d = Kokkos::subview(b.getLocalViewDevice(Tpetra::Access::ReadOnly), Kokkos::ALL(), 0);
+  const auto y_d = Kokkos::subview(y.getLocalViewDevice(Tpetra::Access::OverwriteAll), Kokkos::ALL(), 0);
+  assert(y_d.extent(0) == A_d.extent(0));
+  assert(b_d.extent(0) == A_d.extent(0));
+
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  using exe_space = typename decltype(y_d)::execution_space;
+  impl::product_with_offset_kernel<exe_space>(sc_t(alpha), A_d, x, sc_t(beta), b_d, y_d);
+}
+
+// x is Eigen Vector: use host views
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+template <
+  class A_type, class x_type, class b_type, class y_type,
+  class alpha_t, class beta_t
+  >
+std::enable_if_t<
+     ::pressio::Traits<A_type>::rank == 2
+  && ::pressio::Traits<x_type>::rank == 1
+  && ::pressio::Traits<b_type>::rank == 1
+  && ::pressio::Traits<y_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_multi_vector_tpetra<A_type>::value
+  && ::pressio::is_vector_eigen<x_type>::value
+  && (::pressio::is_vector_tpetra<b_type>::value
+   || ::pressio::is_expression_column_acting_on_tpetra<b_type>::value)
+  && (::pressio::is_vector_tpetra<y_type>::value
+   || ::pressio::is_expression_column_acting_on_tpetra<y_type>::value)
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<A_type, x_type, b_type, y_type>::value
+  && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<beta_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && (std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value)
+  >
+product_with_offset(::pressio::nontranspose /*unused*/,
+		    const alpha_t & alpha,
+		    const A_type & A,
+		    const x_type & x,
+		    const beta_t & beta,
+		    const b_type & bin,
+		    y_type & yin)
+{
+  assert(size_t(A.getNumVectors()) == size_t(::pressio::ops::extent(x, 0)));
+  //makesure x is contiguous
+  assert(x.innerSize() == x.outerStride());
+
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  using x_view_t = Kokkos::View<const sc_t*, Kokkos::HostSpace,
+				Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  x_view_t x_h(x.data(), ::pressio::ops::extent(x, 0));
+
+  auto y = impl::get_native(yin);
+  const auto b = impl::get_native(bin);
+  const auto A_h = A.getLocalViewHost(Tpetra::Access::ReadOnly);
+  const auto b_h = Kokkos::subview(b.getLocalViewHost(Tpetra::Access::ReadOnly), Kokkos::ALL(), 0);
+  const auto y_h = Kokkos::subview(y.getLocalViewHost(Tpetra::Access::OverwriteAll), Kokkos::ALL(), 0);
+  assert(y_h.extent(0) == A_h.extent(0));
+  assert(b_h.extent(0) == A_h.extent(0));
+
+  impl::product_with_offset_kernel<Kokkos::DefaultHostExecutionSpace>
+    (sc_t(alpha), A_h, x_h, sc_t(beta), b_h, y_h);
+}
+#endif
+
+}}//end namespace pressio::ops
+#endif  // OPS_TPETRA_OPS_PRODUCT_WITH_OFFSET_HPP_
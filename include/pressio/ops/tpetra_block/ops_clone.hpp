@@ -57,6 +57,7 @@ std::enable_if_t<
   || ::pressio::is_multi_vector_tpetra_block<T>::value), T>
 clone(const T & clonable)
 {
+  PRESSIO_INSTRUMENTATION_RECORD(Clone);
  return T(clonable, Teuchos::Copy);
 }
 
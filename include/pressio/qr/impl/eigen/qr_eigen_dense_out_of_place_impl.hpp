@@ -53,6 +53,14 @@
 
 namespace pressio{ namespace qr{ namespace impl{
 
+/*
+  The factorizer is kept across calls and refactored in place.
+  Q is not formed by computeThinOutOfPlace: Q^T is applied through
+  the Householder reflectors stored in the factorization, and the
+  explicit thin Q is only formed the first time QFactor() is called
+  after a factorization. So users that only need Q^T v (e.g. the QR
+  based Gauss-Newton) never pay for forming and storing Q.
+*/
 template< typename MatrixType, typename R_t>
 class QRHouseholderDenseEigenMatrix<
   MatrixType, R_t,
@@ -67,8 +75,13 @@ public:
   using factorizer_t = Eigen::HouseholderQR<MatrixType>;
 
 private:
-  mutable std::shared_ptr<Q_type> Qmat_	     = {};
-  mutable std::shared_ptr<factorizer_t> fct_ = {};
+  using work_vec_t = Eigen::Matrix<sc_t, Eigen::Dynamic, 1>;
+
+  factorizer_t fct_ = {};
+  // explicit Q, formed on demand
+  mutable Q_type Qmat_ = {};
+  mutable bool QIsFormed_ = false;
+  mutable work_vec_t work_ = {};
 
 public:
   QRHouseholderDenseEigenMatrix() = default;
@@ -76,24 +89,25 @@ public:
 
   void computeThinOutOfPlace(const MatrixType & A)
   {
-    const auto rows = A.rows();
-    const auto cols = A.cols();
-    fct_ = std::make_shared<factorizer_t>(A);
-
-    if (!Qmat_ or (Qmat_->rows()!=rows and Qmat_->cols()!=cols)){
-      Qmat_ = std::make_shared<Q_type>(rows,cols);
-      Qmat_->setZero();
-    }
-
-    *Qmat_ = fct_->householderQ() * Q_type::Identity(rows,cols);
+    fct_.compute(A);
+    QIsFormed_ = false;
   }
 
   template < typename VectorInType, typename VectorOutType>
   void applyQTranspose(const VectorInType & vecIn, VectorOutType & vecOut) const
   {
-    constexpr auto beta  = ::pressio::utils::Constants<sc_t>::zero();
-    constexpr auto alpha = ::pressio::utils::Constants<sc_t>::one();
-    ::pressio::ops::product(::pressio::transpose(), alpha, *this->Qmat_, vecIn, beta, vecOut);
+    if (QIsFormed_){
+      // Q is around anyway, a gemv is cheaper than applying the reflectors
+      constexpr auto beta  = ::pressio::utils::Constants<sc_t>::zero();
+      constexpr auto alpha = ::pressio::utils::Constants<sc_t>::one();
+      ::pressio::ops::product(::pressio::transpose(), alpha, Qmat_, vecIn, beta, vecOut);
+      return;
+    }
+
+    // the first cols entries of Q_full^T vecIn are (thin Q)^T vecIn
+    work_ = vecIn;
+    work_.applyOnTheLeft(fct_.householderQ().adjoint());
+    vecOut = work_.head(::pressio::ops::extent(vecOut, 0));
   }
 
   template < typename VectorInType, typename VectorOutType>
@@ -101,7 +115,7 @@ public:
   {
     // y = R^T vecIn
     auto vecSize = ::pressio::ops::extent(y, 0);
-    auto & Rm = fct_->matrixQR().block(0,0,vecSize,vecSize).template triangularView<Eigen::Upper>();
+    auto & Rm = fct_.matrixQR().block(0,0,vecSize,vecSize).template triangularView<Eigen::Upper>();
     y = Rm.transpose() * vecIn;
   }
 
@@ -109,13 +123,25 @@ public:
   void doLinSolve(const VectorType & rhs, VectorType & y)const
   {
     auto vecSize = ::pressio::ops::extent(y, 0);
-    auto & Rm = fct_->matrixQR().block(0,0,vecSize,vecSize).
+    auto & Rm = fct_.matrixQR().block(0,0,vecSize,vecSize).
       template triangularView<Eigen::Upper>();
     y = Rm.solve(rhs);
   }
 
   const Q_type & QFactor() const {
-    return *this->Qmat_;
+    if (!QIsFormed_){
+      const auto & QR = fct_.matrixQR();
+      Qmat_.setIdentity(QR.rows(), QR.cols());
+      Qmat_.applyOnTheLeft(fct_.householderQ());
+      QIsFormed_ = true;
+    }
+    return Qmat_;
+  }
+
+  // upper triangular view of the min(rows, cols) x cols R factor
+  auto RFactor() const {
+    const auto & QR = fct_.matrixQR();
+    return QR.topRows(std::min(QR.rows(), QR.cols())).template triangularView<Eigen::Upper>();
   }
 };
 
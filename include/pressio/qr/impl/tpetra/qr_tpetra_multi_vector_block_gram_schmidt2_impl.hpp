@@ -0,0 +1,297 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// qr_tpetra_multi_vector_block_gram_schmidt2_impl.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef QR_IMPL_TPETRA_QR_TPETRA_MULTI_VECTOR_BLOCK_GRAM_SCHMIDT2_IMPL_HPP_
+#define QR_IMPL_TPETRA_QR_TPETRA_MULTI_VECTOR_BLOCK_GRAM_SCHMIDT2_IMPL_HPP_
+
+#include <Teuchos_CommHelpers.hpp>
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosBlas3_gemm.hpp"
+#include "KokkosBlas3_trsm.hpp"
+
+namespace pressio{ namespace qr{ namespace impl{
+
+/*
+  Classical Gram-Schmidt with reorthogonalization, done on blocks
+  of BlockSize columns (BCGS2). BlockSize == 1 is plain CGS2.
+
+  For each block W of columns of A, with Q0 the columns of Q already
+  computed, we do two passes of
+      S = Q0^T W,  W = W - Q0 S,  [W, T] = qr(W)
+  where the intra-block qr is a Cholesky QR, T = chol(W^T W).
+  For BlockSize == 1, the first normalization is skipped and
+  the second one is just the norm of the column.
+
+  Each product Q0^T W (and W^T W) is computed on the local rows
+  and summed over the ranks with a single reduction, so we do O(1)
+  reductions per block rather than the O(k) per column of modified
+  Gram-Schmidt, and the updates are local matrix-matrix products.
+
+  All the products with the local rows of Q are done with KokkosBlas
+  on the device views: only the small reduced blocks (at most n x BlockSize)
+  go through the host, where the b x b Cholesky is done.
+
+  If the Cholesky factorization of a block fails (the block is
+  numerically rank deficient), that block falls back to CGS2.
+*/
+template<typename MatrixType, typename R_t, int BlockSize>
+class BlockGramSchmidt2MVTpetra
+{
+  static_assert(BlockSize >= 1, "The block size must be positive");
+
+public:
+  using int_t	     = int;
+  using sc_t        = typename ::pressio::Traits<MatrixType>::scalar_type;
+  using lo_t        = typename MatrixType::local_ordinal_type;
+  using go_t        = typename MatrixType::global_ordinal_type;
+  using node_t      = typename MatrixType::node_type;
+  using Q_type      = Tpetra::MultiVector<sc_t, lo_t, go_t, node_t>;
+  using R_nat_t	    = Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+private:
+  using comm_t        = Teuchos::Comm<int>;
+  using device_t      = typename Q_type::device_type;
+  using unmanaged_t   = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  // small blocks, stored contiguously so they can be reduced in one call
+  using dev_block_t   = Kokkos::View<sc_t**, Kokkos::LayoutLeft, device_t, unmanaged_t>;
+  using host_block_t  = Kokkos::View<sc_t**, Kokkos::LayoutLeft, Kokkos::HostSpace, unmanaged_t>;
+  using dev_buffer_t  = Kokkos::View<sc_t*, device_t>;
+  using host_buffer_t = Kokkos::View<sc_t*, Kokkos::HostSpace>;
+  using host_map_t    = Eigen::Map<R_nat_t>;
+
+public:
+  BlockGramSchmidt2MVTpetra() = default;
+  ~BlockGramSchmidt2MVTpetra() = default;
+
+  void computeThinOutOfPlace(const MatrixType & A)
+  {
+    const std::size_t nVecs = ::pressio::ops::extent(A,1);
+    createQIfNeeded(A.getMap(), nVecs);
+    createLocalRIfNeeded(nVecs);
+    createBuffersIfNeeded(nVecs);
+    comm_ = A.getMap()->getComm();
+
+    const auto A_d = A.getLocalViewDevice(Tpetra::Access::ReadOnly);
+    const auto Q_d = Qmat_->getLocalViewDevice(Tpetra::Access::OverwriteAll);
+    const auto n = static_cast<std::size_t>(nVecs);
+
+    for (std::size_t c0=0; c0<n; c0+=BlockSize)
+    {
+      const auto b = std::min<std::size_t>(BlockSize, n-c0);
+      const auto cols = std::make_pair(c0, c0+b);
+      const auto Ablock = Kokkos::subview(A_d, Kokkos::ALL(), cols);
+      const auto W = Kokkos::subview(Q_d, Kokkos::ALL(), cols);
+      Kokkos::deep_copy(W, Ablock);
+      if (b > 1){
+	if (orthogonalizeBlock(Q_d, c0, b)){ continue; }
+	// the block was modified, start over column by column
+	Kokkos::deep_copy(W, Ablock);
+      }
+
+      for (std::size_t k=c0; k<c0+b; ++k){
+	orthogonalizeBlock(Q_d, k, 1);
+      }
+    }
+  }
+
+  template <typename VectorType>
+  void doLinSolve(const VectorType & rhs, VectorType & y)const {
+    auto & Rm = localR_.template triangularView<Eigen::Upper>();
+    y = Rm.solve(rhs);
+  }
+
+  template < typename VectorInType, typename VectorOutType>
+  void applyQTranspose(const VectorInType & vecIn, VectorOutType & vecOut) const
+  {
+    constexpr auto beta  = ::pressio::utils::Constants<sc_t>::zero();
+    constexpr auto alpha = ::pressio::utils::Constants<sc_t>::one();
+    ::pressio::ops::product(::pressio::transpose(), alpha, *this->Qmat_, vecIn, beta, vecOut);
+  }
+
+  const Q_type & QFactor() const {
+    return *this->Qmat_;
+  }
+
+private:
+  // X^T Y on the local rows, summed over all ranks with one reduction:
+  // the result is in the returned device block and in globalHost_
+  template <typename XType, typename YType>
+  dev_block_t sumOverRanksOfTransposeProduct(const XType & X, const YType & Y)
+  {
+    constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<sc_t>::one();
+    const auto rows = X.extent(1);
+    const auto cols = Y.extent(1);
+
+    const dev_block_t local_d(localWork_d_.data(), rows, cols);
+    const host_block_t local_h(localWork_h_.data(), rows, cols);
+    const dev_block_t global_d(globalWork_d_.data(), rows, cols);
+    const host_block_t global_h(globalWork_h_.data(), rows, cols);
+
+    const char ctA = 'T';
+    const char ctB = 'N';
+    ::KokkosBlas::gemm(&ctA, &ctB, one, X, Y, zero, local_d);
+    Kokkos::deep_copy(local_h, local_d);
+    Teuchos::reduceAll(*comm_, Teuchos::REDUCE_SUM,
+		       static_cast<int>(rows*cols),
+		       local_h.data(), global_h.data());
+    Kokkos::deep_copy(global_d, global_h);
+    return global_d;
+  }
+
+  host_map_t globalOnHost(std::size_t rows, std::size_t cols){
+    return host_map_t(globalWork_h_.data(), rows, cols);
+  }
+
+  // BCGS2 on columns [c0, c0+b) of Q against columns [0, c0),
+  // returns false if the Cholesky QR of the block fails.
+  // For b == 1 this is CGS2 on column c0.
+  template <typename QViewType>
+  bool orthogonalizeBlock(const QViewType & Q, std::size_t c0, std::size_t b)
+  {
+    constexpr auto one = ::pressio::utils::Constants<sc_t>::one();
+    const auto Q0 = Kokkos::subview(Q, Kokkos::ALL(), std::make_pair(std::size_t(0), c0));
+    const auto W = Kokkos::subview(Q, Kokkos::ALL(), std::make_pair(c0, c0+b));
+    const auto c0E = static_cast<Eigen::Index>(c0);
+    const auto bE = static_cast<Eigen::Index>(b);
+
+    // before each pass we have: A(:, block) = Q0 S + W T
+    S_.setZero(c0E, bE);
+    T_.setIdentity(bE, bE);
+    for (int pass=0; pass<2; ++pass)
+    {
+      if (c0 > 0){
+	// W = W - Q0 S
+	const auto Sp_d = sumOverRanksOfTransposeProduct(Q0, W);
+	const char ct = 'N';
+	::KokkosBlas::gemm(&ct, &ct, -one, Q0, Sp_d, one, W);
+	S_.noalias() += globalOnHost(c0, b) * T_;
+      }
+
+      // for a single column, the first normalization is not needed
+      if (b == 1 && pass == 0){ continue; }
+
+      sumOverRanksOfTransposeProduct(W, W);
+      if (b == 1){
+	const sc_t norm = std::sqrt(globalOnHost(1, 1)(0,0));
+	T_(0,0) = norm;
+	::KokkosBlas::scal(W, one/norm, W);
+	continue;
+      }
+
+      cholesky_.compute(globalOnHost(b, b));
+      if (cholesky_.info() != Eigen::Success){
+	return false;
+      }
+      const R_nat_t Tp = cholesky_.matrixU();
+      T_ = Tp * T_;
+
+      // W = W Tp^{-1}, with Tp copied to the device
+      const host_block_t Tp_h(triangular_h_.data(), b, b);
+      const dev_block_t Tp_d(triangular_d_.data(), b, b);
+      host_map_t(Tp_h.data(), bE, bE) = Tp;
+      Kokkos::deep_copy(Tp_d, Tp_h);
+      ::KokkosBlas::trsm("R", "U", "N", "N", one, Tp_d, W);
+    }
+
+    localR_.block(0, c0E, c0E, bE) = S_;
+    localR_.block(c0E, c0E, bE, bE) = T_.template triangularView<Eigen::Upper>();
+    return true;
+  }
+
+  void createLocalRIfNeeded(std::size_t newsize){
+    const std::size_t locRext0 = ::pressio::ops::extent(localR_, 0);
+    const std::size_t locRext1 = ::pressio::ops::extent(localR_, 1);
+    if (locRext0!=newsize or locRext1!=newsize){
+      localR_ = R_nat_t(newsize, newsize);
+      ::pressio::ops::set_zero(localR_);
+    }
+  }
+
+  // the reduced blocks are at most n x BlockSize
+  void createBuffersIfNeeded(std::size_t nVecs){
+    const std::size_t size = nVecs * std::min<std::size_t>(BlockSize, nVecs);
+    if (localWork_d_.extent(0) != size){
+      localWork_d_  = dev_buffer_t("bcgs2LocalWork", size);
+      globalWork_d_ = dev_buffer_t("bcgs2GlobalWork", size);
+      localWork_h_  = host_buffer_t("bcgs2LocalWorkHost", size);
+      globalWork_h_ = host_buffer_t("bcgs2GlobalWorkHost", size);
+    }
+    const std::size_t b = std::min<std::size_t>(BlockSize, nVecs);
+    if (triangular_d_.extent(0) != b*b){
+      triangular_d_ = dev_buffer_t("bcgs2Triangular", b*b);
+      triangular_h_ = host_buffer_t("bcgs2TriangularHost", b*b);
+    }
+  }
+
+  template <typename MapType>
+  void createQIfNeeded(const MapType & map, std::size_t cols){
+    if (!Qmat_ or !Qmat_->getMap()->isSameAs(*map) or Qmat_->getNumVectors() != cols)
+      Qmat_ = std::make_shared<Q_type>(map, cols);
+  }
+
+private:
+  R_nat_t localR_ = {};
+  Teuchos::RCP<const comm_t> comm_ = {};
+
+  // work space reused across blocks and calls
+  R_nat_t S_ = {};
+  R_nat_t T_ = {};
+  Eigen::LLT<R_nat_t, Eigen::Upper> cholesky_ = {};
+  dev_buffer_t localWork_d_ = {};
+  dev_buffer_t globalWork_d_ = {};
+  host_buffer_t localWork_h_ = {};
+  host_buffer_t globalWork_h_ = {};
+  dev_buffer_t triangular_d_ = {};
+  host_buffer_t triangular_h_ = {};
+
+  mutable std::shared_ptr<Q_type> Qmat_ = nullptr;
+};
+
+}}} // end namespace pressio::qr::impl
+#endif  // QR_IMPL_TPETRA_QR_TPETRA_MULTI_VECTOR_BLOCK_GRAM_SCHMIDT2_IMPL_HPP_
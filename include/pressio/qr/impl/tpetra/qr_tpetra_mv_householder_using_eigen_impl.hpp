@@ -49,13 +49,33 @@
 #ifndef QR_IMPL_TPETRA_QR_TPETRA_MV_HOUSEHOLDER_USING_EIGEN_IMPL_HPP_
 #define QR_IMPL_TPETRA_QR_TPETRA_MV_HOUSEHOLDER_USING_EIGEN_IMPL_HPP_
 
-#include <Eigen/OrderingMethods>
-#include <Eigen/SparseQR>
-#include <Tpetra_Map.hpp>
-#include <Tpetra_Vector.hpp>
+#include <Teuchos_CommHelpers.hpp>
 
 namespace pressio{ namespace qr{ namespace impl{
 
+/*
+  Householder QR of a distributed Tpetra::MultiVector A (M x n),
+  done TSQR-style so that no rank ever holds more than its own rows:
+
+  (1) each rank i factors its local rows, A_i = Q_i R_i, with the
+      Eigen Householder QR used for dense Eigen matrices;
+  (2) the R factors are combined over a binary tree of the ranks:
+      at each level a rank stacks its R with the one of its partner,
+      factors [R_a; R_b] = Q_ab R_ab and keeps Q_ab (2n x n),
+      so after log2(p) levels rank 0 has the R of A;
+  (3) going back down the tree, each rank gets the n x n block C_i
+      such that the thin Q of A restricted to its rows is Q_i C_i.
+      R is then broadcast to all ranks.
+
+  Only n x n blocks are communicated, log2(p) times.
+
+  All the factorizations run on the host: A and Q are accessed through
+  their host views, so for a device node Tpetra syncs A to the host and
+  marks Q as modified there. The shape of the tree only depends on the
+  rank and the number of ranks, so the tree nodes (and their Eigen
+  factorizers) are kept across calls and rebuilt only when the
+  communicator size or n changes.
+*/
 template<typename MatrixType, typename R_t>
 class TpetraMVHouseholderUsingEigen
 {
@@ -69,7 +89,18 @@ public:
 
   using eig_dyn_mat	= Eigen::Matrix<sc_t, -1, -1>;
   using help_impl_t	= QRHouseholderDenseEigenMatrix<eig_dyn_mat, R_t>;
-  help_impl_t myImpl_	= {};
+
+private:
+  using comm_t            = Teuchos::Comm<int>;
+  using stride_t          = Eigen::OuterStride<>;
+  using local_mat_t       = Eigen::Map<eig_dyn_mat, 0, stride_t>;
+  using const_local_mat_t = Eigen::Map<const eig_dyn_mat, 0, stride_t>;
+
+  // the QR done by this rank at one level of the tree
+  struct TreeNode{
+    int partner;
+    help_impl_t qr;
+  };
 
 public:
   TpetraMVHouseholderUsingEigen() = default;
@@ -83,72 +114,132 @@ public:
     ::pressio::ops::product(::pressio::transpose(), alpha, *this->Qmat_, vecIn, beta, vecOut);
   }
 
+  template < typename VectorInType, typename VectorOutType>
+  void applyRTranspose(const VectorInType & vecIn, VectorOutType & y) const
+  {
+    y = R_.template triangularView<Eigen::Upper>().transpose() * vecIn;
+  }
+
   template <typename VectorType>
   void doLinSolve(const VectorType & rhs, VectorType & y)const{
-    myImpl_.template doLinSolve<VectorType>(rhs, y);
+    y = R_.template triangularView<Eigen::Upper>().solve(rhs);
   }
 
   const Q_type & QFactor() const {
     return *this->Qmat_;
   }
 
-  void computeThinOutOfPlace(const MatrixType & Ain)
+  void computeThinOutOfPlace(const MatrixType & A)
+  {
+    const auto n = static_cast<Eigen::Index>(::pressio::ops::extent(A,1));
+    const auto commPtr = A.getMap()->getComm();
+    const auto & comm = *commPtr;
+    if (!Qmat_ or !Qmat_->getMap()->isSameAs(*A.getMap())
+	or static_cast<Eigen::Index>(Qmat_->getNumVectors()) != n){
+      Qmat_ = std::make_shared<Q_type>(A.getMap(), n);
+    }
+
+    // view the local rows of A and Q as Eigen objects
+    const auto A_h = A.getLocalViewHost(Tpetra::Access::ReadOnly);
+    auto Q_h = Qmat_->getLocalViewHost(Tpetra::Access::OverwriteAll);
+    const auto m = static_cast<Eigen::Index>(A_h.extent(0));
+    const const_local_mat_t Aloc
+      (A_h.data(), m, n, stride_t(std::max<Eigen::Index>(A_h.stride_1(), 1)));
+    local_mat_t Qloc
+      (Q_h.data(), m, n, stride_t(std::max<Eigen::Index>(Q_h.stride_1(), 1)));
+
+    // (1) local QR, R_ is zero padded if this rank has less than n rows
+    R_.setZero(n, n);
+    if (m > 0){
+      localQR_.computeThinOutOfPlace(eig_dyn_mat(Aloc));
+      const auto k = std::min(m, n);
+      R_.topRows(k) = localQR_.RFactor();
+    }
+
+    // (2) reduce the R factors up the tree
+    const int rank = comm.getRank();
+    const int numRanks = comm.getSize();
+    const auto count = static_cast<int>(n*n);
+    if (numRanks != treeNumRanks_ or rank != treeRank_ or n != treeN_){
+      buildTree(rank, numRanks, n);
+    }
+
+    for (auto & node : tree_){
+      stacked_.topRows(n) = R_;
+      Teuchos::receive(comm, node.partner, count, receiveBuffer_.data());
+      stacked_.bottomRows(n) = receiveBuffer_;
+      node.qr.computeThinOutOfPlace(stacked_);
+      R_ = node.qr.RFactor();
+    }
+    if (parent_ >= 0){
+      // send R to the rank that combines it and leave the tree
+      Teuchos::send(comm, count, R_.data(), parent_);
+    }
+
+    // (3) go back down the tree to get the coefficients C of the local Q
+    C_.resize(n, n);
+    if (rank == 0){
+      C_.setIdentity();
+    }
+    else{
+      Teuchos::receive(comm, parent_, count, C_.data());
+    }
+    for (auto it = tree_.rbegin(); it != tree_.rend(); ++it){
+      stacked_.noalias() = it->qr.QFactor() * C_;
+      receiveBuffer_ = stacked_.bottomRows(n);
+      Teuchos::send(comm, count, receiveBuffer_.data(), it->partner);
+      C_ = stacked_.topRows(n);
+    }
+
+    if (m > 0){
+      Qloc.noalias() = localQR_.QFactor() * C_;
+    }
+    Teuchos::broadcast(comm, 0, count, R_.data());
+  }
+
+private:
+  void buildTree(int rank, int numRanks, Eigen::Index n)
   {
-    auto & A = const_cast<MatrixType &>(Ain);
-
-    size_t rows = ::pressio::ops::extent(A,0);
-    size_t cols = ::pressio::ops::extent(A,1);
-    auto ArowMap = A.getMap();
-    Teuchos::RCP<const Teuchos::Comm<int> > comm =
-      Teuchos::rcp (new Teuchos::MpiComm<int> (MPI_COMM_SELF));
-
-    // convert it to replicated eptra matrix
-    using local_map_t = Tpetra::Map<lo_t, go_t, node_t>;
-    using rcp_local_map_t = Teuchos::RCP<const local_map_t>;
-    rcp_local_map_t rcp_local_map = Teuchos::rcp( new local_map_t(rows, 0, comm) );
-
-    using import_t = Tpetra::Import<lo_t, go_t, node_t>;
-    import_t importer(ArowMap, rcp_local_map);
-    MatrixType A2(rcp_local_map, cols);
-    A2.doImport(A, importer, Tpetra::INSERT);
-
-    // store it into an Eigen matrix
-    Eigen::Matrix<sc_t, -1, -1> eA2W(rows,cols);
-    for (size_t j=0;j<cols;j++)
-    {
-      auto colData = A2.getData(j);
-      for (size_t i=0;i<rows;i++){
-    	 eA2W(i,j) = colData[i];
+    // the levels where this rank combines its R with the one of a partner,
+    // until it sends its own R to its parent
+    std::vector<int> partners;
+    parent_ = -1;
+    for (int level = 1; level < numRanks; level *= 2){
+      if (rank % (2*level) != 0){
+	parent_ = rank - level;
+	break;
+      }
+      if (rank + level < numRanks){
+	partners.push_back(rank + level);
       }
     }
 
-    myImpl_.computeThinOutOfPlace(eA2W);
-
-    // store Q into replicated Tpetra::Multivector
-    const auto & Q2 = myImpl_.QFactor();
-    Q_type locQ( rcp_local_map, Q2.cols() );
-    // // auto trilD = locQ.data();
-    // locQ.template sync<Kokkos::HostSpace>();
-
-    auto v2d = locQ.template getLocalView<Kokkos::HostSpace>(Tpetra::Access::ReadWriteStruct());
-    auto c0 = Kokkos::subview(v2d, Kokkos::ALL(), 0);
-    // // //we are going to change the host view
-    // locQ.template modify<Kokkos::HostSpace>();
-    for (size_t i=0;i< (size_t)Q2.rows();i++)
-      for (size_t j=0;j< (size_t)Q2.cols();j++)
-    	v2d(i,j) = Q2(i,j);
-
-    // import from local to distributed
-    Qmat_ = std::make_shared<Q_type>(ArowMap, Q2.cols());
-    import_t importer2(rcp_local_map, ArowMap);
-    Qmat_->doImport(locQ, importer2, Tpetra::INSERT);
+    tree_.resize(partners.size());
+    for (std::size_t i = 0; i < partners.size(); ++i){
+      tree_[i].partner = partners[i];
+    }
+    stacked_.resize(2*n, n);
+    receiveBuffer_.resize(n, n);
+    treeNumRanks_ = numRanks;
+    treeRank_ = rank;
+    treeN_ = n;
   }
 
 private:
-  // todo: these must be moved somewhere else
-  mutable std::shared_ptr<Q_type> Qmat_	= nullptr;
-  mutable std::shared_ptr<R_t> Rmat_	= nullptr;
+  eig_dyn_mat R_ = {};
+  help_impl_t localQR_ = {};
+  std::vector<TreeNode> tree_ = {};
+  int parent_ = -1;
+  int treeNumRanks_ = -1;
+  int treeRank_ = -1;
+  Eigen::Index treeN_ = -1;
+
+  // work space
+  eig_dyn_mat C_ = {};
+  eig_dyn_mat stacked_ = {};
+  eig_dyn_mat receiveBuffer_ = {};
 
+  mutable std::shared_ptr<Q_type> Qmat_	= nullptr;
 };//end class
 
 }}} // end namespace pressio::qr::impl
@@ -60,6 +60,13 @@ struct Householder{};
 
 #if defined PRESSIO_ENABLE_TPL_TRILINOS
 struct TSQR{};
+
+// classical Gram-Schmidt with reorthogonalization (CGS2)
+struct ClassicalGramSchmidt2{};
+
+// CGS2 done on blocks of BlockSize columns (BCGS2)
+template<int BlockSize = 32>
+struct BlockClassicalGramSchmidt2{};
 #endif
 
 }} // end namespace pressio::qr
@@ -65,6 +65,7 @@ template<class matrix_t, class R_t> class TpetraMVHouseholderUsingEigen;
 
 template<class matrix_t, class R_t> class TpetraMVTSQR;
 template<class matrix_t, class R_t> class ModGramSchmidtMVTpetra;
+template<class matrix_t, class R_t, int BlockSize> class BlockGramSchmidt2MVTpetra;
 template<class matrix_t, class R_t> class TpetraBlockMVTSQR;
 #endif //PRESSIO_ENABLE_TPL_TRILINOS
 
@@ -88,5 +88,15 @@ struct is_legitimate_vector_type_for_qr_project<T, Q_t,
 	 >
       > : std::true_type{};
 
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+template <typename T>
+struct is_block_classical_gram_schmidt2 : std::false_type {};
+
+template <int BlockSize>
+struct is_block_classical_gram_schmidt2<
+  ::pressio::qr::BlockClassicalGramSchmidt2<BlockSize>
+  > : std::true_type {};
+#endif
+
 }}}//end namespace pressio::qr::meta
 #endif  // QR_QR_META_HPP_
@@ -134,6 +134,28 @@ struct impl_class_helper<
   using impl_t = qr::impl::ModGramSchmidtMVTpetra<matrix_t, R_t>;
 };
 
+template <class matrix_t, class R_t>
+struct impl_class_helper<
+  matrix_t, qr::ClassicalGramSchmidt2, R_t,
+  std::enable_if_t<
+    ::pressio::is_multi_vector_tpetra<matrix_t>::value
+    >
+  >
+{
+  using impl_t = qr::impl::BlockGramSchmidt2MVTpetra<matrix_t, R_t, 1>;
+};
+
+template <class matrix_t, int BlockSize, class R_t>
+struct impl_class_helper<
+  matrix_t, qr::BlockClassicalGramSchmidt2<BlockSize>, R_t,
+  std::enable_if_t<
+    ::pressio::is_multi_vector_tpetra<matrix_t>::value
+    >
+  >
+{
+  using impl_t = qr::impl::BlockGramSchmidt2MVTpetra<matrix_t, R_t, BlockSize>;
+};
+
 template <class matrix_t, class R_t>
 struct impl_class_helper<
   matrix_t, qr::Householder, R_t,
@@ -159,10 +181,13 @@ struct Traits<
   static_assert(
     std::is_same<algo_t, qr::ModifiedGramSchmidt>::value or
     std::is_same<algo_t, qr::Householder>::value or
-    std::is_same<algo_t, qr::TSQR>::value,
-    "Currently, only TSQR, ModifiedGramSchmidt and Householder are available for Tpetra dense matrices. \
-    Use TSQR because it is fast and accurate. ModifiedGramSchmidt and Householder \
-    are just here for testing purposes. ");
+    std::is_same<algo_t, qr::TSQR>::value or
+    std::is_same<algo_t, qr::ClassicalGramSchmidt2>::value or
+    qr::meta::is_block_classical_gram_schmidt2<algo_t>::value,
+    "Currently, only TSQR, ClassicalGramSchmidt2, BlockClassicalGramSchmidt2, ModifiedGramSchmidt \
+    and Householder are available for Tpetra dense matrices. Use TSQR because it is fast and accurate, \
+    or (Block)ClassicalGramSchmidt2 which needs far fewer reductions than ModifiedGramSchmidt. \
+    ModifiedGramSchmidt and Householder are just here for testing purposes. ");
 
   using traits_all_t  = qr_traits_shared_all<matrix_type, algo_t, in_place>;
   using typename traits_all_t::matrix_t;
@@ -2,7 +2,11 @@
 #ifndef ROM_CREATE_SUBSPACE_HPP_
 #define ROM_CREATE_SUBSPACE_HPP_
 
+#include <unordered_map>
+#include <vector>
+
 #include "./impl/linear_trial_column_subspace.hpp"
+#include "./impl/rows_of_operand.hpp"
 
 namespace pressio{ namespace rom{
 
@@ -43,5 +47,62 @@ auto create_trial_column_subspace(BasisMatrixType && basisMatrix,
 	       isAffine);
 }
 
+/*
+  Trial subspace restricted to a subset of the full mesh rows, e.g. the
+  stencil mesh of a hyper-reduced problem: basis and translation are the
+  rows of basisMatrix and offset identified by rowIndices.
+  A hyper-reduced problem built on this subspace reconstructs the fom
+  state only on those rows, so its cost scales with the stencil mesh
+  rather than with the full mesh.
+*/
+template<
+  class ReducedStateType,
+  class BasisMatrixType,
+  class FullStateType,
+  class RowIndicesType
+>
+#ifdef PRESSIO_ENABLE_CXX20
+requires ReducedState<ReducedStateType>
+&& VectorSubspace< LinearSubspace<mpl::remove_cvref_t<BasisMatrixType>> >
+#endif
+auto create_trial_column_subspace_on_rows(const BasisMatrixType & basisMatrix,
+					  const FullStateType & offset,
+					  bool isAffine,
+					  const RowIndicesType & rowIndices)
+{
+  return create_trial_column_subspace<ReducedStateType>
+    (impl::rows_of_operand(basisMatrix, rowIndices),
+     impl::rows_of_operand(offset, rowIndices),
+     isAffine);
+}
+
+/*
+  Given the (global) row indices of the sample mesh and of the stencil mesh,
+  returns for each sample mesh row its position within the stencil mesh rows.
+  These are the indices needed to combine stencil mesh operands (e.g. the
+  fom state or basis) with sample mesh operands (e.g. the fom residual).
+*/
+template<class RowIndicesType>
+auto sample_mesh_rows_within_stencil_mesh(const RowIndicesType & sampleMeshRows,
+					  const RowIndicesType & stencilMeshRows)
+{
+  using index_type = mpl::remove_cvref_t<decltype(stencilMeshRows[0])>;
+
+  std::unordered_map<index_type, index_type> stencilPosition;
+  for (std::size_t i=0; i<(std::size_t)stencilMeshRows.size(); ++i){
+    stencilPosition[stencilMeshRows[i]] = static_cast<index_type>(i);
+  }
+
+  std::vector<index_type> result(sampleMeshRows.size());
+  for (std::size_t i=0; i<(std::size_t)sampleMeshRows.size(); ++i){
+    const auto it = stencilPosition.find(sampleMeshRows[i]);
+    if (it == stencilPosition.end()){
+      throw std::runtime_error("sample mesh row not found in the stencil mesh rows");
+    }
+    result[i] = it->second;
+  }
+  return result;
+}
+
 }} // end pressio::rom
 #endif  // ROM_CREATE_SUBSPACE_HPP_
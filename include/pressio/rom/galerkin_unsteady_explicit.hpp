@@ -8,6 +8,7 @@
 #include "impl/galerkin_unsteady_system_default_rhs_only.hpp"
 #include "impl/galerkin_unsteady_system_hypred_rhs_only.hpp"
 #include "impl/galerkin_unsteady_system_default_rhs_with_mass_matrix.hpp"
+#include "impl/galerkin_unsteady_system_default_rhs_with_constant_mass_matrix.hpp"
 #include "impl/galerkin_unsteady_system_masked_rhs_only.hpp"
 
 namespace pressio{ namespace rom{ namespace galerkin{
@@ -29,6 +30,7 @@ template<
   PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
    && RealValuedSemiDiscreteFom<FomSystemType>::value
    && !RealValuedSemiDiscreteFomWithMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
+   && !RealValuedSemiDiscreteFomWithConstantMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
    && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
    , int> = 0
  >
@@ -61,6 +63,7 @@ auto create_unsteady_explicit_problem(::pressio::ode::StepScheme schemeName,  /*
 template<class TrialSubspaceType, class FomSystemType>
   requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
   && RealValuedSemiDiscreteFomWithMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
+  && (!RealValuedSemiDiscreteFomWithConstantMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>)
   && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #else
 template<
@@ -68,6 +71,7 @@ template<
   std::enable_if_t<
     PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
     && RealValuedSemiDiscreteFomWithMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
+    && !RealValuedSemiDiscreteFomWithConstantMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
     && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
     , int > = 0
   >
@@ -90,6 +94,45 @@ auto create_unsteady_explicit_problem(::pressio::ode::StepScheme schemeName,  /*
   return return_type(schemeName, trialSpace, fomSystem);
 }
 
+// -------------------------------------------------------------
+// default with constant mass matrix
+// -------------------------------------------------------------
+
+#ifdef PRESSIO_ENABLE_CXX20
+template<class TrialSubspaceType, class FomSystemType>
+  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+  && RealValuedSemiDiscreteFomWithConstantMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
+  && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
+#else
+template<
+  class TrialSubspaceType, class FomSystemType,
+  std::enable_if_t<
+    PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+    && RealValuedSemiDiscreteFomWithConstantMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
+    && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
+    , int > = 0
+  >
+#endif
+auto create_unsteady_explicit_problem(::pressio::ode::StepScheme schemeName,  /*(5)*/
+				      const TrialSubspaceType & trialSpace,
+				      const FomSystemType & fomSystem)
+{
+
+  impl::valid_scheme_for_explicit_galerkin_else_throw(schemeName, "galerkin_default_explicit");
+  using ind_var_type = typename FomSystemType::time_type;
+  using reduced_state_type = typename TrialSubspaceType::reduced_state_type;
+  using reduced_rhs_type = impl::explicit_galerkin_default_reduced_rhs_t<TrialSubspaceType>;
+  using reduced_mm_type = impl::explicit_galerkin_default_reduced_mass_matrix_t<TrialSubspaceType>;
+  // the reduced mass matrix is computed (and factorized, if the
+  // linear solver allows it) only once by the stepper
+  using galerkin_system = impl::GalerkinDefaultOdeSystemOnlyRhsAndConstantMassMatrix<
+    ind_var_type, reduced_state_type, reduced_rhs_type,
+    reduced_mm_type, TrialSubspaceType, FomSystemType>;
+
+  using return_type = impl::GalerkinUnsteadyWithMassMatrixExplicitProblem<galerkin_system>;
+  return return_type(schemeName, trialSpace, fomSystem);
+}
+
 // -------------------------------------------------------------
 // hyper-reduced
 // -------------------------------------------------------------
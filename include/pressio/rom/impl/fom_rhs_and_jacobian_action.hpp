@@ -0,0 +1,57 @@
+#ifndef ROM_IMPL_FOM_RHS_AND_JACOBIAN_ACTION_HPP_
+#define ROM_IMPL_FOM_RHS_AND_JACOBIAN_ACTION_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  evaluate the fom rhs and the fom jacobian action at the same state.
+  If the fom provides rhsAndApplyJacobian, use it so that the fom can
+  share work (fluxes, gradients, limiters, etc) between the two,
+  otherwise fall back to calling rhs and applyJacobian separately.
+*/
+
+#ifdef PRESSIO_ENABLE_CXX20
+template<class FomSystemType, class OperandType, class ResultType>
+  requires SemiDiscreteFomWithFusedRhsAndJacobianAction<FomSystemType, OperandType>
+#else
+template<
+  class FomSystemType, class OperandType, class ResultType,
+  std::enable_if_t<
+    SemiDiscreteFomWithFusedRhsAndJacobianAction<FomSystemType, OperandType>::value, int
+    > = 0
+  >
+#endif
+void fom_rhs_and_apply_jacobian(const FomSystemType & fomSystem,
+				const typename FomSystemType::state_type & fomState,
+				const typename FomSystemType::time_type & evalTime,
+				typename FomSystemType::rhs_type & fomRhs,
+				const OperandType & operand,
+				ResultType & fomJacAction)
+{
+  fomSystem.rhsAndApplyJacobian(fomState, evalTime, fomRhs, operand, fomJacAction);
+}
+
+#ifdef PRESSIO_ENABLE_CXX20
+template<class FomSystemType, class OperandType, class ResultType>
+  requires (!SemiDiscreteFomWithFusedRhsAndJacobianAction<FomSystemType, OperandType>)
+#else
+template<
+  class FomSystemType, class OperandType, class ResultType,
+  std::enable_if_t<
+    !SemiDiscreteFomWithFusedRhsAndJacobianAction<FomSystemType, OperandType>::value, int
+    > = 0
+  >
+#endif
+void fom_rhs_and_apply_jacobian(const FomSystemType & fomSystem,
+				const typename FomSystemType::state_type & fomState,
+				const typename FomSystemType::time_type & evalTime,
+				typename FomSystemType::rhs_type & fomRhs,
+				const OperandType & operand,
+				ResultType & fomJacAction)
+{
+  fomSystem.rhs(fomState, evalTime, fomRhs);
+  fomSystem.applyJacobian(fomState, operand, evalTime, fomJacAction);
+}
+
+}}} // end pressio::rom::impl
+#endif  // ROM_IMPL_FOM_RHS_AND_JACOBIAN_ACTION_HPP_
@@ -81,6 +81,7 @@ public:
                            jacobian_type* reducedJacobian) const
 #endif
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
 
     const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
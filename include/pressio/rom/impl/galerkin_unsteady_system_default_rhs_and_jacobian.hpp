@@ -74,14 +74,22 @@ public:
                       jacobian_type* reducedJacobian) const
 #endif
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
 
     // reconstruct fom state fomState = phi*reducedState
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
 
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    // evaluate fom rhs and, if needed, the fom jacobian action: fomJacAction_ = fom_J * phi
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    if (reducedJacobian){
+      fom_rhs_and_apply_jacobian(fomSystem_.get(), fomState_, rhsEvaluationTime,
+				 fomRhs_, phi, fomJacAction_);
+    }
+    else{
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    }
 
     // compute the reduced rhs
-    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     using phi_scalar_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
     constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
     using rhs_scalar_t = typename ::pressio::Traits<rhs_type>::scalar_type;
@@ -91,9 +99,6 @@ public:
 			    beta, reducedRhs);
 
     if (reducedJacobian){
-      // evaluate fom jacobian action: fomJacAction_ = fom_J * phi
-      fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, fomJacAction_);
-
       // compute the reduced jacobian
       constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
       constexpr auto beta = ::pressio::utils::Constants<rhs_scalar_t>::zero();
@@ -0,0 +1,101 @@
+
+#ifndef ROM_IMPL_GALERKIN_UNSTEADY_SYSTEM_DEFAULT_RHS_WITH_CONSTANT_MASS_MATRIX_HPP_
+#define ROM_IMPL_GALERKIN_UNSTEADY_SYSTEM_DEFAULT_RHS_WITH_CONSTANT_MASS_MATRIX_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  Same math as GalerkinDefaultOdeSystemOnlyRhsAndMassMatrix but for a FOM
+  whose mass matrix does not depend on state or time: the reduced
+  mass matrix phi^T M phi is exposed separately via massMatrix() so that
+  the explicit stepper only needs to compute (and factorize) it once,
+  while rhs() only computes phi^T f at every stage.
+*/
+template <
+  class IndVarType,
+  class ReducedStateType,
+  class ReducedRhsType,
+  class ReducedMassMatType,
+  class TrialSubspaceType,
+  class FomSystemType
+  >
+class GalerkinDefaultOdeSystemOnlyRhsAndConstantMassMatrix
+{
+  using basis_matrix_type = typename TrialSubspaceType::basis_matrix_type;
+
+public:
+  // required aliases
+  using independent_variable_type = IndVarType;
+  using state_type                = ReducedStateType;
+  using rhs_type                  = ReducedRhsType;
+  using mass_matrix_type          = ReducedMassMatType;
+
+  GalerkinDefaultOdeSystemOnlyRhsAndConstantMassMatrix(const TrialSubspaceType & trialSubspace,
+						       const FomSystemType & fomSystem)
+    : trialSubspace_(trialSubspace),
+      fomSystem_(fomSystem),
+      fomState_(trialSubspace.createFullState()),
+      fomRhs_(fomSystem.createRhs())
+  {}
+
+public:
+  state_type createState() const{
+    return trialSubspace_.get().createReducedState();
+  }
+
+  rhs_type createRhs() const{
+    return impl::CreateGalerkinRhs<rhs_type>()(trialSubspace_.get().dimension());
+  }
+
+  mass_matrix_type createMassMatrix() const{
+    return impl::CreateGalerkinMassMatrix<mass_matrix_type>()(trialSubspace_.get().dimension());
+  }
+
+  void rhs(const state_type & reducedState,
+	   const IndVarType & rhsEvaluationTime,
+	   rhs_type & reducedRhs) const
+  {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
+    // reconstruct fom state fomState = phi*reducedState
+    trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
+    // evaluate fomRhs
+    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+
+    // compute the reduced rhs
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    using phi_scalar_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
+    constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
+    using rhs_scalar_t = typename ::pressio::Traits<rhs_type>::scalar_type;
+    constexpr auto beta = ::pressio::utils::Constants<rhs_scalar_t>::zero();
+    ::pressio::ops::product(::pressio::transpose(),
+			    alpha, phi, fomRhs_,
+			    beta, reducedRhs);
+  }
+
+  void massMatrix(mass_matrix_type & reducedMassMat) const
+  {
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+
+    // the M*phi action is only needed here, and this is only
+    // called once by the stepper, so no need to keep it around
+    auto fomMMAction = fomSystem_.get().createResultOfMassMatrixActionOn(phi);
+    fomSystem_.get().applyMassMatrix(phi, fomMMAction);
+
+    using phi_scalar_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
+    constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
+    using mm_scalar_t = typename ::pressio::Traits<mass_matrix_type>::scalar_type;
+    constexpr auto beta = ::pressio::utils::Constants<mm_scalar_t>::zero();
+    ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			    alpha, phi, fomMMAction,
+			    beta, reducedMassMat);
+  }
+
+private:
+  std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
+  std::reference_wrapper<const FomSystemType> fomSystem_;
+  mutable typename FomSystemType::state_type fomState_;
+  mutable typename FomSystemType::rhs_type fomRhs_;
+};
+
+}}} // end pressio::rom::impl
+#endif  // ROM_IMPL_GALERKIN_UNSTEADY_SYSTEM_DEFAULT_RHS_WITH_CONSTANT_MASS_MATRIX_HPP_
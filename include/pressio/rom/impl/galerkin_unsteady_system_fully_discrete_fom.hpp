@@ -138,7 +138,8 @@ private:
 			 bool computeJacobian,
 			 States && ... states) const
   {
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
 
 #ifdef PRESSIO_ENABLE_CXX17
     if (computeJacobian){
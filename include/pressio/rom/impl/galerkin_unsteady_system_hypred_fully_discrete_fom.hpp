@@ -138,7 +138,8 @@ private:
                          bool computeJacobian,
                          States && ... states) const
   {
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
 
     if (computeJacobian){
       using op_ja_t = std::optional<fom_jac_action_result_type*>;
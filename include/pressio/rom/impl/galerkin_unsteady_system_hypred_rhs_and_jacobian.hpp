@@ -80,19 +80,24 @@ public:
                       jacobian_type* reducedJacobian) const
 #endif
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
 
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
-    hyperReducer_(fomRhs_, rhsEvaluationTime, reducedRhs);
     if (reducedJacobian){
       const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, fomJacAction_);
+      fom_rhs_and_apply_jacobian(fomSystem_.get(), fomState_, rhsEvaluationTime,
+				 fomRhs_, phi, fomJacAction_);
+      hyperReducer_(fomRhs_, rhsEvaluationTime, reducedRhs);
 #ifdef PRESSIO_ENABLE_CXX17
       hyperReducer_(fomJacAction_, rhsEvaluationTime, *reducedJacobian.value());
 #else
       hyperReducer_(fomJacAction_, rhsEvaluationTime, *reducedJacobian);
 #endif
     }
+    else{
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+      hyperReducer_(fomRhs_, rhsEvaluationTime, reducedRhs);
+    }
   }
 
 private:
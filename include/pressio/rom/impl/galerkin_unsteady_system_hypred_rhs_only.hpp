@@ -54,6 +54,7 @@ public:
 	   const IndVarType & rhsEvaluationTime,
 	   rhs_type & reducedRhs) const
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
 
     // reconstruct fom state fomState = phi*reducedState
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
@@ -93,15 +93,22 @@ public:
                       jacobian_type* reducedJacobian) const
 #endif
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::galerkin");
 
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, unMaskedFomRhs_);
+    if (reducedJacobian){
+      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+      fom_rhs_and_apply_jacobian(fomSystem_.get(), fomState_, rhsEvaluationTime,
+				 unMaskedFomRhs_, phi, unMaskedFomJacAction_);
+    }
+    else{
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, unMaskedFomRhs_);
+    }
+
     masker_(unMaskedFomRhs_, maskedFomRhs_);
     hyperReducer_(maskedFomRhs_, rhsEvaluationTime, reducedRhs);
 
     if (reducedJacobian){
-      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, unMaskedFomJacAction_);
       masker_(unMaskedFomJacAction_, maskedFomJacAction_);
 #ifdef PRESSIO_ENABLE_CXX17
       hyperReducer_(maskedFomJacAction_, rhsEvaluationTime, *reducedJacobian.value());
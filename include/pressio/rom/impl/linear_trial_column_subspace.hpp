@@ -35,6 +35,19 @@ struct CreateReducedState<
 };
 #endif
 
+template<class BasisType, class ReducedStateType, class FullStateType, class = void>
+struct supports_product_with_offset : std::false_type{};
+
+template<class BasisType, class ReducedStateType, class FullStateType>
+struct supports_product_with_offset<
+  BasisType, ReducedStateType, FullStateType,
+  mpl::void_t<
+    decltype(::pressio::ops::product_with_offset
+	     (::pressio::nontranspose(), 1,
+	      std::declval<BasisType const &>(), std::declval<ReducedStateType const &>(),
+	      1, std::declval<FullStateType const &>(), std::declval<FullStateType &>()))
+    >
+  > : std::true_type{};
 
 template <class BasisMatrixType, class FullStateType, class ReducedStateType>
 class TrialColumnSubspace
@@ -138,14 +151,15 @@ public:
   void mapFromReducedState(const reduced_state_type & latState,
 			   full_state_type & fullState) const
   {
-    // always do y = phi*latState
-    mapFromReducedStateWithoutTranslation(latState, fullState);
-
     if (isAffine_){
-      // update full state to account for translation
-      using sc_t = typename ::pressio::Traits<full_state_type>::scalar_type;
-      constexpr auto one = ::pressio::utils::Constants<sc_t>::one();
-      ::pressio::ops::update(fullState, one, translation_, one);
+      // y = phi*latState + translation
+      mapFromReducedStateWithTranslation(
+	std::integral_constant<bool, supports_product_with_offset<
+	  basis_matrix_type, reduced_state_type, full_state_type>::value>(),
+	latState, fullState);
+    }
+    else{
+      mapFromReducedStateWithoutTranslation(latState, fullState);
     }
   }
 
@@ -180,6 +194,30 @@ private:
     }
   }
 
+  // fused: the translation is added while computing phi*latState
+  void mapFromReducedStateWithTranslation(std::true_type /*fused*/,
+					  const reduced_state_type & latState,
+					  full_state_type & fullState) const
+  {
+    const auto & basis = linSpace_.basis();
+    using basis_sc_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
+    using full_state_sc_t = typename ::pressio::Traits<full_state_type>::scalar_type;
+    constexpr auto alpha = ::pressio::utils::Constants<basis_sc_t>::one();
+    constexpr auto beta  = ::pressio::utils::Constants<full_state_sc_t>::one();
+    ::pressio::ops::product_with_offset(::pressio::nontranspose(), alpha,
+					basis, latState, beta, translation_, fullState);
+  }
+
+  void mapFromReducedStateWithTranslation(std::false_type /*fused*/,
+					  const reduced_state_type & latState,
+					  full_state_type & fullState) const
+  {
+    mapFromReducedStateWithoutTranslation(latState, fullState);
+    using sc_t = typename ::pressio::Traits<full_state_type>::scalar_type;
+    constexpr auto one = ::pressio::utils::Constants<sc_t>::one();
+    ::pressio::ops::update(fullState, one, translation_, one);
+  }
+
   void mapFromReducedStateWithoutTranslation(const reduced_state_type & latState,
 					     full_state_type & fullState) const
   {
@@ -7,9 +7,13 @@ namespace pressio{ namespace rom{ namespace impl{
 template<class T= void>
 void valid_scheme_for_lspg_else_throw(::pressio::ode::StepScheme name){
   if (   name != ::pressio::ode::StepScheme::BDF1
-      && name != ::pressio::ode::StepScheme::BDF2)
+      && name != ::pressio::ode::StepScheme::BDF2
+      && name != ::pressio::ode::StepScheme::BDF3
+      && name != ::pressio::ode::StepScheme::BDF4
+      && name != ::pressio::ode::StepScheme::SDIRK22
+      && name != ::pressio::ode::StepScheme::SDIRK33)
   {
-    throw std::runtime_error("LSPG currently accepting BDF1 or BDF2");
+    throw std::runtime_error("LSPG currently accepting BDF1, BDF2, BDF3, BDF4, SDIRK22 or SDIRK33");
   }
 }
 
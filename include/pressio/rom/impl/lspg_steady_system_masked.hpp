@@ -82,6 +82,7 @@ public:
 			   jacobian_type * lspgJacobian) const
 #endif
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::lspg");
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
 
     const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
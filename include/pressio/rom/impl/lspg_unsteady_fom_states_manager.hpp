@@ -79,22 +79,27 @@ public:
 
   // n+1
   fom_state_type const & operator()(::pressio::ode::nPlusOne) const {
-    assert(data_.size() >=1); return data_[0];
+    assert(data_.size() >=1); return data_[slot(0)];
   }
 
   // n
   fom_state_type const & operator()(::pressio::ode::n) const {
-    assert(data_.size() >=2); return data_[1];
+    assert(data_.size() >=2); return data_[slot(1)];
   }
 
   // n-1
   fom_state_type const & operator()(::pressio::ode::nMinusOne) const {
-    assert(data_.size() >=3); return data_[2];
+    assert(data_.size() >=3); return data_[slot(2)];
   }
 
   // n-2
   fom_state_type const & operator()(::pressio::ode::nMinusTwo) const {
-    assert(data_.size() >=4); return data_[3];
+    assert(data_.size() >=4); return data_[slot(3)];
+  }
+
+  // n-3
+  fom_state_type const & operator()(::pressio::ode::nMinusThree) const {
+    assert(data_.size() >=5); return data_[slot(4)];
   }
 
   // n+1
@@ -102,7 +107,7 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::nPlusOne /*tag*/){
     assert(data_.size() >=1);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[0]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slot(0)]);
   }
 
   // n
@@ -110,7 +115,7 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::n /*tag*/){
     assert(data_.size() >=2);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slot(1)]);
   }
 
   // n-1
@@ -118,7 +123,7 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::nMinusOne /*tag*/){
     assert(data_.size() >=3);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[2]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slot(2)]);
   }
 
   // n-2
@@ -126,7 +131,15 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::nMinusTwo /*tag*/){
     assert(data_.size() >=4);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[4]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slot(3)]);
+  }
+
+  // n-3
+  template <class RomStateType>
+  void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
+				    ::pressio::ode::nMinusThree /*tag*/){
+    assert(data_.size() >=5);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slot(4)]);
   }
 
   template <class RomStateType>
@@ -136,33 +149,62 @@ public:
 
     assert(data_.size() >=2);
 
-    if (data_.size() == 2){
-      /* when n == 2, it means I only have n+1 and n
-       * so reconstructing at n, we just overwrite data_[1] */
-      trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
-    }
-    else if (data_.size() == 3){
-      /* when n == 3, we have y_n+1, y_n, y_n-1 */
-      // y_n becomes  y_n-1
-      ::pressio::ops::deep_copy(data_[2], data_[1]);
-      // reconstruct y_n
-      trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
-    }
-    else if (data_.size() == 4){
-      /* when n == 4, we have y_n+1, y_n, y_n-1, y_n-2 */
+    /* y_n+1 always sits in data_[0], while y_n, y_n-1, ... are stored
+     * in data_[1:] used as a ring buffer: to shift y_n -> y_n-1, etc,
+     * we rotate the head instead of copying the FOM states and then
+     * reconstruct y_n into the storage of the oldest state.
+     * When n == 2, it means I only have n+1 and n, so this just
+     * overwrites y_n. */
+    const std::size_t numPastStates = data_.size() - 1;
+    head_ = (head_ + numPastStates - 1) % numPastStates;
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slot(1)]);
+  }
 
-      // y_n-1 becomes y_n-2
-      ::pressio::ops::deep_copy(data_[3], data_[2]);
+  /* recomputes all the past FOM states used by the given scheme from
+     the reduced stencil. Shifting the stored states is only valid when
+     the stencil has moved forward by exactly one step, e.g. not for the
+     first step or for the sub-steps of the bdf3/bdf4 startup. */
+  template <class ReducedStencilType>
+  void reconstructPastStates(::pressio::ode::BDF1 /*tag*/,
+			     const ReducedStencilType & romStencil)
+  {
+    reconstructAtWithoutStencilUpdate(romStencil(::pressio::ode::n()),
+				      ::pressio::ode::n());
+  }
 
-      // y_n   becomes y_n-1
-      ::pressio::ops::deep_copy(data_[2], data_[1]);
+  template <class ReducedStencilType>
+  void reconstructPastStates(::pressio::ode::BDF2 /*tag*/,
+			     const ReducedStencilType & romStencil)
+  {
+    reconstructPastStates(::pressio::ode::BDF1(), romStencil);
+    reconstructAtWithoutStencilUpdate(romStencil(::pressio::ode::nMinusOne()),
+				      ::pressio::ode::nMinusOne());
+  }
 
-      // reconstruct y_n
-      trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
-    }
+  template <class ReducedStencilType>
+  void reconstructPastStates(::pressio::ode::BDF3 /*tag*/,
+			     const ReducedStencilType & romStencil)
+  {
+    reconstructPastStates(::pressio::ode::BDF2(), romStencil);
+    reconstructAtWithoutStencilUpdate(romStencil(::pressio::ode::nMinusTwo()),
+				      ::pressio::ode::nMinusTwo());
+  }
+
+  template <class ReducedStencilType>
+  void reconstructPastStates(::pressio::ode::BDF4 /*tag*/,
+			     const ReducedStencilType & romStencil)
+  {
+    reconstructPastStates(::pressio::ode::BDF3(), romStencil);
+    reconstructAtWithoutStencilUpdate(romStencil(::pressio::ode::nMinusThree()),
+				      ::pressio::ode::nMinusThree());
   }
 
 private:
+  // maps a logical stencil position (0 for n+1, 1 for n, etc) to the index in data_
+  std::size_t slot(std::size_t i) const{
+    return (i == 0) ? 0 : 1 + (head_ + i - 1) % (data_.size() - 1);
+  }
+
   void setZero(){
     for (std::size_t i=0; i<data_.size(); i++)
       ::pressio::ops::set_zero(data_[i]);
@@ -171,6 +213,7 @@ private:
 private:
   std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
   data_type data_;
+  std::size_t head_ = 0;
 };
 
 template <class TrialSubspaceType>
@@ -181,7 +224,10 @@ auto create_lspg_fom_states_manager(::pressio::ode::StepScheme name,
 
   auto fomStateTmp = trialSubspace.createFullState();
 
-  if (name == ::pressio::ode::StepScheme::BDF1){
+  // each sdirk stage is a bdf1 solve from the start of the stage
+  if (name == ::pressio::ode::StepScheme::BDF1
+      || name == ::pressio::ode::StepScheme::SDIRK22
+      || name == ::pressio::ode::StepScheme::SDIRK33){
     return return_type(trialSubspace,
 		       {::pressio::ops::clone(fomStateTmp),
 			::pressio::ops::clone(fomStateTmp)});
@@ -193,6 +239,21 @@ auto create_lspg_fom_states_manager(::pressio::ode::StepScheme name,
 			  ::pressio::ops::clone(fomStateTmp),
 			  ::pressio::ops::clone(fomStateTmp)});
     }
+  else if (name == ::pressio::ode::StepScheme::BDF3){
+    return return_type(trialSubspace,
+		       {::pressio::ops::clone(fomStateTmp),
+			::pressio::ops::clone(fomStateTmp),
+			::pressio::ops::clone(fomStateTmp),
+			::pressio::ops::clone(fomStateTmp)});
+  }
+  else if (name == ::pressio::ode::StepScheme::BDF4){
+    return return_type(trialSubspace,
+		       {::pressio::ops::clone(fomStateTmp),
+			::pressio::ops::clone(fomStateTmp),
+			::pressio::ops::clone(fomStateTmp),
+			::pressio::ops::clone(fomStateTmp),
+			::pressio::ops::clone(fomStateTmp)});
+  }
   else if (name == ::pressio::ode::StepScheme::CrankNicolson){
     return return_type(trialSubspace,
 		       {::pressio::ops::clone(fomStateTmp),
@@ -95,7 +95,7 @@ public:
   }
 
   discrete_jacobian_type createDiscreteJacobian() const{
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     discrete_jacobian_type J(fomSystem_.get().createResultOfDiscreteTimeJacobianActionOn(phi));
     return J;
   }
@@ -114,10 +114,11 @@ public:
 			      const state_type & lspg_state_np1,
 			      const state_type & lspg_state_n) const
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::lspg");
     doFomStatesReconstruction(currentStepNumber, lspg_state_np1, lspg_state_n);
     const auto & ynp1 = fomStatesManager_(::pressio::ode::nPlusOne());
     const auto & yn   = fomStatesManager_(::pressio::ode::n());
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
 
     try
     {
@@ -144,12 +145,13 @@ public:
 			      const state_type & lspg_state_n,
 			      const state_type & lspg_state_nm1) const
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::lspg");
     doFomStatesReconstruction(currentStepNumber, lspg_state_np1,
 			      lspg_state_n, lspg_state_nm1);
     const auto & ynp1 = fomStatesManager_(::pressio::ode::nPlusOne());
     const auto & yn   = fomStatesManager_(::pressio::ode::n());
     const auto & ynm1 = fomStatesManager_(::pressio::ode::nMinusOne());
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
 
     try{
       fomSystem_.get().discreteTimeResidualAndJacobianAction(currentStepNumber, time_np1, dt,
@@ -118,10 +118,14 @@ public:
 #endif
   {
 
+    // only ask the wrapped policy for the unmasked jacobian if the caller
+    // wants the jacobian: residual-only evaluations (e.g. inside a line search)
+    // must not pay for the full fom jacobian action
 #ifdef PRESSIO_ENABLE_CXX17
-    std::optional<unmasked_jacobian_type*> unmaskedJo{&unMaskedJacobian_};
+    std::optional<unmasked_jacobian_type*> unmaskedJo = {};
+    if (Jo){ unmaskedJo = &unMaskedJacobian_; }
 #else
-    unmasked_jacobian_type* unmaskedJo = &unMaskedJacobian_;
+    unmasked_jacobian_type* unmaskedJo = Jo ? &unMaskedJacobian_ : nullptr;
 #endif
 
     Maskable::operator()(odeSchemeName, predictedReducedState,
@@ -89,7 +89,7 @@ public:
   }
 
   jacobian_type createJacobian() const{
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     return fomSystem_.get().createResultOfJacobianActionOn(phi);
   }
 
@@ -108,6 +108,7 @@ public:
 		  jacobian_type * Jo) const
 #endif
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::lspg");
 
     if (odeSchemeName == ::pressio::ode::StepScheme::BDF1){
       (*this).template compute_impl_bdf<ode::BDF1>
@@ -115,8 +116,7 @@ public:
 	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
     }
 
-    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2)
-    {
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2){
       if (step.get() == ::pressio::ode::first_step_value){
 	(*this).template compute_impl_bdf<ode::BDF1>
 	  (predictedReducedState, reducedStatesStencilManager,
@@ -129,6 +129,22 @@ public:
       }
     }
 
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF3){
+      // the startup steps are handled by the stepper, which
+      // only asks for bdf1 while doing so
+      (*this).template compute_impl_bdf<ode::BDF3>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF4){
+      // the startup steps are handled by the stepper, which
+      // only asks for bdf1 while doing so
+      (*this).template compute_impl_bdf<ode::BDF4>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+
     else{
       throw std::runtime_error("Invalid choice of StepScheme for default unstedy LSPG");
     }
@@ -149,7 +165,9 @@ private:
 #endif
   {
     static_assert( std::is_same<OdeTag, ode::BDF1>::value ||
-		   std::is_same<OdeTag, ode::BDF2>::value, "");
+		   std::is_same<OdeTag, ode::BDF2>::value ||
+		   std::is_same<OdeTag, ode::BDF3>::value ||
+		   std::is_same<OdeTag, ode::BDF4>::value, "");
 
     /* the FOM state for the prediction has to be always recomputed
        regardless of whether the currentStepNumber changes since
@@ -161,10 +179,15 @@ private:
     const auto & fomStateAt_np1 = fomStatesManager_(::pressio::ode::nPlusOne());
 
     /* previous FOM states should only be recomputed when the time step changes.
-       The method below does not recompute all previous states, but only
-       recomputes the n-th state and updates/shifts back all the other
-       FOM states stored. */
-    if (stepTracker_ != step){
+       When moving to the next step, we do not recompute all previous states,
+       but only recompute the n-th state and update/shift back all the other
+       FOM states stored. Otherwise (first step, bdf3/bdf4 startup sub-steps
+       or restarted stepping) all the past states are recomputed. */
+    if (stepTracker_ != step && step != stepTracker_ + 1){
+      fomStatesManager_.get().reconstructPastStates(OdeTag(), reducedStatesStencilManager);
+      stepTracker_ = step;
+    }
+    else if (stepTracker_ != step){
       const auto & lspgStateAt_n = reducedStatesStencilManager(::pressio::ode::n());
       fomStatesManager_.get().reconstructAtWithStencilUpdate(lspgStateAt_n,
 								::pressio::ode::n());
@@ -172,8 +195,22 @@ private:
       stepTracker_ = step;
     }
 
-    // always compute residual
-    fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+    // always compute the fom rhs, and if the jacobian is needed
+    // store J*phi into J, where J is the d(fomrhs)/dy
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    if (Jo){
+#ifdef PRESSIO_ENABLE_CXX17
+      fom_rhs_and_apply_jacobian(fomSystem_.get(), fomStateAt_np1, rhsEvaluationTime,
+				 R, phi, *Jo.value());
+#else
+      fom_rhs_and_apply_jacobian(fomSystem_.get(), fomStateAt_np1, rhsEvaluationTime,
+				 R, phi, *Jo);
+#endif
+    }
+    else{
+      fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+    }
+
     // default lspg does not do anything special, so we can use the
     // available ode functions for computing the discrete residual
     ::pressio::ode::impl::discrete_residual(OdeTag(), fomStateAt_np1,
@@ -183,6 +220,7 @@ private:
     if (Jo){
       // lspg Jac looks something like: lspgJac = decoderJac + dt*coeff*d(fomrhs)/dy*phi
       // where J is the d(fomrhs)/dy and coeff depends on the scheme.
+      // J*phi is already stored into J, so we just need to update J properly
 
 #ifdef PRESSIO_ENABLE_CXX17
       auto & J = *Jo.value();
@@ -190,11 +228,6 @@ private:
       auto & J = *Jo;
 #endif
 
-      // first, store J*phi into J
-      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomStateAt_np1, phi, rhsEvaluationTime, J);
-
-      // second, we just need to update J properly
       using basis_sc_t = typename ::pressio::Traits<
 	typename TrialSubspaceType::basis_matrix_type>::scalar_type;
       const auto one = ::pressio::utils::Constants<basis_sc_t>::one();
@@ -202,10 +235,16 @@ private:
       if (std::is_same<OdeTag, ode::BDF1>::value){
 	factor = dt*::pressio::ode::constants::bdf1<IndVarType>::c_f_;
       }
-      else{
-	// goes to bdf2
+      else if (std::is_same<OdeTag, ode::BDF2>::value){
 	factor = dt*::pressio::ode::constants::bdf2<IndVarType>::c_f_;
       }
+      else if (std::is_same<OdeTag, ode::BDF3>::value){
+	factor = dt*::pressio::ode::constants::bdf3<IndVarType>::c_f_;
+      }
+      else{
+	// goes to bdf4
+	factor = dt*::pressio::ode::constants::bdf4<IndVarType>::c_f_;
+      }
       ::pressio::ops::update(J, factor, phi, one);
     }
   }
@@ -94,7 +94,7 @@ public:
   }
 
   jacobian_type createJacobian() const{
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     return fomSystem_.get().createResultOfJacobianActionOn(phi);
   }
 
@@ -113,6 +113,7 @@ public:
 		  jacobian_type * Jo) const
 #endif
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("rom::lspg");
 
     if (odeSchemeName == ::pressio::ode::StepScheme::BDF1)
     {
@@ -121,8 +122,7 @@ public:
 	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
     }
 
-    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2)
-    {
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2){
       if (step.get() == ::pressio::ode::first_step_value){
 	(*this).template compute_impl_bdf<ode::BDF1>
 	  (predictedReducedState, reducedStatesStencilManager,
@@ -135,6 +135,22 @@ public:
       }
     }
 
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF3){
+      // the startup steps are handled by the stepper, which
+      // only asks for bdf1 while doing so
+      (*this).template compute_impl_bdf<ode::BDF3>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF4){
+      // the startup steps are handled by the stepper, which
+      // only asks for bdf1 while doing so
+      (*this).template compute_impl_bdf<ode::BDF4>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+
     else{
       throw std::runtime_error("Invalid choice of StepScheme for hyp-red unstedy LSPG");
     }
@@ -155,7 +171,9 @@ private:
 #endif
   {
     static_assert( std::is_same<OdeTag, ode::BDF1>::value ||
-		   std::is_same<OdeTag, ode::BDF2>::value, "");
+		   std::is_same<OdeTag, ode::BDF2>::value ||
+		   std::is_same<OdeTag, ode::BDF3>::value ||
+		   std::is_same<OdeTag, ode::BDF4>::value, "");
 
     /* the FOM state for the prediction has to be always recomputed
        regardless of whether the currentStepNumber changes since
@@ -167,16 +185,37 @@ private:
     const auto & fomStateAt_np1 = fomStatesManager_(::pressio::ode::nPlusOne());
 
     /* previous FOM states should only be recomputed when the time step changes.
-       The method below does not recompute all previous states, but only
-       recomputes the n-th state and updates/shifts back all the other
-       FOM states stored. */
-    if (stepTracker_ != step){
+       When moving to the next step, we do not recompute all previous states,
+       but only recompute the n-th state and update/shift back all the other
+       FOM states stored. Otherwise (first step, bdf3/bdf4 startup sub-steps
+       or restarted stepping) all the past states are recomputed. */
+    if (stepTracker_ != step && step != stepTracker_ + 1){
+      fomStatesManager_.get().reconstructPastStates(OdeTag(), reducedStatesStencilManager);
+      stepTracker_ = step;
+    }
+    else if (stepTracker_ != step){
       const auto & lspgStateAt_n = reducedStatesStencilManager(::pressio::ode::n());
       fomStatesManager_.get().reconstructAtWithStencilUpdate(lspgStateAt_n,
 							     ::pressio::ode::n());
       stepTracker_ = step;
     }
 
+    /* R = f(t_n+1, y_n+1) is needed by all schemes, and if the jacobian
+       is needed we also store J*phi into J, where J is the d(fomrhs)/dy */
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    if (Jo){
+#ifdef PRESSIO_ENABLE_CXX17
+      fom_rhs_and_apply_jacobian(fomSystem_.get(), fomStateAt_np1, rhsEvaluationTime,
+				 R, phi, *Jo.value());
+#else
+      fom_rhs_and_apply_jacobian(fomSystem_.get(), fomStateAt_np1, rhsEvaluationTime,
+				 R, phi, *Jo);
+#endif
+    }
+    else{
+      fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+    }
+
     if (std::is_same<OdeTag, ode::BDF1>::value){
 
       /* BDF1 residual : R(y_n+1) = cnp1*y_n+1 + cn*y_n + cf*f(t_n+1, y_n+1)
@@ -185,8 +224,7 @@ private:
 	 2. fomStateHelpInstance_ = cnp1*y_np1 + cn*y_n
 	 3. call the hypRedUpdater to handle the rest
       */
-      // step 1
-      fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+      // step 1 is done above
       // step 2
       const auto & fomStateAt_n = fomStatesManager_(::pressio::ode::n());
       using fom_state_type = typename FomSystemType::state_type;
@@ -204,7 +242,7 @@ private:
       hypRedUpdater_.get().updateSampleMeshOperandWithStencilMeshOne
 	(R, cf, fomStateHelperInstance_, one);
     }
-    else{
+    else if (std::is_same<OdeTag, ode::BDF2>::value){
 
       /* BDF2 residual : R(y_n+1) = cnp1*y_n+1 + cn*y_n + cnm1*y_nm1 + cf*f(t_n+1, y_n+1)
 	 which we do follows:
@@ -212,8 +250,7 @@ private:
 	 2. fomStateHelpInstance_ = cnp1*y_np1 + cn*y_n + cnm1*y_nm1
 	 3. call the hypRedUpdater to handle the rest
       */
-      // step 1
-      fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+      // step 1 is done above
       // step 2
       const auto & fomStateAt_n = fomStatesManager_(::pressio::ode::n());
       const auto & fomStateAt_nm1 = fomStatesManager_(::pressio::ode::nMinusOne());
@@ -235,6 +272,68 @@ private:
       hypRedUpdater_.get().updateSampleMeshOperandWithStencilMeshOne
 	(R, cf, fomStateHelperInstance_, one);
     }
+    else if (std::is_same<OdeTag, ode::BDF3>::value){
+
+      /* BDF3 residual : R(y_n+1) = cnp1*y_n+1 + cn*y_n + cnm1*y_nm1 + cnm2*y_nm2 + cf*f(t_n+1, y_n+1)
+	 which we do follows:
+	 1. R = f(t_n+1, y_n+1)
+	 2. fomStateHelpInstance_ = cnp1*y_np1 + cn*y_n + cnm1*y_nm1 + cnm2*y_nm2
+	 3. call the hypRedUpdater to handle the rest
+      */
+      // step 1 is done above
+      // step 2
+      const auto & fomStateAt_n = fomStatesManager_(::pressio::ode::n());
+      const auto & fomStateAt_nm1 = fomStatesManager_(::pressio::ode::nMinusOne());
+      const auto & fomStateAt_nm2 = fomStatesManager_(::pressio::ode::nMinusTwo());
+
+      using fom_state_type = typename FomSystemType::state_type;
+      using sc_t = typename ::pressio::Traits<fom_state_type>::scalar_type;
+      using cnst = ::pressio::ode::constants::bdf3<sc_t>;
+      constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+      ::pressio::ops::update(fomStateHelperInstance_, zero,
+			     fomStateAt_np1, cnst::c_np1_,
+			     fomStateAt_n, cnst::c_n_,
+			     fomStateAt_nm1, cnst::c_nm1_,
+			     fomStateAt_nm2, cnst::c_nm2_);
+
+      // step 3
+      constexpr auto one = ::pressio::utils::Constants<sc_t>::one();
+      const auto cf = cnst::c_f_ * dt;
+      hypRedUpdater_.get().updateSampleMeshOperandWithStencilMeshOne
+	(R, cf, fomStateHelperInstance_, one);
+    }
+    else{
+
+      /* BDF4 residual : R(y_n+1) = cnp1*y_n+1 + cn*y_n + cnm1*y_nm1 + cnm2*y_nm2 + cnm3*y_nm3
+	                            + cf*f(t_n+1, y_n+1)
+	 same as above, but update accepts at most four operands
+	 so the helper state is assembled in two passes
+      */
+      // step 1 is done above
+      // step 2
+      const auto & fomStateAt_n = fomStatesManager_(::pressio::ode::n());
+      const auto & fomStateAt_nm1 = fomStatesManager_(::pressio::ode::nMinusOne());
+      const auto & fomStateAt_nm2 = fomStatesManager_(::pressio::ode::nMinusTwo());
+      const auto & fomStateAt_nm3 = fomStatesManager_(::pressio::ode::nMinusThree());
+
+      using fom_state_type = typename FomSystemType::state_type;
+      using sc_t = typename ::pressio::Traits<fom_state_type>::scalar_type;
+      using cnst = ::pressio::ode::constants::bdf4<sc_t>;
+      constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+      constexpr auto one = ::pressio::utils::Constants<sc_t>::one();
+      ::pressio::ops::update(fomStateHelperInstance_, zero,
+			     fomStateAt_np1, cnst::c_np1_,
+			     fomStateAt_n, cnst::c_n_,
+			     fomStateAt_nm1, cnst::c_nm1_,
+			     fomStateAt_nm2, cnst::c_nm2_);
+      ::pressio::ops::update(fomStateHelperInstance_, one,
+			     fomStateAt_nm3, cnst::c_nm3_);
+
+      // step 3
+      const auto cf = cnst::c_f_ * dt;
+      hypRedUpdater_.get().updateSampleMeshOperandWithStencilMeshOne
+	(R, cf, fomStateHelperInstance_, one);
+    }
 
     // deal with jacobian if needed
     if (Jo){
@@ -245,10 +344,7 @@ private:
 #endif
       // lspgJac = decoderJac + dt*coeff*J*decoderJac
       // where J is the d(fomrhs)/dy and coeff depends on the scheme.
-
-      // first, store J*phi into J
-      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomStateAt_np1, phi, rhsEvaluationTime, J);
+      // J*phi is already stored into J, so we just need to update J properly
 
       using sc_t = typename ::pressio::Traits<
 	typename TrialSubspaceType::basis_matrix_type>::scalar_type;
@@ -257,9 +353,15 @@ private:
       if (std::is_same<OdeTag, ode::BDF1>::value){
 	cf = dt * ::pressio::ode::constants::bdf1<sc_t>::c_f_;
       }
-      else{
+      else if (std::is_same<OdeTag, ode::BDF2>::value){
 	cf = dt * ::pressio::ode::constants::bdf2<sc_t>::c_f_;
       }
+      else if (std::is_same<OdeTag, ode::BDF3>::value){
+	cf = dt * ::pressio::ode::constants::bdf3<sc_t>::c_f_;
+      }
+      else{
+	cf = dt * ::pressio::ode::constants::bdf4<sc_t>::c_f_;
+      }
 
       hypRedUpdater_.get().updateSampleMeshOperandWithStencilMeshOne(J, cf, phi, one);
     }
@@ -0,0 +1,78 @@
+
+#ifndef ROM_IMPL_ROWS_OF_OPERAND_HPP_
+#define ROM_IMPL_ROWS_OF_OPERAND_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  copy of the rows of a vector or matrix identified by rowIndices,
+  where rowIndices is any container supporting size() and operator[]
+*/
+template<class T, class RowIndicesType>
+std::enable_if_t<
+  ::pressio::is_dynamic_vector_eigen<T>::value, T
+  >
+rows_of_operand(const T & operand, const RowIndicesType & rowIndices)
+{
+  T result(rowIndices.size());
+  for (std::size_t i=0; i<(std::size_t)rowIndices.size(); ++i){
+    assert(rowIndices[i] >= 0 && rowIndices[i] < operand.size());
+    result(i) = operand(rowIndices[i]);
+  }
+  return result;
+}
+
+template<class T, class RowIndicesType>
+std::enable_if_t<
+  ::pressio::is_dynamic_dense_matrix_eigen<T>::value, T
+  >
+rows_of_operand(const T & operand, const RowIndicesType & rowIndices)
+{
+  T result(rowIndices.size(), operand.cols());
+  for (std::size_t i=0; i<(std::size_t)rowIndices.size(); ++i){
+    assert(rowIndices[i] >= 0 && rowIndices[i] < operand.rows());
+    result.row(i) = operand.row(rowIndices[i]);
+  }
+  return result;
+}
+
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+template<class T, class RowIndicesType>
+std::enable_if_t<
+  ::pressio::is_dynamic_vector_kokkos<T>::value, T
+  >
+rows_of_operand(const T & operand, const RowIndicesType & rowIndices)
+{
+  // this is a setup step, so the gather is done on the host
+  auto operand_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), operand);
+  T result(operand.label(), rowIndices.size());
+  auto result_h = Kokkos::create_mirror_view(result);
+  for (std::size_t i=0; i<(std::size_t)rowIndices.size(); ++i){
+    result_h(i) = operand_h(rowIndices[i]);
+  }
+  Kokkos::deep_copy(result, result_h);
+  return result;
+}
+
+template<class T, class RowIndicesType>
+std::enable_if_t<
+  ::pressio::is_dynamic_dense_matrix_kokkos<T>::value, T
+  >
+rows_of_operand(const T & operand, const RowIndicesType & rowIndices)
+{
+  // this is a setup step, so the gather is done on the host
+  auto operand_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), operand);
+  T result(operand.label(), rowIndices.size(), operand.extent(1));
+  auto result_h = Kokkos::create_mirror_view(result);
+  for (std::size_t i=0; i<(std::size_t)rowIndices.size(); ++i){
+    for (std::size_t j=0; j<operand.extent(1); ++j){
+      result_h(i,j) = operand_h(rowIndices[i], j);
+    }
+  }
+  Kokkos::deep_copy(result, result_h);
+  return result;
+}
+#endif
+
+}}}
+#endif  // ROM_IMPL_ROWS_OF_OPERAND_HPP_
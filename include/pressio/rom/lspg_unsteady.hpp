@@ -3,6 +3,7 @@
 #define ROM_LSPG_UNSTEADY_HPP_
 
 #include "./impl/lspg_helpers.hpp"
+#include "./impl/fom_rhs_and_jacobian_action.hpp"
 #include "./impl/lspg_unsteady_fom_states_manager.hpp"
 #include "./impl/lspg_unsteady_rj_policy_default.hpp"
 #include "./impl/lspg_unsteady_rj_policy_hypred.hpp"
@@ -269,5 +269,44 @@ struct has_const_rhs_method_accept_state_indvar_result_return_void<
     >
   > : std::true_type{};
 
+// ---------------------------------------------------------------
+
+template <
+  class T,
+  class StateType,
+  class IndVarType,
+  class RhsType,
+  class OperandType,
+  class ResultType,
+  class = void
+  >
+struct has_const_rhs_and_apply_jacobian_method_accept_state_indvar_rhs_operand_result_return_void
+  : std::false_type{};
+
+template <
+  class T,
+  class StateType,
+  class IndVarType,
+  class RhsType,
+  class OperandType,
+  class ResultType
+  >
+struct has_const_rhs_and_apply_jacobian_method_accept_state_indvar_rhs_operand_result_return_void<
+  T, StateType, IndVarType, RhsType, OperandType, ResultType,
+  std::enable_if_t<
+    std::is_void<
+      decltype(
+	       std::declval<T const>().rhsAndApplyJacobian(
+					  std::declval<StateType const&>(),
+					  std::declval<IndVarType const &>(),
+					  std::declval<RhsType &>(),
+					  std::declval<OperandType const&>(),
+					  std::declval<ResultType &>()
+					  )
+	   )
+      >::value
+    >
+  > : std::true_type{};
+
 }} // end pressio::rom
 #endif  // ROM_PREDICATES_HPP_
@@ -332,6 +332,24 @@ struct SemiDiscreteFomWithJacobianAndMassMatrixAction<
   >
   > : std::true_type{};
 
+// optional: if a FOM models this, pressio uses the fused method whenever
+// the rhs and the jacobian action are needed at the same state
+template<class T, class JacobianActionOperandType, class enable = void>
+struct SemiDiscreteFomWithFusedRhsAndJacobianAction : std::false_type{};
+
+template<class T, class JacobianActionOperandType>
+struct SemiDiscreteFomWithFusedRhsAndJacobianAction<
+  T, JacobianActionOperandType,
+  std::enable_if_t<
+       SemiDiscreteFomWithJacobianAction<T, JacobianActionOperandType>::value
+    && ::pressio::rom::has_const_rhs_and_apply_jacobian_method_accept_state_indvar_rhs_operand_result_return_void<
+	 T, typename T::state_type, typename T::time_type, typename T::rhs_type,
+	 JacobianActionOperandType,
+	 impl::fom_jac_action_t<T, JacobianActionOperandType>
+	 >::value
+    >
+  > : std::true_type{};
+
 
 template<class T, int TotalNumStates, class JacobianActionOperandType, class = void>
 struct FullyDiscreteSystemWithJacobianAction : std::false_type{};
@@ -392,6 +410,38 @@ struct RealValuedSteadyFomWithJacobianAction<
     >
   > : std::true_type{};
 
+template<class T, class MassMatrixActionOperandType, class enable = void>
+struct SemiDiscreteFomWithConstantMassMatrixAction : std::false_type{};
+
+template<class T, class MassMatrixActionOperandType>
+struct SemiDiscreteFomWithConstantMassMatrixAction<
+  T, MassMatrixActionOperandType,
+  std::enable_if_t<
+    SemiDiscreteFom<T>::value
+    //
+    && std::is_copy_constructible<
+      decltype
+      (
+       std::declval<T const>().createResultOfMassMatrixActionOn
+       (
+	std::declval<MassMatrixActionOperandType const &>()
+	)
+       )
+      >::value
+    && std::is_void<
+       decltype
+       (
+	std::declval<T const>().applyMassMatrix
+	(
+	 std::declval<MassMatrixActionOperandType const&>(),
+	 std::declval<impl::fom_mass_matrix_action_t<T,  MassMatrixActionOperandType> &>()
+	 )
+	)
+       >::value
+   >
+  > : std::true_type{};
+
+
 // --------------------------------------------------------
 template<class T, class enable = void>
 struct RealValuedSemiDiscreteFom : std::false_type{};
@@ -423,6 +473,22 @@ struct RealValuedSemiDiscreteFomWithMassMatrixAction<
     >
   > : std::true_type{};
 
+// --------------------------------------------------------
+template<class T, class MassMatrixActionOperandType, class enable = void>
+struct RealValuedSemiDiscreteFomWithConstantMassMatrixAction : std::false_type{};
+
+template<class T, class MassMatrixActionOperandType>
+struct RealValuedSemiDiscreteFomWithConstantMassMatrixAction<
+  T, MassMatrixActionOperandType,
+  std::enable_if_t<
+       RealValuedSemiDiscreteFom<T>::value
+    && SemiDiscreteFomWithConstantMassMatrixAction<T, MassMatrixActionOperandType>::value
+    && std::is_floating_point<
+	 scalar_trait_t< impl::fom_mass_matrix_action_t<T, MassMatrixActionOperandType> >
+      >::value
+    >
+  > : std::true_type{};
+
 // --------------------------------------------------------
 template<class T, class OperandType, class enable = void>
 struct RealValuedSemiDiscreteFomWithJacobianAction : std::false_type{};
@@ -193,6 +193,21 @@ concept SemiDiscreteFomWithMassMatrixAction =
     { A.applyMassMatrix(state, operand, evalTime, result) } -> std::same_as<void>;
   };
 
+template <class T, class MassMatrixActionOperandType>
+concept SemiDiscreteFomWithConstantMassMatrixAction =
+  SemiDiscreteFom<T>
+  && requires(const T & A,
+	      const MassMatrixActionOperandType & operand)
+  {
+    { A.createResultOfMassMatrixActionOn(operand) } -> std::copy_constructible;
+  }
+  && requires(const T & A,
+	      const MassMatrixActionOperandType & operand,
+	      impl::fom_mass_matrix_action_t<T, MassMatrixActionOperandType> & result)
+  {
+    { A.applyMassMatrix(operand, result) } -> std::same_as<void>;
+  };
+
 template<class T, class JacobianActionOperandType>
 concept SemiDiscreteFomWithJacobianAction =
   SemiDiscreteFom<T>
@@ -216,6 +231,21 @@ concept SemiDiscreteFomWithJacobianAndMassMatrixAction =
      SemiDiscreteFomWithJacobianAction<T, OperandType>
   && SemiDiscreteFomWithMassMatrixAction<T, OperandType>;
 
+// optional: if a FOM models this, pressio uses the fused method whenever
+// the rhs and the jacobian action are needed at the same state
+template<class T, class JacobianActionOperandType>
+concept SemiDiscreteFomWithFusedRhsAndJacobianAction =
+  SemiDiscreteFomWithJacobianAction<T, JacobianActionOperandType>
+  && requires(const T & A,
+	      const typename T::state_type    & state,
+	      const typename T::time_type     & evalTime,
+	      typename T::rhs_type            & rhs,
+	      const JacobianActionOperandType & operand,
+	      impl::fom_jac_action_t<T, JacobianActionOperandType> & result)
+  {
+    { A.rhsAndApplyJacobian(state, evalTime, rhs, operand, result) } -> std::same_as<void>;
+  };
+
 
 template<class T, int TotalNumStates, class JacobianActionOperandType>
 concept FullyDiscreteSystemWithJacobianAction =
@@ -269,6 +299,14 @@ concept RealValuedSemiDiscreteFomWithMassMatrixAction =
     scalar_trait_t< impl::fom_mass_matrix_action_t<T, MassMatrixActionOperandType> >
   >;
 
+template <class T, class MassMatrixActionOperandType>
+concept RealValuedSemiDiscreteFomWithConstantMassMatrixAction =
+  RealValuedSemiDiscreteFom<T>
+  && SemiDiscreteFomWithConstantMassMatrixAction<T, MassMatrixActionOperandType>
+  && std::floating_point<
+    scalar_trait_t< impl::fom_mass_matrix_action_t<T, MassMatrixActionOperandType> >
+  >;
+
 template <class T, class JacobianActionOperandType>
 concept RealValuedSemiDiscreteFomWithJacobianAction =
   RealValuedSemiDiscreteFom<T>
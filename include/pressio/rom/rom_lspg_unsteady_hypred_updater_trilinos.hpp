@@ -51,6 +51,67 @@
 
 namespace pressio{ namespace rom{ namespace lspg{
 
+namespace impl{
+
+/*
+  for each local row of the sample mesh, the local index of the
+  same global row in the stencil mesh. The stencil mesh must own,
+  on each rank, all the sample mesh rows of that rank.
+*/
+template<class MapType>
+Kokkos::View<typename MapType::local_ordinal_type*, typename MapType::device_type>
+create_sample_to_stencil_local_indices(const MapType & sampleMap,
+				       const MapType & stencilMap)
+{
+  using lo_t = typename MapType::local_ordinal_type;
+  using view_t = Kokkos::View<lo_t*, typename MapType::device_type>;
+
+  const std::size_t numLocal = sampleMap.getMyGlobalIndices().extent(0);
+  view_t lids("pressioHypRedSampleToStencilLids", numLocal);
+  auto lids_h = Kokkos::create_mirror_view(lids);
+  for (std::size_t i=0; i<numLocal; ++i){
+    const auto gid = sampleMap.getGlobalElement(static_cast<lo_t>(i));
+    // assert that the sample mesh global index is also owned by
+    // the stencil map on the calling process
+    assert(stencilMap.isNodeGlobalElement(gid));
+    lids_h(i) = stencilMap.getLocalElement(gid);
+  }
+  Kokkos::deep_copy(lids, lids_h);
+  return lids;
+}
+
+// sample(i,j) = alpha*sample(i,j) + beta*stencil(lids(i),j)
+template<class ScalarType, class LidsViewType, class ...Args>
+void gather_update_sample_operand(Tpetra::MultiVector<Args...> & sample_operand,
+				  const ScalarType alpha,
+				  const Tpetra::MultiVector<Args...> & stencil_operand,
+				  const ScalarType beta,
+				  const LidsViewType & lids)
+{
+  assert(lids.extent(0) == sample_operand.getLocalLength());
+  assert(sample_operand.getNumVectors() == stencil_operand.getNumVectors());
+
+  using mv_t = Tpetra::MultiVector<Args...>;
+  using sc_t = typename mv_t::impl_scalar_type;
+  using exe_space = typename mv_t::execution_space;
+
+  auto sample_op_data  = sample_operand.getLocalViewDevice(Tpetra::Access::ReadWrite);
+  auto stencil_op_data = stencil_operand.getLocalViewDevice(Tpetra::Access::ReadOnly);
+  const std::size_t numCols = sample_operand.getNumVectors();
+  const sc_t alpha_(alpha);
+  const sc_t beta_(beta);
+  Kokkos::parallel_for("pressio::rom::lspg::hypRedUpdate",
+		       Kokkos::RangePolicy<exe_space>(0, lids.extent(0)),
+		       KOKKOS_LAMBDA (const std::size_t & i){
+			 const auto lid = lids(i);
+			 for (std::size_t j=0; j<numCols; ++j){
+			   sample_op_data(i,j) = alpha_*sample_op_data(i,j)
+			     + beta_*stencil_op_data(lid,j);
+			 }
+		       });
+}
+}// end namespace impl
+
 // a = alpha*a + beta*b (a,b potentially non with same distribution)
 
 struct HypRedUpdaterTrilinos
@@ -59,40 +120,70 @@ struct HypRedUpdaterTrilinos
   // -----------------
   // TPETRA
   // -----------------
+  /* the sample-to-stencil indices are recomputed at every call,
+     use PrecomputedHypRedUpdaterTrilinos to compute them only once */
   template<class ScalarType, class ...Args>
   void updateSampleMeshOperandWithStencilMeshOne
-  (Tpetra::Vector<Args...> & sample_operand,
+  (Tpetra::MultiVector<Args...> & sample_operand,
    const ScalarType alpha,
-   const Tpetra::Vector<Args...> & stencil_operand,
+   const Tpetra::MultiVector<Args...> & stencil_operand,
    const ScalarType beta) const
   {
+    const auto lids = impl::create_sample_to_stencil_local_indices
+      (*sample_operand.getMap(), *stencil_operand.getMap());
+    impl::gather_update_sample_operand(sample_operand, alpha,
+				       stencil_operand, beta, lids);
+  }
 
-    const auto sample_map   = sample_operand.getMap();
-    const auto sample_gIDs  = sample_map->getMyGlobalIndices();
-    const auto stencil_map  = stencil_operand.getMap();
-    const auto stencil_gIDs = stencil_map->getMyGlobalIndices();
-
-    //loop over LOCAL elements of the sample_operand
-    auto sample_op_data  = sample_operand.getLocalViewHost(Tpetra::Access::ReadWriteStruct());
-    auto stencil_op_data = stencil_operand.getLocalViewHost(Tpetra::Access::ReadOnlyStruct());
-    for (std::size_t i=0; i<sample_operand.getLocalLength(); i++)
-    {
-
-      // assert that the sample mesh global index is also owned by
-      // the stencil map on the calling process
-      assert(stencil_map->isNodeGlobalElement(sample_gIDs[i]));
-
-      // we only need to combine things if the global id of the
-      // sample operand is found in the stencil so we ask
-      // the stencil map what is the local index that corresponds
-      // to the global id we are handling
-      const auto lid = stencil_map->getLocalElement(sample_gIDs[i]);
-
-      sample_op_data(i,0) = alpha*sample_op_data(i,0)
-	+ beta*stencil_op_data(lid,0);
-    }
+  // -----------------
+  // TPETRA BLOCK
+  // -----------------
+  template<class ScalarType, class ...Args>
+  void updateSampleMeshOperandWithStencilMeshOne
+  (Tpetra::BlockVector<Args...> & sample_operand,
+   const ScalarType alpha,
+   const Tpetra::BlockVector<Args...> & stencil_operand,
+   const ScalarType beta) const
+  {
+    using block_type = Tpetra::BlockVector<Args...>;
+    auto sample_op_vv = sample_operand.getVectorView();
+    auto stencil_op_vv = const_cast<block_type &>(stencil_operand).getVectorView();
+    updateSampleMeshOperandWithStencilMeshOne(sample_op_vv, alpha, stencil_op_vv, beta);
   }
 
+  template<class ScalarType, class ...Args>
+  void updateSampleMeshOperandWithStencilMeshOne
+  (Tpetra::BlockMultiVector<Args...> & sample_operand,
+   const ScalarType alpha,
+   const Tpetra::BlockMultiVector<Args...> & stencil_operand,
+   const ScalarType beta) const
+  {
+    auto sample_op_vv = sample_operand.getMultiVectorView();
+    auto stencil_op_vv = stencil_operand.getMultiVectorView();
+    updateSampleMeshOperandWithStencilMeshOne(sample_op_vv, alpha, stencil_op_vv, beta);
+  }
+
+};
+
+/*
+  same as HypRedUpdaterTrilinos but the sample-to-stencil local indices
+  are computed once at construction, so each update is a single gather
+  kernel over all columns with no map lookups.
+  The maps are the (point) maps of the sample and stencil mesh operands:
+  for block operands, pass the maps of their point (multi)vector views.
+*/
+template<class MapType>
+class PrecomputedHypRedUpdaterTrilinos
+{
+  using lids_type = Kokkos::View<
+    typename MapType::local_ordinal_type*, typename MapType::device_type>;
+
+public:
+  PrecomputedHypRedUpdaterTrilinos(const MapType & sampleMeshMap,
+				   const MapType & stencilMeshMap)
+    : lids_(impl::create_sample_to_stencil_local_indices(sampleMeshMap, stencilMeshMap))
+  {}
+
   template<class ScalarType, class ...Args>
   void updateSampleMeshOperandWithStencilMeshOne
   (Tpetra::MultiVector<Args...> & sample_operand,
@@ -100,37 +191,10 @@ struct HypRedUpdaterTrilinos
    const Tpetra::MultiVector<Args...> & stencil_operand,
    const ScalarType beta) const
   {
-
-    const auto sample_map   = sample_operand.getMap();
-    const auto sample_gIDs  = sample_map->getMyGlobalIndices();
-    const auto stencil_map  = stencil_operand.getMap();
-    const auto stencil_gIDs = stencil_map->getMyGlobalIndices();
-
-    //loop over LOCAL elements of the sample_operand
-    auto sample_op_data  = sample_operand.getLocalViewHost(Tpetra::Access::ReadWriteStruct());
-    auto stencil_op_data = stencil_operand.getLocalViewHost(Tpetra::Access::ReadOnlyStruct());
-
-    for (std::size_t j=0; j<sample_operand.getNumVectors(); j++){
-      for (std::size_t i=0; i<sample_operand.getLocalLength(); i++){
-	// assert that the sample mesh global index is also owned by
-	// the stencil map on the calling process
-	assert(stencil_map->isNodeGlobalElement(sample_gIDs[i]));
-
-	// we only need to combine things if the global id of the
-	// sample operand is found in the stencil so we ask
-	// the stencil map what is the local index that corresponds
-	// to the global id we are handling
-	const auto lid = stencil_map->getLocalElement(sample_gIDs[i]);
-
-	sample_op_data(i,j) = alpha*sample_op_data(i,j)
-	  + beta*stencil_op_data(lid,j);
-      }
-    }
+    impl::gather_update_sample_operand(sample_operand, alpha,
+				       stencil_operand, beta, lids_);
   }
 
-  // -----------------
-  // TPETRA BLOCK
-  // -----------------
   template<class ScalarType, class ...Args>
   void updateSampleMeshOperandWithStencilMeshOne
   (Tpetra::BlockVector<Args...> & sample_operand,
@@ -156,7 +220,17 @@ struct HypRedUpdaterTrilinos
     updateSampleMeshOperandWithStencilMeshOne(sample_op_vv, alpha, stencil_op_vv, beta);
   }
 
+private:
+  lids_type lids_;
 };
 
+template<class MapType>
+PrecomputedHypRedUpdaterTrilinos<MapType>
+create_precomputed_hypred_updater_trilinos(const MapType & sampleMeshMap,
+					   const MapType & stencilMeshMap)
+{
+  return PrecomputedHypRedUpdaterTrilinos<MapType>(sampleMeshMap, stencilMeshMap);
+}
+
 }}}
 #endif  // ROM_ROM_LSPG_UNSTEADY_HYPRED_UPDATER_TRILINOS_HPP_
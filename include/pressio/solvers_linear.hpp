@@ -52,6 +52,7 @@
 #include "./mpl.hpp"
 #include "./utils.hpp"
 #include "./type_traits.hpp"
+#include "./ops.hpp"
 #include "solvers_linear/solvers_linear_tags.hpp"
 #include "solvers_linear/solvers_linear_solver.hpp"
 
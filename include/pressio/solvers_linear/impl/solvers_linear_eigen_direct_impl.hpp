@@ -51,6 +51,24 @@
 
 namespace pressio { namespace linearsolvers{ namespace impl{
 
+// the tag of the solver to use if the factorization of TagType fails,
+// void if TagType has no fallback
+template<typename TagType, typename MatrixType, typename enable = void>
+struct eigen_direct_fallback_tag{
+  using type = void;
+};
+
+template<typename TagType, typename MatrixType>
+struct eigen_direct_fallback_tag<
+  TagType, MatrixType,
+  mpl::void_t<
+    typename ::pressio::linearsolvers::Traits<TagType>::template eigen_fallback_tag<MatrixType>
+    >
+  >
+{
+  using type = typename ::pressio::linearsolvers::Traits<TagType>::template eigen_fallback_tag<MatrixType>;
+};
+
 template<typename TagType, typename MatrixType>
 class EigenDirect
 {
@@ -70,14 +88,25 @@ public:
   ( solver_traits::direct == true,
     "the native eigen solver must be direct to use in EigenDirect");
 
+private:
+  using fallback_tag = typename eigen_direct_fallback_tag<TagType, MatrixType>::type;
+  static constexpr bool has_fallback = !std::is_void<fallback_tag>::value;
+  struct NoFallback{};
+  using fallback_solver_type = typename std::conditional<
+    has_fallback,
+    EigenDirect<typename std::conditional<has_fallback, fallback_tag, TagType>::type, MatrixType>,
+    NoFallback
+    >::type;
+
 public:
   void resetLinearSystem(const MatrixType& A) {
     mysolver_.compute(A);
+    this->resetFallback(std::integral_constant<bool, has_fallback>(), A);
   }
 
   template <typename T>
   void solve(const T& b, T & y) {
-    y = mysolver_.solve(b);
+    this->solveImpl(std::integral_constant<bool, has_fallback>(), b, y);
   }
 
   template <typename T>
@@ -92,8 +121,40 @@ public:
     this->solve(b, y);
   }
 
+  // true if the last factorization failed and the fallback solver is used
+  bool usingFallback() const {
+    return usingFallback_;
+  }
+
+private:
+  void resetFallback(std::false_type, const MatrixType & /*unused*/) {}
+
+  void resetFallback(std::true_type, const MatrixType & A) {
+    usingFallback_ = mysolver_.info() != Eigen::Success;
+    if (usingFallback_) {
+      PRESSIOLOG_DEBUG("linear solver factorization failed, using fallback");
+      fallback_.resetLinearSystem(A);
+    }
+  }
+
+  template <typename T>
+  void solveImpl(std::false_type, const T& b, T & y) {
+    y = mysolver_.solve(b);
+  }
+
+  template <typename T>
+  void solveImpl(std::true_type, const T& b, T & y) {
+    if (usingFallback_) {
+      fallback_.solve(b, y);
+    } else {
+      y = mysolver_.solve(b);
+    }
+  }
+
 private:
   native_solver_type mysolver_ = {};
+  fallback_solver_type fallback_ = {};
+  bool usingFallback_ = false;
 };
 
 }}} // end namespace pressio::solvers::linear::impl
@@ -53,17 +53,58 @@
 
 namespace pressio { namespace linearsolvers{ namespace impl{
 
-template<typename TagType, typename MatrixType>
+/* wraps an Eigen preconditioner so that its setup can be skipped:
+ * when refresh is off, compute/analyzePattern/factorize are no-ops
+ * and the preconditioner computed last is applied as is */
+template<typename PreconditionerType>
+class ReusablePreconditioner : public PreconditionerType
+{
+public:
+  ReusablePreconditioner() = default;
+
+  template<typename MatType>
+  explicit ReusablePreconditioner(const MatType & A) : PreconditionerType(A){}
+
+  template<typename MatType>
+  ReusablePreconditioner & analyzePattern(const MatType & A){
+    if (refresh_){ PreconditionerType::analyzePattern(A); }
+    return *this;
+  }
+
+  template<typename MatType>
+  ReusablePreconditioner & factorize(const MatType & A){
+    if (refresh_){ PreconditionerType::factorize(A); }
+    return *this;
+  }
+
+  template<typename MatType>
+  ReusablePreconditioner & compute(const MatType & A){
+    if (refresh_){ PreconditionerType::compute(A); }
+    return *this;
+  }
+
+  void setRefresh(bool value){ refresh_ = value; }
+
+private:
+  bool refresh_ = true;
+};
+
+template<typename TagType, typename MatrixType, typename PreconditionerTag = void>
 class EigenIterative
-  : public IterativeBase< EigenIterative<TagType, MatrixType>>
+  : public IterativeBase< EigenIterative<TagType, MatrixType, PreconditionerTag>>
 {
 
 public:
   using matrix_type	= MatrixType;
   using scalar_type        = typename MatrixType::Scalar;
-  using this_type          = EigenIterative<TagType, MatrixType>;
+  using this_type          = EigenIterative<TagType, MatrixType, PreconditionerTag>;
   using solver_traits   = ::pressio::linearsolvers::Traits<TagType>;
-  using native_solver_type = typename solver_traits::template eigen_solver_type<matrix_type>;
+  using preconditioner_traits =
+    ::pressio::linearsolvers::PreconditionerTraits<PreconditionerTag, TagType>;
+  using preconditioner_type = ReusablePreconditioner<
+    typename preconditioner_traits::template eigen_preconditioner_type<matrix_type>>;
+  using native_solver_type =
+    typename solver_traits::template eigen_solver_type<matrix_type, preconditioner_type>;
   using base_iterative_type  = IterativeBase<this_type>;
   using iteration_type = typename base_iterative_type::iteration_type;
 
@@ -71,7 +112,11 @@ public:
 		 "the native solver must be from Eigen to use in EigenIterative");
   static_assert( solver_traits::direct == false,
 		 "The native eigen solver must be iterative to use in EigenIterative");
-
+  static_assert( preconditioner_traits::eigen_enabled == true,
+		 "The preconditioner cannot be used with this iterative solver");
+  static_assert( !preconditioner_traits::requires_sparse_matrix or
+		 ::pressio::is_sparse_matrix_eigen<MatrixType>::value,
+		 "Incomplete factorization preconditioners require a sparse matrix");
 
 public:
   iteration_type numIterationsExecuted() const
@@ -84,17 +129,43 @@ public:
     return mysolver_.error();
   }
 
+  /* if enabled, solve(b, y) uses the incoming y as initial guess
+     (if it has the right size and is finite) instead of zero */
+  void setWarmStart(bool value){ warmStart_ = value; }
+
+  /* if enabled, the preconditioner is computed for the first matrix
+     and then reused for all subsequent ones until their size
+     (and for sparse matrices the number of nonzeros) changes */
+  void setPreconditionerReuse(bool value){ reusePreconditioner_ = value; }
+
   void resetLinearSystem(const MatrixType& A)
   {
     mysolver_.setMaxIterations(this->maxIters_);
-    mysolver_.compute(A);
+
+    const bool samePattern = isInitialized_ && hasSamePattern(A);
+    mysolver_.preconditioner().setRefresh(!(reusePreconditioner_ && samePattern));
+    if (samePattern){
+      // the symbolic part (e.g. the ordering) of the preconditioner
+      // only depends on the pattern, so we only redo the numerics
+      mysolver_.factorize(A);
+    }
+    else{
+      mysolver_.compute(A);
+    }
+    storePattern(A);
+    isInitialized_ = true;
   }
 
   template <typename T>
   void solve(const T& b, T & y)
   {
     mysolver_.setMaxIterations(this->maxIters_);
-    y = mysolver_.solve(b);
+    if (warmStart_ && y.size() == mysolver_.cols() && y.allFinite()){
+      y = mysolver_.solveWithGuess(b, y);
+    }
+    else{
+      y = mysolver_.solve(b);
+    }
   }
 
   template <typename T>
@@ -111,9 +182,40 @@ public:
     this->solve(b, y);
   }
 
+private:
+  template<class M = MatrixType>
+  std::enable_if_t< ::pressio::is_sparse_matrix_eigen<M>::value, bool >
+  hasSamePattern(const M & A) const{
+    return A.rows() == rows_ && A.cols() == cols_ && A.nonZeros() == nonZeros_;
+  }
+
+  template<class M = MatrixType>
+  std::enable_if_t< !::pressio::is_sparse_matrix_eigen<M>::value, bool >
+  hasSamePattern(const M & A) const{
+    return A.rows() == rows_ && A.cols() == cols_;
+  }
+
+  template<class M = MatrixType>
+  std::enable_if_t< ::pressio::is_sparse_matrix_eigen<M>::value >
+  storePattern(const M & A){
+    rows_ = A.rows(); cols_ = A.cols(); nonZeros_ = A.nonZeros();
+  }
+
+  template<class M = MatrixType>
+  std::enable_if_t< !::pressio::is_sparse_matrix_eigen<M>::value >
+  storePattern(const M & A){
+    rows_ = A.rows(); cols_ = A.cols();
+  }
+
 private:
   friend base_iterative_type;
   native_solver_type mysolver_ = {};
+  bool warmStart_ = false;
+  bool reusePreconditioner_ = false;
+  bool isInitialized_ = false;
+  Eigen::Index rows_ = 0;
+  Eigen::Index cols_ = 0;
+  Eigen::Index nonZeros_ = 0;
 };
 
 }}} // end namespace pressio::solvers::iterarive::impl
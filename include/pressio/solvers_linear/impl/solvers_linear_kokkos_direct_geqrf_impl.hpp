@@ -98,6 +98,44 @@ public:
   }
 
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
+  /*
+   * enable if:
+   * the matrix has layout left (i.e. column major)
+   */
+  template <typename _MatrixType = MatrixType>
+  std::enable_if_t<
+    std::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value
+  >
+  resetLinearSystem(const _MatrixType & A)
+  {
+    const auto Aext0 = A.extent(0);
+    const auto Aext1 = A.extent(1);
+    if (Aext0 != auxMat_.extent(0) or	Aext1 != auxMat_.extent(1)){
+    	Kokkos::resize(auxMat_, Aext0, Aext1);
+    }
+
+    Kokkos::deep_copy(auxMat_, A);
+    this->factorizeInPlace(auxMat_);
+  }
+
+  /*
+   * solve using the factorization computed by the last resetLinearSystem,
+   * so the same factorization can be used for multiple right-hand sides
+   *
+   * enable if:
+   * T is a kokkos vector
+   * T and MatrixType have same execution space
+   */
+  template <typename T>
+  std::enable_if_t<
+    ::pressio::is_vector_kokkos<T>::value
+    and std::is_same<typename T::traits::execution_space, typename MatrixType::traits::execution_space>::value
+  >
+  solve(const T& b, T & y)
+  {
+    this->solveWithFactors(auxMat_, b, y);
+  }
+
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
@@ -114,14 +152,8 @@ public:
   >
   solve(const _MatrixType & A, const T& b, T & y)
   {
-    const auto Aext0 = A.extent(0);
-    const auto Aext1 = A.extent(1);
-    if (Aext0 != auxMat_.extent(0) or	Aext1 != auxMat_.extent(1)){
-    	Kokkos::resize(auxMat_, Aext0, Aext1);
-    }
-
-    Kokkos::deep_copy(auxMat_, A);
-    this->solveAllowMatOverwrite(auxMat_, b, y);
+    this->resetLinearSystem(A);
+    this->solveWithFactors(auxMat_, b, y);
   }
 
   /*
@@ -139,40 +171,59 @@ public:
     and std::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
   >
   solveAllowMatOverwrite(_MatrixType & A, const T& b, T & y)
+  {
+    this->factorizeInPlace(A);
+    this->solveWithFactors(A, b, y);
+  }
+#endif
+
+
+private:
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+  template <typename _MatrixType>
+  void factorizeInPlace(_MatrixType & A)
   {
     // gerts is for square matrices
     assert(A.extent(0) == A.extent(1));
 
-    assert(A.extent(0) == b.extent(0) );
-    assert(A.extent(1) == y.extent(0) );
-
-    // only one rhs 
-    constexpr int nRhs = 1;
     // just use n, since rows == cols
-    const auto n = A.extent(0);
+    const int n = A.extent(0);
 
     // to store the return code of the function
     int info = 0;
 
-    if (tau_.size() != n){
+    if (n != n_){
+      // the size changed (or this is the first call), so we need
+      // to query what lwork should be and resize "work_" properly.
+      // lwork == -1 means a query, the optimal size is in work_[0].
+      // This only happens once for a given n, so no allocations
+      // occur when repeatedly solving systems of the same size.
       tau_.resize(n);
+      work_.resize(1);
+      int lwork = -1;
+      lpk_.GEQRF(n, n, A.data(), n, tau_.data(), work_.data(), lwork, &info);
+      lwork_ = std::max(static_cast<int>(work_[0]), std::max(1, n));
+      work_.resize(lwork_);
+      n_ = n;
     }
 
-    if (lwork_ == -1){
-      // this means we need to query what lwork should be
-      // and resize the work array "work_" properly
-      lpk_.GEQRF(n, n, A.data(), n, tau_.data(), work_.data(), lwork_, &info);
-      work_.resize(work_[0]);
-      lwork_ = work_[0];
-    }
     // do QR
     lpk_.GEQRF(n, n, A.data(), n, tau_.data(), work_.data(), lwork_, &info);
     assert(info == 0);
-    // std::cout << " info " << info
-    // 	      << " lwork " << lwork_
-    // 	      << " workSz " << work_.size() << std::endl;
+  }
+
+  template <typename _MatrixType, typename T>
+  void solveWithFactors(const _MatrixType & QR, const T& b, T & y)
+  {
+    assert(QR.extent(0) == b.extent(0) );
+    assert(QR.extent(1) == y.extent(0) );
+    assert(static_cast<int>(QR.extent(0)) == n_);
+
+    // only one rhs
+    constexpr int nRhs = 1;
+    const int n = n_;
+    int info = 0;
 
-    // Note that A is overwritten starting from here!
     // we need to deep copy b into y and pass y to ormqr
     // because it is overwritten with Q^T b
     Kokkos::deep_copy(y, b);
@@ -181,7 +232,7 @@ public:
     const char side = 'L';
     const char trans = 'T';
     lpk_.ORMQR(side, trans, n, nRhs, n,
-    	       A.data(),
+    	       QR.data(),
     	       n,
     	       tau_.data(),
     	       y.data(),
@@ -189,7 +240,7 @@ public:
     	       work_.data(),
     	       lwork_,
     	       &info);
-    //std::cout << " info-ormqr " << info << std::endl;
+    assert(info == 0);
 
     // solver R y = Q^T b
     constexpr scalar_type alpha = ::pressio::utils::Constants<scalar_type>::one();
@@ -198,13 +249,9 @@ public:
     	       Teuchos::ETransp::NO_TRANS,
     	       Teuchos::EDiag::NON_UNIT_DIAG,
     	       n, nRhs, alpha,
-    	       A.data(), n, y.data(), n);
+    	       QR.data(), n, y.data(), n);
   }
-#endif
 
-
-private:
-#ifdef PRESSIO_ENABLE_TPL_TRILINOS
   Teuchos::LAPACK<int, scalar_type> lpk_;
   Teuchos::BLAS<int, scalar_type> blas_;
 
@@ -212,6 +259,8 @@ private:
   // if lwork == -1, then geqrf does a query of what is needed.
   // more details are shown in the code above on how we use lwork
   int lwork_ = -1;
+  // the size of the system lwork_, work_ and tau_ are set up for
+  int n_ = -1;
 
   std::vector<scalar_type> work_ = {0};
   std::vector<scalar_type> tau_ = {};
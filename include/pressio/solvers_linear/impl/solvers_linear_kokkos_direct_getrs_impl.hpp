@@ -100,18 +100,12 @@ public:
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
-   * T is a kokkos vector 
-   * has host execution space
-   * T and MatrixType have same execution space
    */
-  template < typename _MatrixType = MatrixType, typename T>
+  template < typename _MatrixType = MatrixType>
   std::enable_if_t<
-    std::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
-    and ::pressio::is_vector_kokkos<T>::value 
-    /*::pressio::containers::details::traits<T>::has_host_execution_space and*/
-    and std::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+    std::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value
   >
-  solve(const _MatrixType & A, const T& b, T & y)
+  resetLinearSystem(const _MatrixType & A)
   {
     const auto Aext0 = A.extent(0);
     const auto Aext1 = A.extent(1);
@@ -121,9 +115,26 @@ public:
     }
 
     Kokkos::deep_copy(auxMat_, A);
-    this->solveAllowMatOverwrite(auxMat_, b, y);
+    this->factorizeInPlace(auxMat_);
   }
 
+  /*
+   * solve using the factorization computed by the last resetLinearSystem,
+   * so the same factorization can be used for multiple right-hand sides
+   *
+   * enable if:
+   * T is a kokkos vector
+   * T and MatrixType have same execution space
+   */
+  template <typename T>
+  std::enable_if_t<
+    ::pressio::is_vector_kokkos<T>::value
+    and std::is_same<typename T::traits::execution_space, typename MatrixType::traits::execution_space>::value
+  >
+  solve(const T& b, T & y)
+  {
+    this->solveWithFactors(auxMat_, b, y);
+  }
 
   /*
    * enable if:
@@ -139,34 +150,31 @@ public:
     /*::pressio::containers::details::traits<T>::has_host_execution_space and*/
     and std::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
   >
-  solveAllowMatOverwrite(_MatrixType & A, const T& b, T & y)
+  solve(const _MatrixType & A, const T& b, T & y)
   {
-    assert(A.extent(0) == b.extent(0) );
-    assert(A.extent(1) == y.extent(0) );
-    // gerts is for square matrices
-    assert(A.extent(0) == A.extent(1) );
-
-    // only one rhs
-    constexpr int nRhs = 1;
-    // just use n, since rows == cols
-    const auto n = A.extent(0);
-
-    int info = 0;
-    const int ipivSz = n;
-    // this needs to be moved out, does not make sense to construct it every time
-    std::vector<int> ipiv(ipivSz);
-
-    // LU factorize using GETRF
-    lpk_.GETRF(n, n, A.data(), n, ipiv.data(), &info);
-    assert(info == 0);
+    this->resetLinearSystem(A);
+    this->solveWithFactors(auxMat_, b, y);
+  }
 
-    // we need to deep copy b into y and pass y
-    // because getrs overwrite the RHS in place with the solution
-    Kokkos::deep_copy(y, b);
 
-    const char ct = 'N';
-    lpk_.GETRS(ct, n, nRhs, A.data(), n, ipiv.data(), y.data(), y.extent(0), &info);
-    assert(info == 0);
+  /*
+   * enable if:
+   * the matrix has layout left (i.e. column major)
+   * T is a kokkos vector 
+   * has host execution space
+   * T and MatrixType have same execution space
+   */
+  template < typename _MatrixType = MatrixType, typename T>
+  std::enable_if_t<
+    std::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
+    and ::pressio::is_vector_kokkos<T>::value 
+    /*::pressio::containers::details::traits<T>::has_host_execution_space and*/
+    and std::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+  >
+  solveAllowMatOverwrite(_MatrixType & A, const T& b, T & y)
+  {
+    this->factorizeInPlace(A);
+    this->solveWithFactors(A, b, y);
   }
 #endif
 
@@ -181,7 +189,7 @@ public:
    */
   template < typename _MatrixType = MatrixType, typename T>
   std::enable_if_t<
-    std::is_same<typename wrapped_type::traits::array_layout, Kokkos::LayoutLeft>::value 
+    std::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
     and ::pressio::is_vector_kokkos<T>::value 
     /*and ::pressio::containers::details::traits<T>::has_host_execution_space and*/
     and std::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
@@ -202,26 +210,23 @@ public:
     cusolverStatus_t cusolverStatus;
     //cusolverDnHandle_t handle;
     cudaError cudaStatus;
-    int Lwork = 0;
 
     // cuDnHandle already created in constructor
 
-    // compute buffer size and prep.memory
-    cusolverStatus = cusolverDnDgetrf_bufferSize(cuDnHandle_, n, n, A.data(), n, &Lwork);
-    assert(cusolverStatus == CUSOLVER_STATUS_SUCCESS);
-
-    // for now, working buffers are stored as Kokkos arrays but
-    // maybe later we can use directly cuda allocations
-    using k1d_d = Kokkos::View<scalar_type*, Kokkos::LayoutLeft, exe_space>;
-    using k1di_d = Kokkos::View<int*, Kokkos::LayoutLeft, exe_space>;
-    k1d_d work_d("d_work", Lwork);
-    k1di_d pivot_d("d_pivot", n);
-    k1di_d info_d("d_info", 1);
+    // the working buffers are kept across calls: the buffer size
+    // is only queried and the buffers only resized if n changes
+    if (pivot_d_.extent(0) != n){
+      int Lwork = 0;
+      cusolverStatus = cusolverDnDgetrf_bufferSize(cuDnHandle_, n, n, A.data(), n, &Lwork);
+      assert(cusolverStatus == CUSOLVER_STATUS_SUCCESS);
+      Kokkos::resize(work_d_, Lwork);
+      Kokkos::resize(pivot_d_, n);
+    }
 
     cusolverStatus = cusolverDnDgetrf(cuDnHandle_, n, n, A.data(), n,
-                                      work_d.data(),
-				                              pivot_d.data(),
-    				                          info_d.data());
+                                      work_d_.data(),
+				                              pivot_d_.data(),
+    				                          info_d_.data());
     assert(cusolverStatus == CUSOLVER_STATUS_SUCCESS);
 
     // we need to deep copy b into y and pass y
@@ -231,9 +236,9 @@ public:
     cusolverStatus = cusolverDnDgetrs(cuDnHandle_, CUBLAS_OP_N,
     				      n, nRhs,
     				      A.data(), n,
-    				      pivot_d.data(),
+    				      pivot_d_.data(),
     				      y.data(), n,
-    				      info_d.data());
+    				      info_d_.data());
     assert(cusolverStatus == CUSOLVER_STATUS_SUCCESS);
 
     // make sure the solver kernel is done before exiting
@@ -241,14 +246,65 @@ public:
   }
 #endif
 
+private:
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
+  template <typename _MatrixType>
+  void factorizeInPlace(_MatrixType & A)
+  {
+    // gerts is for square matrices
+    assert(A.extent(0) == A.extent(1) );
+
+    // just use n, since rows == cols
+    const auto n = A.extent(0);
+
+    // the pivots are kept across calls, only resized if n changes
+    if (ipiv_.size() != n){
+      ipiv_.resize(n);
+    }
+
+    // LU factorize using GETRF
+    int info = 0;
+    lpk_.GETRF(n, n, A.data(), n, ipiv_.data(), &info);
+    assert(info == 0);
+  }
+
+  template <typename _MatrixType, typename T>
+  void solveWithFactors(const _MatrixType & LU, const T& b, T & y)
+  {
+    assert(LU.extent(0) == b.extent(0) );
+    assert(LU.extent(1) == y.extent(0) );
+    assert(LU.extent(0) == ipiv_.size() );
+
+    // only one rhs
+    constexpr int nRhs = 1;
+    const auto n = LU.extent(0);
+
+    // we need to deep copy b into y and pass y
+    // because getrs overwrite the RHS in place with the solution
+    Kokkos::deep_copy(y, b);
+
+    int info = 0;
+    const char ct = 'N';
+    lpk_.GETRS(ct, n, nRhs, LU.data(), n, ipiv_.data(), y.data(), y.extent(0), &info);
+    assert(info == 0);
+  }
+
   Teuchos::LAPACK<int, scalar_type> lpk_;
 
+  // pivots of the last factorization
+  std::vector<int> ipiv_ = {};
+
   MatrixType auxMat_ = {};
 #endif
 
 #if defined PRESSIO_ENABLE_TPL_KOKKOS and defined KOKKOS_ENABLE_CUDA
   cusolverDnHandle_t cuDnHandle_;
+
+  // for now, working buffers are stored as Kokkos arrays but
+  // maybe later we can use directly cuda allocations
+  Kokkos::View<scalar_type*, Kokkos::LayoutLeft, exe_space> work_d_ = {};
+  Kokkos::View<int*, Kokkos::LayoutLeft, exe_space> pivot_d_ = {};
+  Kokkos::View<int*, Kokkos::LayoutLeft, exe_space> info_d_{"d_info", 1};
 #endif
 };
 
@@ -86,6 +86,45 @@ public:
 // because this uses teuchos lapack wrapper
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
 
+  /*
+   * enable if:
+   * the matrix has layout left (i.e. column major)
+   */
+  template < typename _MatrixType = MatrixType>
+  std::enable_if_t<
+    std::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value
+  >
+  resetLinearSystem(const _MatrixType & A)
+  {
+    const auto Aext0 = A.extent(0);
+    const auto Aext1 = A.extent(1);
+    if (Aext0 != auxMat_.extent(0) or Aext1 != auxMat_.extent(1))
+    {
+      Kokkos::resize(auxMat_, Aext0, Aext1);
+    }
+
+    Kokkos::deep_copy(auxMat_, A);
+    this->factorizeInPlace(auxMat_);
+  }
+
+  /*
+   * solve using the factorization computed by the last resetLinearSystem,
+   * so the same factorization can be used for multiple right-hand sides
+   *
+   * enable if:
+   * T is a kokkos vector
+   * T and MatrixType have same execution space
+   */
+  template <typename T>
+  std::enable_if_t<
+    ::pressio::is_vector_kokkos<T>::value
+    and std::is_same<typename T::traits::execution_space, typename MatrixType::traits::execution_space>::value
+  >
+  solve(const T& b, T & y)
+  {
+    this->solveWithFactors(auxMat_, b, y);
+  }
+
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
@@ -102,15 +141,8 @@ public:
   >
   solve(const _MatrixType & A, const T& b, T & y)
   {
-    const auto Aext0 = A.extent(0);
-    const auto Aext1 = A.extent(1);
-    if (Aext0 != auxMat_.extent(0) or Aext1 != auxMat_.extent(1))
-    {
-      Kokkos::resize(auxMat_, Aext0, Aext1);
-    }
-
-    Kokkos::deep_copy(auxMat_, A);
-    this->solveAllowMatOverwrite(auxMat_, b, y);
+    this->resetLinearSystem(A);
+    this->solveWithFactors(auxMat_, b, y);
   }
 
 
@@ -130,14 +162,21 @@ public:
   >
   solveAllowMatOverwrite(_MatrixType & A, const T& b, T & y)
   {
-    assert(A.extent(0) == b.extent(0) );
-    assert(A.extent(1) == y.extent(0) );
+    this->factorizeInPlace(A);
+    this->solveWithFactors(A, b, y);
+  }
+#endif
+
+private:
+  const char uplo_ = 'U';
 
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+  template <typename _MatrixType>
+  void factorizeInPlace(_MatrixType & A)
+  {
     // potrs is for symmetric pos def
     assert(A.extent(0) == A.extent(1) );
 
-    // only one rhs
-    constexpr int nRhs = 1;
     // just use n, since rows == cols
     const auto n = A.extent(0);
 
@@ -145,19 +184,27 @@ public:
     int info = 0;
     lpk_.POTRF(uplo_, n, A.data(), n, &info);
     assert(info == 0);
+  }
+
+  template <typename _MatrixType, typename T>
+  void solveWithFactors(const _MatrixType & C, const T& b, T & y)
+  {
+    assert(C.extent(0) == b.extent(0) );
+    assert(C.extent(1) == y.extent(0) );
+
+    // only one rhs
+    constexpr int nRhs = 1;
+    const auto n = C.extent(0);
 
     // we need to deep copy b into y and pass y
     // because we overwrite the RHS in place with the solution
     Kokkos::deep_copy(y, b);
 
-    lpk_.POTRS(uplo_, n, nRhs, A.data(), n, y.data(), y.extent(0), &info);
+    int info = 0;
+    lpk_.POTRS(uplo_, n, nRhs, C.data(), n, y.data(), y.extent(0), &info);
     assert(info == 0);
   }
-#endif
 
-  const char uplo_ = 'U';
-
-#ifdef PRESSIO_ENABLE_TPL_TRILINOS
   Teuchos::LAPACK<int, scalar_type> lpk_;
   MatrixType auxMat_ = {};
 #endif
@@ -0,0 +1,266 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// solvers_linear_matrix_free_gmres_impl.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_MATRIX_FREE_GMRES_IMPL_HPP_
+#define SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_MATRIX_FREE_GMRES_IMPL_HPP_
+
+#include "solvers_linear_iterative_base.hpp"
+
+namespace pressio { namespace linearsolvers{ namespace impl{
+
+struct IdentityPreconditioner
+{
+  template<class T>
+  void operator()(const T & v, T & z) const{
+    ::pressio::ops::deep_copy(z, v);
+  }
+};
+
+/*
+  Restarted GMRES only accessing the operator through its action:
+    A(v, Av) computes Av = A*v
+  and, optionally, the right preconditioner:
+    M(v, z) computes z = M^{-1}*v
+  so that the matrix never needs to be formed.
+
+  The Krylov basis is allocated at the first solve as restart+1 clones
+  of the right hand side and reused for all subsequent solves.
+  Only the ops (dot, norm2, update, scale, deep_copy, clone) are needed,
+  so this works for any vector type supported by pressio.
+*/
+template<typename VectorType>
+class MatrixFreeGmres
+  : public IterativeBase< MatrixFreeGmres<VectorType> >
+{
+public:
+  using vector_type    = VectorType;
+  using scalar_type    = typename ::pressio::Traits<VectorType>::scalar_type;
+  using this_type      = MatrixFreeGmres<VectorType>;
+  using base_iterative_type = IterativeBase<this_type>;
+  using iteration_type = typename base_iterative_type::iteration_type;
+
+private:
+  friend base_iterative_type;
+  iteration_type restart_ = 30;
+  scalar_type tolerance_ = static_cast<scalar_type>(1e-8);
+  iteration_type iterations_ = 0;
+  scalar_type finalError_ = {};
+
+  std::vector<VectorType> basis_;
+  std::vector<VectorType> work_;
+  // (restart+1) x restart Hessenberg, stored column-major
+  std::vector<scalar_type> H_;
+  std::vector<scalar_type> cs_;
+  std::vector<scalar_type> sn_;
+  std::vector<scalar_type> g_;
+
+public:
+  iteration_type numIterationsExecuted() const { return iterations_; }
+
+  // relative residual ||b - A x|| / ||b|| achieved by the last solve
+  scalar_type finalError() const { return finalError_; }
+
+  // stop when ||b - A x|| <= tolerance * ||b||
+  void setTolerance(scalar_type value) { tolerance_ = value; }
+  scalar_type tolerance() const { return tolerance_; }
+
+  void setRestart(iteration_type value){
+    if (value < 1){
+      throw std::runtime_error("The GMRES restart must be >= 1");
+    }
+    restart_ = value;
+  }
+  iteration_type restart() const { return restart_; }
+
+  template <typename OperatorType>
+  void solve(const OperatorType & A, const VectorType & b, VectorType & x)
+  {
+    this->solve(A, IdentityPreconditioner{}, b, x);
+  }
+
+  template <typename OperatorType, typename PreconditionerType>
+  void solve(const OperatorType & A,
+	     const PreconditionerType & M,
+	     const VectorType & b,
+	     VectorType & x)
+  {
+    constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+
+    allocate(b);
+    auto & w = work_[0];
+    auto & z = work_[1];
+    iterations_ = 0;
+
+    const auto bNorm = ::pressio::ops::norm2(b);
+    if (bNorm == zero){
+      ::pressio::ops::set_zero(x);
+      finalError_ = zero;
+      return;
+    }
+
+    bool converged = false;
+    while (!converged && iterations_ < this->maxIters_)
+    {
+      // r0 = b - A x
+      A(x, w);
+      ::pressio::ops::update(w, -one, b, one);
+      const auto beta = ::pressio::ops::norm2(w);
+      finalError_ = beta/bNorm;
+      if (finalError_ <= tolerance_){
+	break;
+      }
+
+      ::pressio::ops::deep_copy(basis_[0], w);
+      ::pressio::ops::scale(basis_[0], one/beta);
+      std::fill(g_.begin(), g_.end(), zero);
+      g_[0] = beta;
+
+      iteration_type k = 0;
+      while (k < restart_ && iterations_ < this->maxIters_)
+      {
+	// w = A M^{-1} v_k
+	M(basis_[k], z);
+	A(z, w);
+
+	// modified Gram-Schmidt
+	for (iteration_type i=0; i<=k; ++i){
+	  h(i,k) = ::pressio::ops::dot(w, basis_[i]);
+	  ::pressio::ops::update(w, one, basis_[i], -h(i,k));
+	}
+	h(k+1,k) = ::pressio::ops::norm2(w);
+	// a zero norm means the Krylov space is invariant: the solution is exact
+	const bool breakdown = (h(k+1,k) == zero);
+	if (!breakdown){
+	  ::pressio::ops::deep_copy(basis_[k+1], w);
+	  ::pressio::ops::scale(basis_[k+1], one/h(k+1,k));
+	}
+
+	applyGivensRotations(k);
+	++k;
+	++iterations_;
+
+	finalError_ = std::abs(g_[k])/bNorm;
+	if (finalError_ <= tolerance_ || breakdown){
+	  converged = true;
+	  break;
+	}
+      }
+
+      updateSolution(k, M, x);
+    }
+  }
+
+private:
+  scalar_type & h(iteration_type i, iteration_type j){
+    return H_[i + j*(restart_+1)];
+  }
+
+  void allocate(const VectorType & b)
+  {
+    const bool mustAllocate = basis_.size() != restart_+1 ||
+      ::pressio::ops::extent(basis_[0], 0) != ::pressio::ops::extent(b, 0);
+    if (mustAllocate){
+      basis_.clear();
+      work_.clear();
+      for (iteration_type i=0; i<=restart_; ++i){
+	basis_.push_back(::pressio::ops::clone(b));
+      }
+      work_.push_back(::pressio::ops::clone(b));
+      work_.push_back(::pressio::ops::clone(b));
+      H_.assign((restart_+1)*restart_, {});
+      cs_.assign(restart_, {});
+      sn_.assign(restart_, {});
+      g_.assign(restart_+1, {});
+    }
+  }
+
+  // turn the k-th column of the Hessenberg into upper triangular form
+  void applyGivensRotations(iteration_type k)
+  {
+    for (iteration_type i=0; i<k; ++i){
+      const auto tmp = cs_[i]*h(i,k) + sn_[i]*h(i+1,k);
+      h(i+1,k) = -sn_[i]*h(i,k) + cs_[i]*h(i+1,k);
+      h(i,k) = tmp;
+    }
+
+    const auto denom = std::sqrt(h(k,k)*h(k,k) + h(k+1,k)*h(k+1,k));
+    cs_[k] = h(k,k)/denom;
+    sn_[k] = h(k+1,k)/denom;
+    h(k,k) = denom;
+    h(k+1,k) = {};
+    g_[k+1] = -sn_[k]*g_[k];
+    g_[k]   = cs_[k]*g_[k];
+  }
+
+  // x += M^{-1} V_k y, where R_k y = g_k
+  template <typename PreconditionerType>
+  void updateSolution(iteration_type k, const PreconditionerType & M, VectorType & x)
+  {
+    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+    for (iteration_type ii=k; ii-- > 0; ){
+      auto sum = g_[ii];
+      for (iteration_type j=ii+1; j<k; ++j){
+	sum -= h(ii,j)*g_[j];
+      }
+      g_[ii] = sum/h(ii,ii);
+    }
+
+    auto & w = work_[0];
+    auto & z = work_[1];
+    ::pressio::ops::set_zero(w);
+    for (iteration_type i=0; i<k; ++i){
+      ::pressio::ops::update(w, one, basis_[i], g_[i]);
+    }
+    M(w, z);
+    ::pressio::ops::update(x, one, z, one);
+  }
+};
+
+}}} // end namespace pressio::linearsolvers::impl
+#endif  // SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_MATRIX_FREE_GMRES_IMPL_HPP_
@@ -63,15 +63,17 @@
 namespace pressio{ namespace linearsolvers{ namespace impl{
 
 
-template<typename TagType, typename MatrixType, typename enable = void>
+template<
+  typename TagType, typename MatrixType,
+  typename PreconditionerTag = void, typename enable = void>
 struct Selector{
   using type = void;
 };
 
 #ifdef PRESSIO_ENABLE_TPL_EIGEN
-template<typename TagType, typename MatrixType>
+template<typename TagType, typename MatrixType, typename PreconditionerTag>
 struct Selector<
-  TagType, MatrixType,
+  TagType, MatrixType, PreconditionerTag,
   std::enable_if_t<
     ::pressio::linearsolvers::Traits<TagType>::iterative and
     (::pressio::is_dense_matrix_eigen<MatrixType>::value or
@@ -80,12 +82,13 @@ struct Selector<
   >
 {
   using solver_traits = ::pressio::linearsolvers::Traits<TagType>;
-  using type = ::pressio::linearsolvers::impl::EigenIterative<TagType, MatrixType>;
+  using type = ::pressio::linearsolvers::impl::EigenIterative<
+    TagType, MatrixType, PreconditionerTag>;
 };
 
 template<typename TagType, typename MatrixType>
 struct Selector<
-  TagType, MatrixType,
+  TagType, MatrixType, void,
   std::enable_if_t<
     ::pressio::linearsolvers::Traits<TagType>::direct and
     (::pressio::is_dense_matrix_eigen<MatrixType>::value or
@@ -100,7 +103,7 @@ struct Selector<
 #ifdef PRESSIO_ENABLE_TPL_KOKKOS
 template<typename TagType, typename MatrixType>
 struct Selector<
-  TagType, MatrixType,
+  TagType, MatrixType, void,
   std::enable_if_t<
     ::pressio::linearsolvers::Traits<TagType>::direct and
     (::pressio::is_dense_matrix_kokkos<MatrixType>::value)
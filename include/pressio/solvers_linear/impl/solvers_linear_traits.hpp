@@ -54,8 +54,10 @@
 #include <Eigen/IterativeLinearSolvers>
 #include <Eigen/Householder>
 #include <Eigen/QR>
+#include <Eigen/Cholesky>
 #include <Eigen/Sparse>
 #include <Eigen/SparseQR>
+#include <Eigen/SparseCholesky>
 #include <Eigen/OrderingMethods>
 #endif
 
@@ -124,6 +126,72 @@ struct Traits<::pressio::linearsolvers::iterative::LSCG>
 #endif
 };
 
+/* preconditioners for the iterative solvers:
+ * void means the default one, i.e. Jacobi, which for LSCG is the
+ * diagonal of A^T A since that is the operator CG actually sees.
+ * The incomplete factorizations need a sparse matrix. IncompleteCholesky
+ * is only meaningful for CG since A must be SPD, while IncompleteLUT is
+ * only for Bicgstab since CG needs a symmetric preconditioner. */
+template <typename PrecTag, typename SolverTag>
+struct PreconditionerTraits
+{
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  static constexpr bool eigen_enabled = false;
+#endif
+};
+
+template <typename SolverTag>
+struct PreconditionerTraits<::pressio::linearsolvers::preconditioner::Jacobi, SolverTag>
+{
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  template <typename MatrixT>
+  using eigen_preconditioner_type =
+    typename std::conditional<
+      std::is_same<SolverTag, ::pressio::linearsolvers::iterative::LSCG>::value,
+      Eigen::LeastSquareDiagonalPreconditioner<typename MatrixT::Scalar>,
+      Eigen::DiagonalPreconditioner<typename MatrixT::Scalar>
+      >::type;
+
+  static constexpr bool eigen_enabled = true;
+  static constexpr bool requires_sparse_matrix = false;
+#endif
+};
+
+template <typename SolverTag>
+struct PreconditionerTraits<void, SolverTag>
+  : PreconditionerTraits<::pressio::linearsolvers::preconditioner::Jacobi, SolverTag>{};
+
+template <typename SolverTag>
+struct PreconditionerTraits<::pressio::linearsolvers::preconditioner::IncompleteLUT, SolverTag>
+{
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  template <typename MatrixT>
+  using eigen_preconditioner_type =
+    Eigen::IncompleteLUT<typename MatrixT::Scalar, typename MatrixT::StorageIndex>;
+
+  // ILUT is not symmetric, so it cannot precondition CG
+  static constexpr bool eigen_enabled =
+    std::is_same<SolverTag, ::pressio::linearsolvers::iterative::Bicgstab>::value;
+  static constexpr bool requires_sparse_matrix = true;
+#endif
+};
+
+template <typename SolverTag>
+struct PreconditionerTraits<::pressio::linearsolvers::preconditioner::IncompleteCholesky, SolverTag>
+{
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  template <typename MatrixT>
+  using eigen_preconditioner_type =
+    Eigen::IncompleteCholesky<
+      typename MatrixT::Scalar, Eigen::Lower,
+      Eigen::AMDOrdering<typename MatrixT::StorageIndex>>;
+
+  static constexpr bool eigen_enabled =
+    std::is_same<SolverTag, ::pressio::linearsolvers::iterative::CG>::value;
+  static constexpr bool requires_sparse_matrix = true;
+#endif
+};
+
 template <>
 struct Traits<::pressio::linearsolvers::direct::ColPivHouseholderQR>
 {
@@ -180,6 +248,61 @@ struct Traits<::pressio::linearsolvers::direct::PartialPivLU>
 #endif
 };
 
+/* Cholesky-type solvers for symmetric systems (e.g. normal equations).
+ * Only the lower triangle of the matrix is used.
+ * If the factorization fails (e.g. the matrix is not positive definite),
+ * the solver falls back to the one given by eigen_fallback_tag:
+ * LLT -> LDLT -> LU (dense) or QR (sparse).
+ */
+template <>
+struct Traits<::pressio::linearsolvers::direct::LLT>
+{
+  static constexpr bool iterative = false;
+  static constexpr bool direct = true;
+
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  template <typename MatrixT>
+  using eigen_solver_type =
+    typename std::conditional<
+      pressio::is_sparse_matrix_eigen<MatrixT>::value,
+      Eigen::SimplicialLLT<MatrixT, Eigen::Lower>,
+      Eigen::LLT<MatrixT, Eigen::Lower>
+      >::type;
+
+  template <typename MatrixT>
+  using eigen_fallback_tag = ::pressio::linearsolvers::direct::LDLT;
+
+  static constexpr bool eigen_enabled = true;
+#endif
+};
+
+template <>
+struct Traits<::pressio::linearsolvers::direct::LDLT>
+{
+  static constexpr bool iterative = false;
+  static constexpr bool direct = true;
+
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  template <typename MatrixT>
+  using eigen_solver_type =
+    typename std::conditional<
+      pressio::is_sparse_matrix_eigen<MatrixT>::value,
+      Eigen::SimplicialLDLT<MatrixT, Eigen::Lower>,
+      Eigen::LDLT<MatrixT, Eigen::Lower>
+      >::type;
+
+  template <typename MatrixT>
+  using eigen_fallback_tag =
+    typename std::conditional<
+      pressio::is_sparse_matrix_eigen<MatrixT>::value,
+      ::pressio::linearsolvers::direct::ColPivHouseholderQR,
+      ::pressio::linearsolvers::direct::PartialPivLU
+      >::type;
+
+  static constexpr bool eigen_enabled = true;
+#endif
+};
+
 template <>
 struct Traits<::pressio::linearsolvers::direct::potrsL>
 {
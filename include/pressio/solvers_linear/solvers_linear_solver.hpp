@@ -51,11 +51,16 @@
 
 #include "./impl/solvers_linear_traits.hpp"
 #include "./impl/solvers_linear_solver_selector_impl.hpp"
+#include "./impl/solvers_linear_matrix_free_gmres_impl.hpp"
 
 namespace pressio{ namespace linearsolvers{
 
 template<typename TagType, typename MatrixType, typename ... Args>
 using Solver = typename impl::Selector<TagType, MatrixType, Args...>::type;
 
+// GMRES that only needs the action of the operator, see impl for details
+template<typename VectorType>
+using MatrixFreeGmres = impl::MatrixFreeGmres<VectorType>;
+
 }}
 #endif  // SOLVERS_LINEAR_SOLVERS_LINEAR_SOLVER_HPP_
@@ -57,10 +57,18 @@ struct LSCG {};
 struct Bicgstab {};
 }
 
+namespace preconditioner{
+struct Jacobi {};
+struct IncompleteLUT {};
+struct IncompleteCholesky {};
+}
+
 namespace direct{
 struct HouseholderQR {};
 struct ColPivHouseholderQR {};
 struct PartialPivLU {};
+struct LLT {};
+struct LDLT {};
 struct potrsL {};
 struct potrsU {};
 struct getrs{};
@@ -53,5 +53,6 @@
 #include "./solvers_nonlinear_newton.hpp"
 #include "./solvers_nonlinear_gaussnewton.hpp"
 #include "./solvers_nonlinear_levmarq.hpp"
+#include "./solvers_nonlinear_broyden.hpp"
 
 #endif
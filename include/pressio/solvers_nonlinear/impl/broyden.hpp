@@ -0,0 +1,301 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// broyden.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_NONLINEAR_IMPL_BROYDEN_HPP_
+#define SOLVERS_NONLINEAR_IMPL_BROYDEN_HPP_
+
+namespace pressio{
+namespace nonlinearsolvers{
+namespace impl{
+
+/*
+  Limited-memory inverse Broyden update for the root finders.
+
+  The inverse Jacobian is approximated as H_k = H_0 + sum of rank-1 terms,
+  where H_0 = J_0^{-1} is applied by means of the linear solver using the
+  Jacobian J_0 (and possibly its factorization) from the last time the
+  Jacobian was evaluated. Only vectors are stored, so the cost of an
+  update is a few dot products and axpys, and no dense n x n matrix is
+  ever formed. The history is restarted whenever the Jacobian is
+  re-evaluated, which bounds the memory to the Jacobian update frequency.
+
+  With s = x_k+1 - x_k and y = r_k+1 - r_k:
+
+  - "good" Broyden (rank-1 update of J, inverted via Sherman-Morrison):
+      H_k+1 = H_k + (s - H_k y) (s^T H_k) / (s^T H_k y)
+    we store u_i = (s - H_i y)/(s^T H_i y) and s_i, and apply recursively:
+      z = H_0 v,  z += u_i (s_i^T z),  for i = 0,1,...
+
+  - "bad" Broyden (rank-1 update of H directly):
+      H_k+1 = H_k + (s - H_k y) y^T / (y^T y)
+    we store u_i = (s - H_i y)/(y^T y) and y_i, and apply:
+      z = H_0 v + sum_i u_i (y_i^T v)
+*/
+template<class StateType, class ResidualType>
+class LimitedMemoryInverseBroyden
+{
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+
+  StateType xPrev_;
+  StateType s_;
+  StateType Hy_;
+  ResidualType rPrev_;
+  ResidualType y_;
+  bool hasPrevious_ = false;
+
+  std::vector<StateType> u_;
+  // only one of these is populated depending on the variant
+  std::vector<StateType> sHistory_;
+  std::vector<ResidualType> yHistory_;
+
+public:
+  LimitedMemoryInverseBroyden(const StateType & state,
+			      const ResidualType & residual)
+    : xPrev_(::pressio::ops::clone(state)),
+      s_(::pressio::ops::clone(state)),
+      Hy_(::pressio::ops::clone(state)),
+      rPrev_(::pressio::ops::clone(residual)),
+      y_(::pressio::ops::clone(residual)){}
+
+  std::size_t numUpdates() const{ return u_.size(); }
+
+  // the previous iterate must not be used across different solves
+  void forgetPreviousIterate(){ hasPrevious_ = false; }
+
+  // the Jacobian has been evaluated at (x,r): H_0 is reset to J^{-1}
+  void restart(const StateType & x, const ResidualType & r)
+  {
+    u_.clear();
+    sHistory_.clear();
+    yHistory_.clear();
+    storeIterate(x, r);
+  }
+
+  template<class VariantTag, class SolverType, class JacobianType>
+  void update(VariantTag tag,
+	      const StateType & x,
+	      const ResidualType & r,
+	      SolverType & solver,
+	      const JacobianType & J0)
+  {
+    if (!hasPrevious_){
+      storeIterate(x, r);
+      return;
+    }
+
+    constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+    ::pressio::ops::update(s_, static_cast<scalar_type>(0), x, one, xPrev_, -one);
+    ::pressio::ops::update(y_, static_cast<scalar_type>(0), r, one, rPrev_, -one);
+    // Hy = H_k y, J0 is already factorized
+    apply(tag, solver, J0, y_, Hy_, false);
+    addPair(tag);
+    storeIterate(x, r);
+  }
+
+  // out = H_k v
+  template<class SolverType, class JacobianType>
+  void apply(BroydenGoodTag /*tag*/,
+	     SolverType & solver,
+	     const JacobianType & J0,
+	     const ResidualType & v,
+	     StateType & out,
+	     bool refactorize) const
+  {
+    solve_possibly_reusing_factorization(solver, J0, v, out, refactorize);
+    constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+    for (std::size_t i=0; i<u_.size(); ++i){
+      const auto coeff = ::pressio::ops::dot(sHistory_[i], out);
+      ::pressio::ops::update(out, one, u_[i], coeff);
+    }
+  }
+
+  template<class SolverType, class JacobianType>
+  void apply(BroydenBadTag /*tag*/,
+	     SolverType & solver,
+	     const JacobianType & J0,
+	     const ResidualType & v,
+	     StateType & out,
+	     bool refactorize) const
+  {
+    solve_possibly_reusing_factorization(solver, J0, v, out, refactorize);
+    constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+    for (std::size_t i=0; i<u_.size(); ++i){
+      const auto coeff = ::pressio::ops::dot(yHistory_[i], v);
+      ::pressio::ops::update(out, one, u_[i], coeff);
+    }
+  }
+
+private:
+  void storeIterate(const StateType & x, const ResidualType & r){
+    ::pressio::ops::deep_copy(xPrev_, x);
+    ::pressio::ops::deep_copy(rPrev_, r);
+    hasPrevious_ = true;
+  }
+
+  bool isNegligible(scalar_type denom, scalar_type scale) const{
+    return std::abs(denom) <= std::numeric_limits<scalar_type>::epsilon() * scale;
+  }
+
+  // u = (s - Hy)/denom
+  StateType makeUpdateVector(scalar_type denom) const{
+    constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+    auto u = ::pressio::ops::clone(s_);
+    ::pressio::ops::update(u, one/denom, Hy_, -one/denom);
+    return u;
+  }
+
+  void addPair(BroydenGoodTag /*tag*/)
+  {
+    const auto denom = ::pressio::ops::dot(s_, Hy_);
+    if (isNegligible(denom, ::pressio::ops::norm2(s_)*::pressio::ops::norm2(Hy_))){
+      PRESSIOLOG_DEBUG("nonlinsolver: skipping degenerate Broyden update");
+      return;
+    }
+    u_.push_back(makeUpdateVector(denom));
+    sHistory_.push_back(::pressio::ops::clone(s_));
+  }
+
+  void addPair(BroydenBadTag /*tag*/)
+  {
+    // y^T y is negligible when ||y|| <= sqrt(eps) ||r_k||: the residual
+    // has barely changed, so y = r_k+1 - r_k is dominated by roundoff
+    const auto denom = ::pressio::ops::dot(y_, y_);
+    const auto rNorm = ::pressio::ops::norm2(rPrev_);
+    if (isNegligible(denom, rNorm*rNorm)){
+      PRESSIOLOG_DEBUG("nonlinsolver: skipping degenerate Broyden update");
+      return;
+    }
+    u_.push_back(makeUpdateVector(denom));
+    yHistory_.push_back(::pressio::ops::clone(y_));
+  }
+};
+
+/*
+  Broyden update of the Jacobian for the nonlinear least-squares
+  problems, where J is m x n and cannot be inverted, so the rank-1
+  update is applied explicitly to the stored Jacobian:
+
+    J_k+1 = J_k + (y - J_k s) s^T / (s^T s)
+
+  with s = x_k+1 - x_k and y = r_k+1 - r_k. There is no rank-1 update
+  (outer product) in ops, so this is currently only supported
+  for Eigen vectors and a dense Eigen Jacobian.
+*/
+template<class StateType, class ResidualType>
+class BroydenJacobianUpdater
+{
+  static_assert(::pressio::is_vector_eigen<StateType>::value
+		&& ::pressio::is_vector_eigen<ResidualType>::value,
+		"The Broyden Jacobian update currently requires Eigen state and residual vectors");
+
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+
+  StateType xPrev_;
+  StateType s_;
+  ResidualType rPrev_;
+  ResidualType p_;
+  bool hasPrevious_ = false;
+
+public:
+  BroydenJacobianUpdater(const StateType & state,
+			 const ResidualType & residual)
+    : xPrev_(::pressio::ops::clone(state)),
+      s_(::pressio::ops::clone(state)),
+      rPrev_(::pressio::ops::clone(residual)),
+      p_(::pressio::ops::clone(residual)){}
+
+  void forgetPreviousIterate(){ hasPrevious_ = false; }
+
+  // the Jacobian has been evaluated at (x,r)
+  void restart(const StateType & x, const ResidualType & r){
+    storeIterate(x, r);
+  }
+
+  // returns true if J has been modified
+  template<class JacobianType>
+  bool update(const StateType & x,
+	      const ResidualType & r,
+	      JacobianType & J)
+  {
+    static_assert(::pressio::is_dense_matrix_eigen<JacobianType>::value,
+		  "The Broyden Jacobian update currently requires a dense Eigen Jacobian");
+
+    if (!hasPrevious_){
+      storeIterate(x, r);
+      return false;
+    }
+
+    constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+    ::pressio::ops::update(s_, zero, x, one, xPrev_, -one);
+    const auto sTs = ::pressio::ops::dot(s_, s_);
+    if (sTs == zero){
+      storeIterate(x, r);
+      return false;
+    }
+
+    // p = y - J s
+    ::pressio::ops::update(p_, zero, r, one, rPrev_, -one);
+    ::pressio::ops::product(::pressio::nontranspose(), -one, J, s_, one, p_);
+
+    J.noalias() += p_ * (s_.transpose() / sTs);
+
+    storeIterate(x, r);
+    return true;
+  }
+
+private:
+  void storeIterate(const StateType & x, const ResidualType & r){
+    ::pressio::ops::deep_copy(xPrev_, x);
+    ::pressio::ops::deep_copy(rPrev_, r);
+    hasPrevious_ = true;
+  }
+};
+
+}}}
+#endif  // SOLVERS_NONLINEAR_IMPL_BROYDEN_HPP_
@@ -260,7 +260,7 @@ private:
     };
 
     //(..., (std::cout << lam(pd[Is], dm[pd[Is]]) << "\n"));
-    const auto pd = dm.publicNames();
+    const auto & pd = dm.publicNames();
     PRESSIOLOG_INFO(rootWithLabels_, iStep, lam(pd[Is], dm[pd[Is]]) ...);
   }
 };
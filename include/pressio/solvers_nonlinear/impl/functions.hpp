@@ -57,6 +57,50 @@ void compute_residual_and_jacobian(RegistryType & reg,
 #endif
 }
 
+/*
+  modified Newton: the tracker decides from the previous iterates if
+  the Jacobian needs to be recomputed, so that the residual is only
+  evaluated once, together with the Jacobian if needed.
+  Returns true if the Jacobian was recomputed.
+*/
+template<class RegistryType, class SystemType, class ScalarType>
+std::enable_if_t< RegistryType::template contains<JacobianTag>(), bool >
+compute_residual_and_jacobian_if_needed(RegistryType & reg,
+					const SystemType & system,
+					JacobianReuseTracker<ScalarType> & jacobianReuse)
+{
+  const bool mustUpdateJacobian = jacobianReuse.mustUpdate();
+  if (mustUpdateJacobian){
+    compute_residual_and_jacobian(reg, system);
+    jacobianReuse.notifyUpdated();
+  }
+  else{
+    const auto & state = reg.template get<StateTag>();
+    compute_residual(reg, state, system);
+  }
+
+  if (jacobianReuse.isEnabled()){
+    const auto & r = reg.template get<ResidualTag>();
+    jacobianReuse.notifyResidualNorm(::pressio::ops::norm2(r));
+  }
+  jacobianReuse.notifyUsed();
+  return mustUpdateJacobian;
+}
+
+/*
+  Jacobian-free: there is no Jacobian to compute, only the residual
+*/
+template<class RegistryType, class SystemType, class ScalarType>
+std::enable_if_t< !RegistryType::template contains<JacobianTag>(), bool >
+compute_residual_and_jacobian_if_needed(RegistryType & reg,
+					const SystemType & system,
+					JacobianReuseTracker<ScalarType> & /*jacobianReuse*/)
+{
+  const auto & state = reg.template get<StateTag>();
+  compute_residual(reg, state, system);
+  return false;
+}
+
 template<class RegistryType>
 void compute_gradient(RegistryType & reg)
 {
@@ -79,6 +123,37 @@ auto compute_half_sum_of_squares(const T & operand)
   return std::pow(normVal, two)*(one/two);
 }
 
+template<class J_t, class r_t, class H_t, class g_t, class = void>
+struct supports_fused_normal_equations_product : std::false_type{};
+
+template<class J_t, class r_t, class H_t, class g_t>
+struct supports_fused_normal_equations_product<
+  J_t, r_t, H_t, g_t,
+  mpl::void_t<
+    decltype(::pressio::ops::normal_equations_product
+	     (1, std::declval<J_t const &>(), std::declval<r_t const &>(),
+	      0, std::declval<H_t &>(), std::declval<g_t &>()))
+    >
+  > : std::true_type{};
+
+// H = J^T J, g = J^T r in one pass over J when the types support it
+template<class J_t, class r_t, class H_t, class g_t>
+std::enable_if_t< supports_fused_normal_equations_product<J_t, r_t, H_t, g_t>::value >
+compute_hessian_and_gradient(const J_t & J, const r_t & r, H_t & H, g_t & g)
+{
+  ::pressio::ops::normal_equations_product(1, J, r, 0, H, g);
+}
+
+template<class J_t, class r_t, class H_t, class g_t>
+std::enable_if_t< !supports_fused_normal_equations_product<J_t, r_t, H_t, g_t>::value >
+compute_hessian_and_gradient(const J_t & J, const r_t & r, H_t & H, g_t & g)
+{
+  constexpr auto pT  = ::pressio::transpose();
+  constexpr auto pnT = ::pressio::nontranspose();
+  ::pressio::ops::product(pT, pnT, 1, J, 0, H);
+  ::pressio::ops::product(pT, 1, J, r, 0, g);
+}
+
 template<class RegistryType, class StateType, class SystemType>
 auto compute_nonlinearls_objective(GaussNewtonNormalEqTag /*tag*/,
 				   RegistryType & reg,
@@ -90,6 +165,17 @@ auto compute_nonlinearls_objective(GaussNewtonNormalEqTag /*tag*/,
   return compute_half_sum_of_squares(r);
 }
 
+template<class RegistryType, class StateType, class SystemType>
+auto compute_nonlinearls_objective(GaussNewtonBroydenNormalEqTag /*tag*/,
+				   RegistryType & reg,
+				   const StateType & state,
+				   const SystemType & system)
+{
+  compute_residual(reg, state, system);
+  auto & r = reg.template get<ResidualTag>();
+  return compute_half_sum_of_squares(r);
+}
+
 template<class RegistryType, class StateType, class SystemType>
 auto compute_nonlinearls_objective(GaussNewtonQrTag /*tag*/,
 				   RegistryType & reg,
@@ -153,11 +239,8 @@ auto compute_nonlinearls_operators_and_objective(GaussNewtonNormalEqTag /*tag*/,
   const auto & J = reg.template get<JacobianTag>();
   auto & g = reg.template get<GradientTag>();
   auto & H = reg.template get<HessianTag>();
-  constexpr auto pT  = ::pressio::transpose();
-  constexpr auto pnT = ::pressio::nontranspose();
   // H = J_r^T J_r, g = J_r^T r
-  ::pressio::ops::product(pT, pnT, 1, J, 0, H);
-  ::pressio::ops::product(pT, 1, J, r, 0, g);
+  compute_hessian_and_gradient(J, r, H, g);
 
   return compute_half_sum_of_squares(r);
 }
@@ -247,8 +330,6 @@ auto compute_nonlinearls_operators_and_objective(LevenbergMarquardtNormalEqTag /
 {
   compute_residual_and_jacobian(reg, system);
 
-  constexpr auto pT  = ::pressio::transpose();
-  constexpr auto pnT = ::pressio::nontranspose();
   const auto & r = reg.template get<ResidualTag>();
   const auto & J = reg.template get<JacobianTag>();
   auto & g = reg.template get<GradientTag>();
@@ -256,8 +337,7 @@ auto compute_nonlinearls_operators_and_objective(LevenbergMarquardtNormalEqTag /
   auto & scaledH = reg.template get<HessianTag>();
   const auto & damp = reg.template get<LevenbergMarquardtDampingTag>();
 
-  ::pressio::ops::product(pT, pnT, 1, J, 0, H);
-  ::pressio::ops::product(pT, 1, J, r, 0, g);
+  compute_hessian_and_gradient(J, r, H, g);
 
   // compute scaledH = H + mu*diagonal(H)
   ::pressio::ops::deep_copy(scaledH, H);
@@ -268,8 +348,183 @@ auto compute_nonlinearls_operators_and_objective(LevenbergMarquardtNormalEqTag /
   return compute_half_sum_of_squares(r);
 }
 
+#ifdef PRESSIO_ENABLE_CXX20
+template<class RegistryType, class SystemType>
+requires RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>
+#else
+template<
+  class RegistryType, class SystemType,
+  std::enable_if_t<
+    RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>::value,
+    int> = 0
+  >
+#endif
+auto compute_nonlinearls_operators_and_objective(GaussNewtonBroydenNormalEqTag /*tag*/,
+						 RegistryType & reg,
+						 const SystemType & system)
+{
+  compute_residual_and_jacobian(reg, system);
+
+  const auto & x = reg.template get<StateTag>();
+  const auto & r = reg.template get<ResidualTag>();
+  const auto & J = reg.template get<JacobianTag>();
+  auto & g = reg.template get<GradientTag>();
+  auto & H = reg.template get<HessianTag>();
+  auto & broyden = reg.template get<BroydenHistoryTag>();
+  // the exact Jacobian is the new starting point of the Broyden updates
+  broyden.restart(x, r);
+
+  compute_hessian_and_gradient(J, r, H, g);
+  return compute_half_sum_of_squares(r);
+}
+
+/*
+  modified Gauss-Newton: only the residual is evaluated at the current
+  state while the Jacobian (and H) from a previous iteration are reused,
+  so only the gradient and the objective need to be recomputed.
+  Note that the residual is assumed to be already computed.
+*/
+template<class RegistryType>
+auto compute_nonlinearls_gradient_and_objective_reusing_jacobian(GaussNewtonNormalEqTag /*tag*/,
+								 RegistryType & reg)
+{
+  const auto & r = reg.template get<ResidualTag>();
+  const auto & J = reg.template get<JacobianTag>();
+  auto & g = reg.template get<GradientTag>();
+  constexpr auto pT  = ::pressio::transpose();
+  // g = J_r^T r
+  ::pressio::ops::product(pT, 1, J, r, 0, g);
+  return compute_half_sum_of_squares(r);
+}
+
+template<class RegistryType>
+auto compute_nonlinearls_gradient_and_objective_reusing_jacobian(GaussNewtonQrTag /*tag*/,
+								 RegistryType & reg)
+{
+  const auto & r = reg.template get<ResidualTag>();
+  const auto & J = reg.template get<JacobianTag>();
+  auto & g = reg.template get<GradientTag>();
+  constexpr auto pT  = ::pressio::transpose();
+  // g = J_r^T r
+  ::pressio::ops::product(pT, 1, J, r, 0, g);
+  return compute_half_sum_of_squares(r);
+}
+
+template<class RegistryType>
+auto compute_nonlinearls_gradient_and_objective_reusing_jacobian(WeightedGaussNewtonNormalEqTag /*tag*/,
+								 RegistryType & reg)
+{
+  constexpr auto pT  = ::pressio::transpose();
+  const auto & W = reg.template get<WeightingOperatorTag>();
+  const auto & r = reg.template get<ResidualTag>();
+  const auto & J = reg.template get<JacobianTag>();
+  auto & Wr = reg.template get<WeightedResidualTag>();
+  auto & g  = reg.template get<GradientTag>();
+
+  W.get()(r, Wr);
+  ::pressio::ops::product(pT, 1, J, Wr, 0, g);
+
+  const auto v = ::pressio::ops::dot(r, Wr);
+  using sc_t = mpl::remove_cvref_t< decltype(v) >;
+  constexpr auto one  = ::pressio::utils::Constants<sc_t>::one();
+  constexpr auto two  = ::pressio::utils::Constants<sc_t>::two();
+  return v*(one/two);
+}
+
+/*
+  Broyden Gauss-Newton: the Jacobian from a previous iteration is
+  corrected with a rank-1 secant update instead of being re-evaluated,
+  so H must be recomputed but no Jacobian evaluation is needed.
+  Note that the residual is assumed to be already computed.
+*/
+template<class RegistryType>
+auto compute_nonlinearls_gradient_and_objective_reusing_jacobian(GaussNewtonBroydenNormalEqTag /*tag*/,
+								 RegistryType & reg)
+{
+  const auto & x = reg.template get<StateTag>();
+  const auto & r = reg.template get<ResidualTag>();
+  auto & J = reg.template get<JacobianTag>();
+  auto & g = reg.template get<GradientTag>();
+  auto & H = reg.template get<HessianTag>();
+  auto & broyden = reg.template get<BroydenHistoryTag>();
+
+  if (broyden.update(x, r, J)){
+    compute_hessian_and_gradient(J, r, H, g);
+  }
+  else{
+    constexpr auto pT  = ::pressio::transpose();
+    ::pressio::ops::product(pT, 1, J, r, 0, g);
+  }
+  return compute_half_sum_of_squares(r);
+}
+
+/*
+  ||r|| for the jacobian reuse tracker: the objective is 1/2 ||r||^2,
+  so ||r|| is recovered from it without another norm (i.e. without
+  another global reduction for distributed residuals)
+*/
+template<class Tag, class RegistryType, class ObjectiveType>
+ObjectiveType residual_norm_from_objective(Tag /*tag*/,
+					   const RegistryType & /*reg*/,
+					   const ObjectiveType & objective)
+{
+  constexpr auto two = ::pressio::utils::Constants<ObjectiveType>::two();
+  return std::sqrt(two*objective);
+}
+
+// the weighted objective is 1/2 r^T W r, so the norm is computed directly
+template<class RegistryType, class ObjectiveType>
+ObjectiveType residual_norm_from_objective(WeightedGaussNewtonNormalEqTag /*tag*/,
+					   const RegistryType & reg,
+					   const ObjectiveType & /*objective*/)
+{
+  return ::pressio::ops::norm2(reg.template get<ResidualTag>());
+}
+
+template<class Tag, class RegistryType, class SystemType, class ScalarType>
+auto compute_nonlinearls_operators_and_objective(Tag tag,
+						 RegistryType & reg,
+						 const SystemType & system,
+						 JacobianReuseTracker<ScalarType> & jacobianReuse,
+						 bool & jacobianUpdated)
+{
+  // decided before evaluating the residual, see JacobianReuseTracker,
+  // so that the residual is only evaluated once
+  jacobianUpdated = jacobianReuse.mustUpdate();
+  using objective_t = decltype(compute_nonlinearls_operators_and_objective(tag, reg, system));
+  objective_t objective = {};
+  if (jacobianUpdated){
+    jacobianReuse.notifyUpdated();
+    objective = compute_nonlinearls_operators_and_objective(tag, reg, system);
+  }
+  else{
+    const auto & state = reg.template get<StateTag>();
+    compute_residual(reg, state, system);
+    objective = compute_nonlinearls_gradient_and_objective_reusing_jacobian(tag, reg);
+  }
+
+  if (jacobianReuse.isEnabled()){
+    jacobianReuse.notifyResidualNorm(residual_norm_from_objective(tag, reg, objective));
+  }
+  jacobianReuse.notifyUsed();
+  return objective;
+}
+
+template<class RegistryType, class SystemType, class ScalarType>
+auto compute_nonlinearls_operators_and_objective(LevenbergMarquardtNormalEqTag tag,
+						 RegistryType & reg,
+						 const SystemType & system,
+						 JacobianReuseTracker<ScalarType> & jacobianReuse,
+						 bool & jacobianUpdated)
+{
+  // the damped hessian changes at every iteration, so there is nothing to reuse
+  jacobianUpdated = true;
+  jacobianReuse.notifyUpdated();
+  return compute_nonlinearls_operators_and_objective(tag, reg, system);
+}
+
 template<class RegistryType>
-void solve_newton_step(RegistryType & reg)
+void solve_newton_step(RegistryType & reg, bool refactorize = true)
 {
   /* Newton correction solves: J_r delta = - r
      where: delta = x_k+1 - x_k
@@ -281,7 +536,7 @@ void solve_newton_step(RegistryType & reg)
   auto & c = reg.template get<CorrectionTag>();
   auto & solver = reg.template get<InnerSolverTag>();
   // solve J_r correction = r
-  solver.get().solve(J, r, c);
+  solve_possibly_reusing_factorization(solver.get(), J, r, c, refactorize);
   // scale by -1 for sign convention
   using c_t = mpl::remove_cvref_t<decltype(c)>;
   using scalar_type = typename ::pressio::Traits<c_t>::scalar_type;
@@ -289,18 +544,101 @@ void solve_newton_step(RegistryType & reg)
 }
 
 template<class RegistryType>
-void solve_hessian_gradient_linear_system(RegistryType & reg)
+void solve_hessian_gradient_linear_system(RegistryType & reg, bool refactorize = true)
 {
   const auto & g = reg.template get<GradientTag>();
   const auto & H = reg.template get<HessianTag>();
   auto & c = reg.template get<CorrectionTag>();
   auto & solver = reg.template get<InnerSolverTag>();
-  solver.get().solve(H, g, c);
+  solve_possibly_reusing_factorization(solver.get(), H, g, c, refactorize);
+}
+
+template<class RegistryType>
+void compute_correction(NewtonTag /*tag*/,
+			RegistryType & reg,
+			bool refactorize = true)
+{
+  solve_newton_step(reg, refactorize);
+}
+
+template<class RegistryType>
+void compute_correction(JacobianFreeNewtonKrylovTag /*tag*/,
+			RegistryType & reg,
+			bool /*jacobianUpdated*/ = false)
+{
+  /* Jacobian-free Newton-Krylov: same as Newton, J_r (-delta) = r,
+     but the Krylov solver only accesses J_r through its action,
+     which is approximated by finite differences of the residual.
+  */
+  const auto & x = reg.template get<StateTag>();
+  const auto & r = reg.template get<ResidualTag>();
+  auto & c = reg.template get<CorrectionTag>();
+  auto & solver = reg.template get<InnerSolverTag>();
+  auto & action = reg.template get<JacobianActionTag>();
+  auto & prec = reg.template get<PreconditionerTag>();
+
+  action.bind(x, r);
+  update_preconditioner_if_needed(prec.get(), x, r);
+  // the initial guess of the correction is zero, so that the initial
+  // Krylov residual does not need any residual evaluation
+  ::pressio::ops::set_zero(c);
+  solver.get().solve(action, prec.get(), r, c);
+
+  using c_t = mpl::remove_cvref_t<decltype(c)>;
+  using scalar_type = typename ::pressio::Traits<c_t>::scalar_type;
+  pressio::ops::scale(c, utils::Constants<scalar_type>::negOne() );
+}
+
+template<class VariantTag, class RegistryType>
+void compute_broyden_correction(VariantTag tag,
+				RegistryType & reg,
+				bool jacobianUpdated)
+{
+  /* quasi-Newton correction: delta = - H_k r_k,
+     where H_k approximates the inverse of the Jacobian.
+     If the Jacobian has just been evaluated, H_k = J_k^{-1}
+     and this is the standard Newton step.
+  */
+  const auto & x = reg.template get<StateTag>();
+  const auto & r = reg.template get<ResidualTag>();
+  const auto & J = reg.template get<JacobianTag>();
+  auto & c = reg.template get<CorrectionTag>();
+  auto & solver = reg.template get<InnerSolverTag>();
+  auto & broyden = reg.template get<BroydenHistoryTag>();
+
+  if (jacobianUpdated){
+    broyden.restart(x, r);
+  }
+  else{
+    broyden.update(tag, x, r, solver.get(), J);
+  }
+  broyden.apply(tag, solver.get(), J, r, c, jacobianUpdated);
+
+  using c_t = mpl::remove_cvref_t<decltype(c)>;
+  using scalar_type = typename ::pressio::Traits<c_t>::scalar_type;
+  pressio::ops::scale(c, utils::Constants<scalar_type>::negOne() );
+}
+
+template<class RegistryType>
+void compute_correction(BroydenGoodTag tag,
+			RegistryType & reg,
+			bool jacobianUpdated = true)
+{
+  compute_broyden_correction(tag, reg, jacobianUpdated);
+}
+
+template<class RegistryType>
+void compute_correction(BroydenBadTag tag,
+			RegistryType & reg,
+			bool jacobianUpdated = true)
+{
+  compute_broyden_correction(tag, reg, jacobianUpdated);
 }
 
 template<class RegistryType>
 void compute_correction(GaussNewtonNormalEqTag /*tag*/,
-			RegistryType & reg)
+			RegistryType & reg,
+			bool refactorize = true)
 {
   /* Gauss-newton with normal eq, we are solving:
        J_r^T*J_r  (x_k+1 - x_k) = - J_r^T*r
@@ -313,16 +651,28 @@ void compute_correction(GaussNewtonNormalEqTag /*tag*/,
        c = x_k+1 - x_k,
      we need to rescale c by -1 after the solve
   */
-  solve_hessian_gradient_linear_system(reg);
+  solve_hessian_gradient_linear_system(reg, refactorize);
   auto & c = reg.template get<CorrectionTag>();
   ::pressio::ops::scale(c, -1);
 }
 
 template<class RegistryType>
 void compute_correction(WeightedGaussNewtonNormalEqTag /*tag*/,
-			RegistryType & reg)
+			RegistryType & reg,
+			bool refactorize = true)
 {
   // this is same as regular GN since we solve H delta = g
+  solve_hessian_gradient_linear_system(reg, refactorize);
+  auto & c = reg.template get<CorrectionTag>();
+  ::pressio::ops::scale(c, -1);
+}
+
+template<class RegistryType>
+void compute_correction(GaussNewtonBroydenNormalEqTag /*tag*/,
+			RegistryType & reg,
+			bool /*refactorize*/ = true)
+{
+  // H changes with every Broyden update, so it is always factorized
   solve_hessian_gradient_linear_system(reg);
   auto & c = reg.template get<CorrectionTag>();
   ::pressio::ops::scale(c, -1);
@@ -330,7 +680,8 @@ void compute_correction(WeightedGaussNewtonNormalEqTag /*tag*/,
 
 template<class RegistryType>
 void compute_correction(LevenbergMarquardtNormalEqTag /*tag*/,
-			RegistryType & reg)
+			RegistryType & reg,
+			bool /*refactorize*/ = true)
 {
   /*
     For LM we are solving: H c = g
@@ -350,7 +701,8 @@ void compute_correction(LevenbergMarquardtNormalEqTag /*tag*/,
 
 template<class RegistryType>
 void compute_correction(GaussNewtonQrTag /*tag*/,
-			RegistryType & reg)
+			RegistryType & reg,
+			bool refactorize = true)
 {
   /*
     see: https://en.wikipedia.org/wiki/Non-linear_least_squares#QR_decomposition
@@ -368,8 +720,11 @@ void compute_correction(GaussNewtonQrTag /*tag*/,
   auto & QTr = reg.template get<QTransposeResidualTag>();
   auto & solver = reg.template get<InnerSolverTag>();
 
-  // factorize J = QR
-  solver.get().computeThin(J);
+  // factorize J = QR, unless we are reusing the factorization
+  // of a previous Jacobian (modified Gauss-Newton)
+  if (refactorize){
+    solver.get().computeThin(J);
+  }
 
   // compute Q^T r
   solver.get().applyQTranspose(r, QTr);
@@ -396,50 +751,19 @@ void reset_for_new_solve_loop(LevenbergMarquardtNormalEqTag /*tagJ*/,
   damp = 1;
 }
 
-// =====================================================
-
-template<class Tag, class T, class RegistryType>
-std::enable_if_t< !RegistryType::template contains<Tag>() >
-compute_norm2_if_tag_if_present(Tag /*t*/,
-				const RegistryType & reg,
-				bool isInitial,
-				InternalDiagnosticDataWithAbsoluteRelativeTracking<T> & metric)
-{ /* noop */ }
-
-template<class Tag, class T, class RegistryType>
-std::enable_if_t< RegistryType::template contains<Tag>() >
-compute_norm2_if_tag_if_present(Tag /*t*/,
-				const RegistryType & reg,
-				bool isInitial,
-				InternalDiagnosticDataWithAbsoluteRelativeTracking<T> & metric)
-{
-  const auto & operand = reg.template get<Tag>();
-  const auto value = ops::norm2(operand);
-  metric.update(value, isInitial);
+template<class RegistryType>
+void reset_for_new_solve_loop(BroydenGoodTag /*tag*/, RegistryType & reg){
+  reg.template get<BroydenHistoryTag>().forgetPreviousIterate();
 }
 
-template<class T, class RegistryType>
-void compute_norm_internal_diagnostics(const RegistryType & reg,
-				       bool isInitial,
-				       InternalDiagnosticDataWithAbsoluteRelativeTracking<T> & metric)
-{
-
-  switch(metric.name())
-  {
-    case InternalDiagnostic::residualAbsoluteRelativel2Norm:
-      compute_norm2_if_tag_if_present(ResidualTag{}, reg, isInitial, metric);
-      break;
-
-    case InternalDiagnostic::correctionAbsoluteRelativel2Norm:
-      compute_norm2_if_tag_if_present(CorrectionTag{}, reg, isInitial, metric);
-      break;
-
-    case InternalDiagnostic::gradientAbsoluteRelativel2Norm:
-      compute_norm2_if_tag_if_present(GradientTag{}, reg, isInitial, metric);
-      break;
+template<class RegistryType>
+void reset_for_new_solve_loop(BroydenBadTag /*tag*/, RegistryType & reg){
+  reg.template get<BroydenHistoryTag>().forgetPreviousIterate();
+}
 
-    default: return;
-  };//end switch
+template<class RegistryType>
+void reset_for_new_solve_loop(GaussNewtonBroydenNormalEqTag /*tag*/, RegistryType & reg){
+  reg.template get<BroydenHistoryTag>().forgetPreviousIterate();
 }
 
 }}}
@@ -13,12 +13,24 @@ struct SystemTag{};
 // this represent ths Q^T *r for QR gauss newton
 struct QTransposeResidualTag{};
 
+// this represents the data of the quasi-Newton (Broyden) updates
+struct BroydenHistoryTag{};
+
+// these represent the finite-difference action of the Jacobian
+// and the user preconditioner for the Jacobian-free Newton-Krylov
+struct JacobianActionTag{};
+struct PreconditionerTag{};
+
 
 struct NewtonTag{};
 struct GaussNewtonNormalEqTag{};
 struct WeightedGaussNewtonNormalEqTag{};
 struct LevenbergMarquardtNormalEqTag{};
 struct GaussNewtonQrTag{};
+struct BroydenGoodTag{};
+struct BroydenBadTag{};
+struct GaussNewtonBroydenNormalEqTag{};
+struct JacobianFreeNewtonKrylovTag{};
 
 }}}
 #endif
@@ -0,0 +1,154 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// jacobian_free.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_NONLINEAR_IMPL_JACOBIAN_FREE_HPP_
+#define SOLVERS_NONLINEAR_IMPL_JACOBIAN_FREE_HPP_
+
+namespace pressio{
+namespace nonlinearsolvers{
+namespace impl{
+
+/*
+  Action of the Jacobian approximated with a forward finite difference
+  of the residual, for the Jacobian-free Newton-Krylov solver:
+
+    J(x) v ~= (r(x + h v) - r(x)) / h,   h = eps (1 + ||x||) / ||v||
+
+  where eps defaults to sqrt(machine epsilon). The residual is computed
+  via residualAndJacobian with an empty Jacobian, so the Jacobian
+  is never formed nor stored.
+  bind(x, r) must be called with the current state and its residual
+  before the action is used.
+*/
+template<class SystemType>
+class FiniteDifferenceJacobianAction
+{
+  using state_type    = typename SystemType::state_type;
+  using residual_type = typename SystemType::residual_type;
+  using scalar_type   = typename ::pressio::Traits<state_type>::scalar_type;
+
+  SystemType const * system_;
+  mutable state_type perturbedState_;
+  state_type const * state_ = nullptr;
+  residual_type const * residual_ = nullptr;
+  scalar_type stateNorm_ = {};
+  scalar_type relativeStep_ = std::sqrt(std::numeric_limits<scalar_type>::epsilon());
+  mutable int numResidualEvaluations_ = 0;
+
+public:
+  explicit FiniteDifferenceJacobianAction(const SystemType & system)
+    : system_(&system),
+      perturbedState_(system.createState()){}
+
+  void setRelativeStep(scalar_type value){ relativeStep_ = value; }
+  int numResidualEvaluations() const{ return numResidualEvaluations_; }
+
+  void bind(const state_type & state, const residual_type & residual){
+    state_ = &state;
+    residual_ = &residual;
+    stateNorm_ = ::pressio::ops::norm2(state);
+  }
+
+  void operator()(const state_type & v, residual_type & Jv) const
+  {
+    assert(state_ != nullptr && residual_ != nullptr);
+
+    constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+    const auto vNorm = ::pressio::ops::norm2(v);
+    if (vNorm == zero){
+      ::pressio::ops::set_zero(Jv);
+      return;
+    }
+
+    const scalar_type h = relativeStep_*(one + stateNorm_)/vNorm;
+    ::pressio::ops::update(perturbedState_, zero, *state_, one, v, h);
+#ifdef PRESSIO_ENABLE_CXX17
+    system_->residualAndJacobian(perturbedState_, Jv, {});
+#else
+    system_->residualAndJacobian(perturbedState_, Jv, nullptr);
+#endif
+    ++numResidualEvaluations_;
+    ::pressio::ops::update(Jv, one/h, *residual_, -one/h);
+  }
+};
+
+// a preconditioner can optionally be updated at every nonlinear iteration
+// with the current state and residual via: update(state, residual)
+template<class PreconditionerType, class StateType, class ResidualType, class = void>
+struct preconditioner_has_update : std::false_type{};
+
+template<class PreconditionerType, class StateType, class ResidualType>
+struct preconditioner_has_update<
+  PreconditionerType, StateType, ResidualType,
+  mpl::void_t<
+    decltype(std::declval<PreconditionerType&>().update(std::declval<const StateType&>(),
+							std::declval<const ResidualType&>()))
+    >
+  > : std::true_type{};
+
+template<class PreconditionerType, class StateType, class ResidualType>
+std::enable_if_t< preconditioner_has_update<PreconditionerType, StateType, ResidualType>::value >
+update_preconditioner_if_needed(PreconditionerType & prec,
+				const StateType & state,
+				const ResidualType & residual)
+{
+  prec.update(state, residual);
+}
+
+template<class PreconditionerType, class StateType, class ResidualType>
+std::enable_if_t< !preconditioner_has_update<PreconditionerType, StateType, ResidualType>::value >
+update_preconditioner_if_needed(PreconditionerType & /*prec*/,
+				const StateType & /*state*/,
+				const ResidualType & /*residual*/)
+{
+  // no op
+}
+
+}}}
+#endif  // SOLVERS_NONLINEAR_IMPL_JACOBIAN_FREE_HPP_
@@ -0,0 +1,204 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// jacobian_reuse.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_NONLINEAR_IMPL_JACOBIAN_REUSE_HPP_
+#define SOLVERS_NONLINEAR_IMPL_JACOBIAN_REUSE_HPP_
+
+namespace pressio{
+namespace nonlinearsolvers{
+namespace impl{
+
+/*
+  Tracks when the Jacobian must be re-evaluated to support a
+  modified-Newton (chord) iteration, where the Jacobian, and the
+  operators and factorizations derived from it, are reused
+  across nonlinear iterations.
+
+  The Jacobian is re-evaluated when:
+  - no valid Jacobian is available (first iteration of a solve,
+    unless reuse across solves is enabled)
+  - it has already been used for updateFrequency iterations
+  - the convergence rate ||r_k|| / ||r_k-1|| exceeds rateThreshold
+
+  The decision is taken before evaluating the residual at the new
+  iterate, so that the residual and the Jacobian are evaluated together
+  in a single call. Hence a degraded rate, observed once r_k is known,
+  triggers the update at the next iteration.
+
+  The default updateFrequency = 1 corresponds to the standard
+  Newton iteration, where the Jacobian is evaluated at every iteration.
+*/
+template<class ScalarType>
+class JacobianReuseTracker
+{
+  int updateFrequency_ = 1;
+  ScalarType rateThreshold_ = static_cast<ScalarType>(0.5);
+  bool reuseAcrossSolves_ = false;
+
+  bool isValid_ = false;
+  bool hasLastResidualNorm_ = false;
+  bool rateTooSlow_ = false;
+  int numUses_ = 0;
+  int numEvaluations_ = 0;
+  ScalarType lastResidualNorm_ = {};
+
+public:
+  void setUpdateFrequency(int value){
+    if (value < 1){
+      throw std::runtime_error("The Jacobian update frequency must be >= 1");
+    }
+    updateFrequency_ = value;
+  }
+
+  void setRateThreshold(ScalarType value){
+    if (value <= ::pressio::utils::Constants<ScalarType>::zero()){
+      throw std::runtime_error("The Jacobian update rate threshold must be > 0");
+    }
+    rateThreshold_ = value;
+  }
+
+  void setReuseAcrossSolves(bool value){ reuseAcrossSolves_ = value; }
+
+  bool isEnabled() const{ return updateFrequency_ > 1; }
+  int updateFrequency() const{ return updateFrequency_; }
+  ScalarType rateThreshold() const{ return rateThreshold_; }
+  bool reuseAcrossSolves() const{ return reuseAcrossSolves_; }
+  int numEvaluations() const{ return numEvaluations_; }
+
+  void resetForNewSolve(){
+    if (!reuseAcrossSolves_){
+      isValid_ = false;
+    }
+    hasLastResidualNorm_ = false;
+    rateTooSlow_ = false;
+  }
+
+  // the Jacobian can be invalidated externally, e.g. if the system changes
+  void invalidate(){ isValid_ = false; }
+
+  // whether the Jacobian must be evaluated at the next iterate
+  bool mustUpdate() const{
+    return !isValid_ || numUses_ >= updateFrequency_ || rateTooSlow_;
+  }
+
+  // residualNorm: norm of the residual at the current iterate
+  void notifyResidualNorm(ScalarType residualNorm)
+  {
+    rateTooSlow_ = hasLastResidualNorm_ &&
+      (residualNorm > rateThreshold_ * lastResidualNorm_);
+    if (rateTooSlow_){
+      PRESSIOLOG_DEBUG("nonlinsolver: convergence rate degraded, updating Jacobian");
+    }
+
+    lastResidualNorm_ = residualNorm;
+    hasLastResidualNorm_ = true;
+  }
+
+  void notifyUpdated(){
+    isValid_ = true;
+    rateTooSlow_ = false;
+    numUses_ = 0;
+    ++numEvaluations_;
+  }
+
+  void notifyUsed(){ ++numUses_; }
+};
+
+template<class LinearSolverType, class MatrixType, class RhsType, class SolutionType, class = void>
+struct linear_solver_supports_factorization_reuse : std::false_type{};
+
+template<class LinearSolverType, class MatrixType, class RhsType, class SolutionType>
+struct linear_solver_supports_factorization_reuse<
+  LinearSolverType, MatrixType, RhsType, SolutionType,
+  mpl::void_t<
+    decltype(std::declval<LinearSolverType&>().resetLinearSystem(std::declval<const MatrixType&>())),
+    decltype(std::declval<LinearSolverType&>().solve(std::declval<const RhsType&>(),
+						     std::declval<SolutionType&>()))
+    >
+  > : std::true_type{};
+
+/*
+  solve A x = b, where A is only factorized if requested and if the
+  linear solver supports reusing a factorization, i.e. it has methods
+  resetLinearSystem(A) and solve(b, x). Otherwise, fall back to solve(A, b, x).
+*/
+template<class LinearSolverType, class MatrixType, class RhsType, class SolutionType>
+std::enable_if_t<
+  linear_solver_supports_factorization_reuse<
+    LinearSolverType, MatrixType, RhsType, SolutionType>::value
+  >
+solve_possibly_reusing_factorization(LinearSolverType & solver,
+				     const MatrixType & A,
+				     const RhsType & b,
+				     SolutionType & x,
+				     bool refactorize)
+{
+  if (refactorize){
+    solver.solve(A, b, x);
+  }
+  else{
+    solver.solve(b, x);
+  }
+}
+
+template<class LinearSolverType, class MatrixType, class RhsType, class SolutionType>
+std::enable_if_t<
+  !linear_solver_supports_factorization_reuse<
+    LinearSolverType, MatrixType, RhsType, SolutionType>::value
+  >
+solve_possibly_reusing_factorization(LinearSolverType & solver,
+				     const MatrixType & A,
+				     const RhsType & b,
+				     SolutionType & x,
+				     bool /*refactorize*/)
+{
+  solver.solve(A, b, x);
+}
+
+}}}
+#endif  // SOLVERS_NONLINEAR_IMPL_JACOBIAN_REUSE_HPP_
@@ -2,6 +2,8 @@
 #ifndef SOLVERS_NONLINEAR_IMPL_LEAST_SQUARES_SOLVER_HPP_
 #define SOLVERS_NONLINEAR_IMPL_LEAST_SQUARES_SOLVER_HPP_
 
+#include <utility>
+
 namespace pressio{
 namespace nonlinearsolvers{
 namespace impl{
@@ -22,6 +24,7 @@ void nonlin_ls_solving_loop_impl(ProblemTag problemTag,
 				 DiagnosticsContainerType & normDiagnostics,
 				 const DiagnosticsLoggerType & logger,
 				 int maxIters,
+				 JacobianReuseTracker<ToleranceType> & jacobianReuse,
 				 UpdaterType && updater)
 {
 
@@ -46,14 +49,26 @@ void nonlin_ls_solving_loop_impl(ProblemTag problemTag,
     };
   };
 
+  jacobianReuse.resetForNewSolve();
+
+  // only the norms needed by the stop criterion and the logging are computed
+  NormDiagnosticsEngine<ToleranceType> diagnosticsEngine(normDiagnostics, stopEnumValue);
+
   int iStep = 0;
   while (++iStep <= maxIters){
     const bool isFirstIteration = iStep==1;
 
     // 1. compute operators
+    bool jacobianUpdated = true;
     try{
-      auto objValue = compute_nonlinearls_operators_and_objective(problemTag, reg, system);
+      auto objValue = compute_nonlinearls_operators_and_objective(problemTag, reg, system,
+								  jacobianReuse, jacobianUpdated);
       normDiagnostics[InternalDiagnostic::objectiveAbsoluteRelative].update(objValue, isFirstIteration);
+      if (objective_is_half_squared_residual_norm<ProblemTag>::value){
+	using std::sqrt;
+	diagnosticsEngine.setKnown(InternalDiagnostic::residualAbsoluteRelativel2Norm,
+				   sqrt(objValue + objValue));
+      }
     }
     catch (::pressio::eh::ResidualEvaluationFailureUnrecoverable const &e){
       PRESSIOLOG_CRITICAL(e.what());
@@ -65,14 +80,13 @@ void nonlin_ls_solving_loop_impl(ProblemTag problemTag,
     }
 
     // 2. solve for correction
-    compute_correction(problemTag, reg);
+    compute_correction(problemTag, reg, jacobianUpdated);
 
     /* stage 3 */
-    std::for_each(normDiagnostics.begin(), normDiagnostics.end(),
-		  [&reg, isFirstIteration](auto & v){
-		    compute_norm_internal_diagnostics(reg, isFirstIteration, v);
-		  });
-    logger(iStep, normDiagnostics);
+    diagnosticsEngine.compute(reg, isFirstIteration, normDiagnostics);
+    if (diagnosticsEngine.mustLog()){
+      logger(iStep, normDiagnostics);
+    }
 
     /* stage 4*/
     if (mustStop(iStep)){
@@ -121,6 +135,7 @@ class NonLinLeastSquares : public RegistryType
     InternalDiagnosticDataWithAbsoluteRelativeTracking<ScalarType> >;
   diagnostics_container diagnostics_;
   DiagnosticsLogger diagnosticsLogger_ = {};
+  JacobianReuseTracker<ScalarType> jacobianReuse_ = {};
 
 public:
   template<class ...Args>
@@ -161,12 +176,30 @@ public:
   void setStopTolerance(ScalarType value) { stopTolerance_ = value; }
   void setMaxIterations(int newMax)       { maxIters_ = newMax; }
 
+  // modified Gauss-Newton: reuse the Jacobian, and the factorization of the
+  // Hessian (or of the Jacobian for QR) if the linear solver supports it,
+  // for up to "value" iterations. The default value = 1 recomputes it at every
+  // iteration. Levenberg-Marquardt does not support reuse.
+  void setJacobianUpdateFrequency(int value){
+    if (value > 1 && std::is_same<Tag, LevenbergMarquardtNormalEqTag>::value){
+      throw std::runtime_error("Jacobian reuse is not supported for Levenberg-Marquardt");
+    }
+    jacobianReuse_.setUpdateFrequency(value);
+  }
+  // force a Jacobian update when ||r_k|| > value * ||r_k-1||
+  void setJacobianUpdateRateThreshold(ScalarType value) { jacobianReuse_.setRateThreshold(value); }
+  // keep the Jacobian from the previous call to solve, e.g. across time steps
+  void setJacobianReuseAcrossSolves(bool value) { jacobianReuse_.setReuseAcrossSolves(value); }
+  void invalidateJacobian()                   { jacobianReuse_.invalidate(); }
+  int numJacobianEvaluations() const          { return jacobianReuse_.numEvaluations(); }
+
   // this method can be used when passing a system object
   // that is different but syntactically and semantically equivalent
   // to the one used for constructing the solver
   template<class SystemType>
   void solve(const SystemType & system, StateType & solutionInOut)
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("solvers::nonlinear");
     switch (updateEnValue_)
     {
       case Update::Standard:
@@ -214,7 +247,7 @@ private:
     nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				stopEnValue_, stopTolerance_,
 				diagnostics_, diagnosticsLogger_,
-				maxIters_,
+				maxIters_, jacobianReuse_,
 				DefaultUpdater());
   }
 
@@ -234,13 +267,13 @@ private:
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
 				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
+				  maxIters_, jacobianReuse_,
 				  BacktrackStrictlyDecreasingObjectiveUpdater{});
     }else{
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
 				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
+				  maxIters_, jacobianReuse_,
 				  BacktrackStrictlyDecreasingObjectiveUpdater{});
     }
   }
@@ -263,14 +296,14 @@ private:
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
 				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
+				  maxIters_, jacobianReuse_,
 				  up_t(solutionInOut));
     }else{
       using up_t = LMSchedule2Updater<ScalarType, StateType>;
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
 				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
+				  maxIters_, jacobianReuse_,
 				  up_t(solutionInOut));
     }
   }
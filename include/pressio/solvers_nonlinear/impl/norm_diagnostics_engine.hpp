@@ -0,0 +1,270 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// norm_diagnostics_engine.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_NONLINEAR_IMPL_NORM_DIAGNOSTICS_ENGINE_HPP_
+#define SOLVERS_NONLINEAR_IMPL_NORM_DIAGNOSTICS_ENGINE_HPP_
+
+#include <array>
+#include <cmath>
+
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+#include <Teuchos_CommHelpers.hpp>
+#include <KokkosBlas1_dot.hpp>
+#endif
+
+namespace pressio{
+namespace nonlinearsolvers{
+namespace impl{
+
+/*
+  Distributed operands contribute their local sum of squares to a
+  batched reduction instead of calling their own norm2, which would
+  be one global reduction per operand.
+  Operands that are not distributed (e.g. the Eigen reduced vectors
+  of a ROM) keep using ops::norm2 directly, since that is purely local.
+*/
+template<class T, class = void>
+struct Norm2PartialSum{
+  static constexpr bool distributed = false;
+};
+
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+template<class T>
+struct Norm2PartialSum<
+  T, std::enable_if_t< ::pressio::is_vector_tpetra<T>::value >
+  >
+{
+  static constexpr bool distributed = true;
+
+  static auto comm(const T & operand){ return operand.getMap()->getComm(); }
+
+  template<class ScalarType>
+  static ScalarType localSumOfSquares(const T & operand)
+  {
+    // Tpetra::Vector is a rank-2 view with one column
+    const auto localView = operand.getLocalViewDevice(Tpetra::Access::ReadOnly);
+    const auto column = Kokkos::subview(localView, Kokkos::ALL(), 0);
+    return static_cast<ScalarType>(::KokkosBlas::dot(column, column));
+  }
+};
+#endif
+
+/*
+  Computes a small fixed set of l2 norms with at most one global
+  reduction: norms of distributed operands are accumulated as local
+  partial sums and reduced together. All distributed operands are
+  assumed to live on the same communicator, which is the case for
+  the residual, correction and gradient of a nonlinear system.
+*/
+template<class ScalarType, int N>
+class BatchedNorms2
+{
+  std::array<ScalarType, N> values_ = {};
+  std::array<bool, N> isPartial_ = {};
+  int numPartials_ = 0;
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+  Teuchos::RCP<const Teuchos::Comm<int>> comm_ = {};
+#endif
+
+public:
+  template<class T>
+  std::enable_if_t< !Norm2PartialSum<T>::distributed >
+  add(int slot, const T & operand){
+    values_[slot] = ::pressio::ops::norm2(operand);
+  }
+
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+  template<class T>
+  std::enable_if_t< Norm2PartialSum<T>::distributed >
+  add(int slot, const T & operand){
+    values_[slot] = Norm2PartialSum<T>::template localSumOfSquares<ScalarType>(operand);
+    isPartial_[slot] = true;
+    ++numPartials_;
+    comm_ = Norm2PartialSum<T>::comm(operand);
+  }
+#endif
+
+  void reduce()
+  {
+#ifdef PRESSIO_ENABLE_TPL_TRILINOS
+    if (numPartials_ == 0){ return; }
+
+    std::array<ScalarType, N> local = {};
+    std::array<ScalarType, N> global = {};
+    int count = 0;
+    for (int i=0; i<N; ++i){
+      if (isPartial_[i]){ local[count++] = values_[i]; }
+    }
+    Teuchos::reduceAll(*comm_, Teuchos::REDUCE_SUM, count, local.data(), global.data());
+
+    count = 0;
+    for (int i=0; i<N; ++i){
+      if (isPartial_[i]){ values_[i] = std::sqrt(global[count++]); }
+    }
+#endif
+  }
+
+  ScalarType operator[](int slot) const { return values_[slot]; }
+};
+
+/*
+  Decides, once per solve, which norm diagnostics the solving loop
+  really needs and computes only those at every iteration:
+  - the one used by the stop criterion,
+  - all the ones registered in the diagnostics, but only if they
+    are going to be logged, i.e. a sink accepts info messages,
+  - the ones the loop itself needs (e.g. ||r|| for a line search).
+  A norm the loop already knows (e.g. ||r|| recovered from the
+  objective 1/2 ||r||^2) can be set, so it is not recomputed.
+  The others are batched into a single reduction, see BatchedNorms2.
+
+  Note: the log level must be the same on all ranks, since it
+  decides which reductions are done.
+*/
+template<class ScalarType>
+class NormDiagnosticsEngine
+{
+  // the norm diagnostics are the first entries of InternalDiagnostic
+  static constexpr int numNorms_ = 3;
+  std::array<bool, numNorms_> needed_ = {};
+  std::array<bool, numNorms_> known_ = {};
+  std::array<ScalarType, numNorms_> knownValues_ = {};
+  bool mustLog_ = false;
+
+  static int slot(InternalDiagnostic d){ return static_cast<int>(d); }
+  static bool isNorm(InternalDiagnostic d){
+    return d == InternalDiagnostic::correctionAbsoluteRelativel2Norm
+      || d == InternalDiagnostic::residualAbsoluteRelativel2Norm
+      || d == InternalDiagnostic::gradientAbsoluteRelativel2Norm;
+  }
+
+public:
+  template<class DiagnosticsContainerType>
+  NormDiagnosticsEngine(const DiagnosticsContainerType & diagnostics,
+			Stop stopEnumValue)
+    : mustLog_(::pressio::log::isEnabledFor(::pressio::log::level::info))
+  {
+    for (const auto d : {InternalDiagnostic::correctionAbsoluteRelativel2Norm,
+			 InternalDiagnostic::residualAbsoluteRelativel2Norm,
+			 InternalDiagnostic::gradientAbsoluteRelativel2Norm}){
+      needed_[slot(d)] = mustLog_ && diagnostics.contains(d);
+    }
+
+    if (stopEnumValue != Stop::AfterMaxIters){
+      require(public_to_internal_diagnostic(stop_criterion_to_public_diagnostic(stopEnumValue)));
+    }
+  }
+
+  // for norms the loop itself needs, whether or not they are logged
+  void require(InternalDiagnostic d){
+    if (isNorm(d)){ needed_[slot(d)] = true; }
+  }
+
+  bool mustLog() const { return mustLog_; }
+
+  bool isNeeded(InternalDiagnostic d) const {
+    return isNorm(d) && needed_[slot(d)];
+  }
+
+  void setKnown(InternalDiagnostic d, ScalarType value){
+    if (isNeeded(d)){
+      known_[slot(d)] = true;
+      knownValues_[slot(d)] = value;
+    }
+  }
+
+  template<class RegistryType, class DiagnosticsContainerType>
+  void compute(const RegistryType & reg,
+	       bool isInitial,
+	       DiagnosticsContainerType & diagnostics)
+  {
+    BatchedNorms2<ScalarType, numNorms_> norms;
+    addIfNeeded(CorrectionTag{}, InternalDiagnostic::correctionAbsoluteRelativel2Norm, reg, norms);
+    addIfNeeded(ResidualTag{},   InternalDiagnostic::residualAbsoluteRelativel2Norm,   reg, norms);
+    addIfNeeded(GradientTag{},   InternalDiagnostic::gradientAbsoluteRelativel2Norm,   reg, norms);
+    norms.reduce();
+
+    for (const auto d : {InternalDiagnostic::correctionAbsoluteRelativel2Norm,
+			 InternalDiagnostic::residualAbsoluteRelativel2Norm,
+			 InternalDiagnostic::gradientAbsoluteRelativel2Norm}){
+      const int i = slot(d);
+      if (needed_[i] && diagnostics.contains(d)){
+	diagnostics[d].update(known_[i] ? knownValues_[i] : norms[i], isInitial);
+      }
+      known_[i] = false;
+    }
+  }
+
+private:
+  template<class Tag, class RegistryType, class BatchType>
+  std::enable_if_t< RegistryType::template contains<Tag>() >
+  addIfNeeded(Tag /*t*/, InternalDiagnostic d,
+	      const RegistryType & reg, BatchType & norms) const
+  {
+    const int i = slot(d);
+    if (needed_[i] && !known_[i]){
+      norms.add(i, reg.template get<Tag>());
+    }
+  }
+
+  template<class Tag, class RegistryType, class BatchType>
+  std::enable_if_t< !RegistryType::template contains<Tag>() >
+  addIfNeeded(Tag /*t*/, InternalDiagnostic /*d*/,
+	      const RegistryType & /*reg*/, BatchType & /*norms*/) const
+  { /* noop */ }
+};
+
+// true if the objective of the problem is 1/2 ||r||^2, so ||r|| comes for free
+template<class ProblemTag>
+struct objective_is_half_squared_residual_norm : std::true_type{};
+
+template<>
+struct objective_is_half_squared_residual_norm<WeightedGaussNewtonNormalEqTag> : std::false_type{};
+
+}}}
+#endif
@@ -308,5 +308,167 @@ public:
   GETMETHOD(10)
 };
 
+template<class SystemType, class InnSolverType>
+class RegistryBroyden
+{
+  using state_t    = typename SystemType::state_type;
+  using r_t        = typename SystemType::residual_type;
+  using j_t        = typename SystemType::jacobian_type;
+  using history_t  = LimitedMemoryInverseBroyden<state_t, r_t>;
+
+  using Tag1 = nonlinearsolvers::CorrectionTag;
+  using Tag2 = nonlinearsolvers::InitialGuessTag;
+  using Tag3 = nonlinearsolvers::ResidualTag;
+  using Tag4 = nonlinearsolvers::JacobianTag;
+  using Tag5 = nonlinearsolvers::InnerSolverTag;
+  using Tag6 = nonlinearsolvers::impl::SystemTag;
+  using Tag7 = nonlinearsolvers::impl::BroydenHistoryTag;
+
+  state_t d1_;
+  state_t d2_;
+  r_t d3_;
+  j_t d4_;
+  utils::InstanceOrReferenceWrapper<InnSolverType> d5_;
+  SystemType const * d6_;
+  history_t d7_;
+
+public:
+  template<class _InnSolverType>
+  RegistryBroyden(const SystemType & system, _InnSolverType && innS)
+    : d1_(system.createState()),
+      d2_(system.createState()),
+      d3_(system.createResidual()),
+      d4_(system.createJacobian()),
+      d5_(std::forward<_InnSolverType>(innS)),
+      d6_(&system),
+      d7_(d1_, d3_){}
+
+  template<class TagToFind>
+  static constexpr bool contains(){
+    return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
+	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7>::value) < 7;
+  }
+
+  GETMETHOD(1)
+  GETMETHOD(2)
+  GETMETHOD(3)
+  GETMETHOD(4)
+  GETMETHOD(5)
+  GETMETHOD(6)
+  GETMETHOD(7)
+};
+
+template<class SystemType, class InnSolverType>
+class RegistryGaussNewtonBroydenNormalEqs
+{
+  using state_t    = typename SystemType::state_type;
+  using r_t        = typename SystemType::residual_type;
+  using j_t        = typename SystemType::jacobian_type;
+  using hg_default = normal_eqs_default_types<state_t>;
+  using hessian_t  = typename hg_default::hessian_type;
+  using gradient_t = typename hg_default::gradient_type;
+  using updater_t  = BroydenJacobianUpdater<state_t, r_t>;
+
+  using Tag1 = nonlinearsolvers::CorrectionTag;
+  using Tag2 = nonlinearsolvers::InitialGuessTag;
+  using Tag3 = nonlinearsolvers::ResidualTag;
+  using Tag4 = nonlinearsolvers::JacobianTag;
+  using Tag5 = nonlinearsolvers::GradientTag;
+  using Tag6 = nonlinearsolvers::HessianTag;
+  using Tag7 = nonlinearsolvers::InnerSolverTag;
+  using Tag8 = nonlinearsolvers::impl::SystemTag;
+  using Tag9 = nonlinearsolvers::impl::BroydenHistoryTag;
+
+  state_t d1_;
+  state_t d2_;
+  r_t d3_;
+  j_t d4_;
+  gradient_t d5_;
+  hessian_t d6_;
+  utils::InstanceOrReferenceWrapper<InnSolverType> d7_;
+  SystemType const * d8_;
+  updater_t d9_;
+
+public:
+  template<class _InnSolverType>
+  RegistryGaussNewtonBroydenNormalEqs(const SystemType & system, _InnSolverType && innS)
+    : d1_(system.createState()),
+      d2_(system.createState()),
+      d3_(system.createResidual()),
+      d4_(system.createJacobian()),
+      d5_(system.createState()),
+      d6_( hg_default::createHessian(system.createState()) ),
+      d7_(std::forward<_InnSolverType>(innS)),
+      d8_(&system),
+      d9_(d1_, d3_){}
+
+  template<class TagToFind>
+  static constexpr bool contains(){
+    return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
+	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8, Tag9>::value) < 9;
+  }
+
+  GETMETHOD(1)
+  GETMETHOD(2)
+  GETMETHOD(3)
+  GETMETHOD(4)
+  GETMETHOD(5)
+  GETMETHOD(6)
+  GETMETHOD(7)
+  GETMETHOD(8)
+  GETMETHOD(9)
+};
+
+template<class SystemType, class InnSolverType, class PreconditionerType>
+class RegistryJacobianFreeNewtonKrylov
+{
+  using state_t    = typename SystemType::state_type;
+  using r_t        = typename SystemType::residual_type;
+  using action_t   = FiniteDifferenceJacobianAction<SystemType>;
+
+  using Tag1 = nonlinearsolvers::CorrectionTag;
+  using Tag2 = nonlinearsolvers::InitialGuessTag;
+  using Tag3 = nonlinearsolvers::ResidualTag;
+  using Tag4 = nonlinearsolvers::InnerSolverTag;
+  using Tag5 = nonlinearsolvers::impl::SystemTag;
+  using Tag6 = nonlinearsolvers::impl::JacobianActionTag;
+  using Tag7 = nonlinearsolvers::impl::PreconditionerTag;
+
+  state_t d1_;
+  state_t d2_;
+  r_t d3_;
+  utils::InstanceOrReferenceWrapper<InnSolverType> d4_;
+  SystemType const * d5_;
+  action_t d6_;
+  utils::InstanceOrReferenceWrapper<PreconditionerType> d7_;
+
+public:
+  template<class _InnSolverType, class _PreconditionerType>
+  RegistryJacobianFreeNewtonKrylov(const SystemType & system,
+				   _InnSolverType && innS,
+				   _PreconditionerType && prec)
+    : d1_(system.createState()),
+      d2_(system.createState()),
+      d3_(system.createResidual()),
+      d4_(std::forward<_InnSolverType>(innS)),
+      d5_(&system),
+      d6_(system),
+      d7_(std::forward<_PreconditionerType>(prec)){}
+
+  template<class TagToFind>
+  static constexpr bool contains(){
+    return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
+	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7>::value) < 7;
+  }
+
+  GETMETHOD(1)
+  GETMETHOD(2)
+  GETMETHOD(3)
+  GETMETHOD(4)
+  GETMETHOD(5)
+  GETMETHOD(6)
+  GETMETHOD(7)
+};
+
 }}}
 #endif
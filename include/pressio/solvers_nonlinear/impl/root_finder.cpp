@@ -2,6 +2,8 @@
 #ifndef SOLVERS_NONLINEAR_IMPL_ROOT_FINDER_HPP_
 #define SOLVERS_NONLINEAR_IMPL_ROOT_FINDER_HPP_
 
+#include <utility>
+
 namespace pressio{
 namespace nonlinearsolvers{
 namespace impl{
@@ -14,7 +16,7 @@ template<
   class NormDiagnosticsContainerType,
   class DiagnosticsLoggerType,
   class UpdaterType>
-void root_solving_loop_impl(ProblemTag /*problemTag*/,
+void root_solving_loop_impl(ProblemTag problemTag,
           const UserDefinedSystemType & system,
           RegistryType & reg,
           Stop stopEnumValue,
@@ -22,6 +24,7 @@ void root_solving_loop_impl(ProblemTag /*problemTag*/,
           NormDiagnosticsContainerType & normDiagnostics,
           const DiagnosticsLoggerType & logger,
           int maxIters,
+          JacobianReuseTracker<ToleranceType> & jacobianReuse,
           UpdaterType && updater)
 {
 
@@ -55,11 +58,23 @@ void root_solving_loop_impl(ProblemTag /*problemTag*/,
     };
   };
 
+  jacobianReuse.resetForNewSolve();
+
+  // only the norms needed by the stop criterion and the logging are computed,
+  // the line search updaters also need ||r|| as their current objective
+  constexpr bool updaterUsesObjective =
+    !std::is_same<mpl::remove_cvref_t<UpdaterType>, DefaultUpdater>::value;
+  NormDiagnosticsEngine<ToleranceType> diagnosticsEngine(normDiagnostics, stopEnumValue);
+  if (updaterUsesObjective){
+    diagnosticsEngine.require(InternalDiagnostic::residualAbsoluteRelativel2Norm);
+  }
+
   int iStep = 0;
   while (++iStep <= maxIters){
     /* stage 1 */
+    bool jacobianUpdated = true;
     try{
-      compute_residual_and_jacobian(reg, system);
+      jacobianUpdated = compute_residual_and_jacobian_if_needed(reg, system, jacobianReuse);
     }
     catch (::pressio::eh::ResidualEvaluationFailureUnrecoverable const &e){
       PRESSIOLOG_CRITICAL(e.what());
@@ -71,15 +86,13 @@ void root_solving_loop_impl(ProblemTag /*problemTag*/,
     }
 
     /* stage 2 */
-    solve_newton_step(reg);
+    compute_correction(problemTag, reg, jacobianUpdated);
 
     /* stage 3 */
-    std::for_each(normDiagnostics.begin(), normDiagnostics.end(),
-      [&reg, iStep](auto & v){
-        const bool isFirstIteration = iStep==1;
-        compute_norm_internal_diagnostics(reg, isFirstIteration, v);
-      });
-    logger(iStep, normDiagnostics);
+    diagnosticsEngine.compute(reg, iStep==1, normDiagnostics);
+    if (diagnosticsEngine.mustLog()){
+      logger(iStep, normDiagnostics);
+    }
 
     /* stage 4*/
     if (mustStop(iStep)){
@@ -120,6 +133,7 @@ class RootFinder : public RegistryType
     InternalDiagnosticDataWithAbsoluteRelativeTracking<NormValueType> >;
   norm_diagnostics_container normDiagnostics_;
   DiagnosticsLogger diagnosticsLogger_ = {};
+  JacobianReuseTracker<NormValueType> jacobianReuse_ = {};
 
 public:
   template<class ...Args>
@@ -157,9 +171,21 @@ public:
   void setStopTolerance(NormValueType value) { stopTolerance_ = value; }
   void setMaxIterations(int newMax)          { maxIters_ = newMax; }
 
+  // modified Newton: reuse the Jacobian, and its factorization if the
+  // linear solver supports it, for up to "value" iterations.
+  // The default value = 1 corresponds to the standard Newton.
+  void setJacobianUpdateFrequency(int value)  { jacobianReuse_.setUpdateFrequency(value); }
+  // force a Jacobian update when ||r_k|| > value * ||r_k-1||
+  void setJacobianUpdateRateThreshold(NormValueType value) { jacobianReuse_.setRateThreshold(value); }
+  // keep the Jacobian from the previous call to solve, e.g. across time steps
+  void setJacobianReuseAcrossSolves(bool value) { jacobianReuse_.setReuseAcrossSolves(value); }
+  void invalidateJacobian()                   { jacobianReuse_.invalidate(); }
+  int numJacobianEvaluations() const          { return jacobianReuse_.numEvaluations(); }
+
   template<class SystemType>
   void solve(const SystemType & system, StateType & solutionInOut)
   {
+    PRESSIO_INSTRUMENTATION_SCOPE("solvers::nonlinear");
     // deep copy the initial guess
     ::pressio::ops::deep_copy(this->template get<InitialGuessTag>(), solutionInOut);
 
@@ -167,9 +193,10 @@ public:
     {
       auto extReg = reference_capture_registry_and_extend_with<
 	StateTag, StateType &>(*this, solutionInOut);
+      reset_for_new_solve_loop(tag_, extReg);
       root_solving_loop_impl(tag_, system, extReg, stopEnValue_, stopTolerance_,
 			     normDiagnostics_, diagnosticsLogger_, maxIters_,
-			     DefaultUpdater());
+			     jacobianReuse_, DefaultUpdater());
 
     }
     else if (updateEnValue_ == Update::BacktrackStrictlyDecreasingObjective)
@@ -177,10 +204,11 @@ public:
       auto extReg = reference_capture_registry_and_extend_with<
 	StateTag, LineSearchTrialStateTag,
 	StateType &, StateType>(*this, solutionInOut, system.createState());
+      reset_for_new_solve_loop(tag_, extReg);
 
       root_solving_loop_impl(tag_, system, extReg, stopEnValue_, stopTolerance_,
 			     normDiagnostics_, diagnosticsLogger_, maxIters_,
-			     BacktrackStrictlyDecreasingObjectiveUpdater{});
+			     jacobianReuse_, BacktrackStrictlyDecreasingObjectiveUpdater{});
 
     }
     else{
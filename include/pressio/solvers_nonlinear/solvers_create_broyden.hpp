@@ -0,0 +1,264 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// solvers_create_broyden.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_NONLINEAR_SOLVERS_CREATE_BROYDEN_HPP_
+#define SOLVERS_NONLINEAR_SOLVERS_CREATE_BROYDEN_HPP_
+
+#include "solvers_default_types.hpp"
+#include "./impl/solvers_tagbased_registry.hpp"
+#include "./impl/internal_tags.hpp"
+#include "./impl/jacobian_reuse.hpp"
+#include "./impl/broyden.hpp"
+#include "./impl/jacobian_free.hpp"
+#include "./impl/registries.hpp"
+#include "./impl/diagnostics.hpp"
+#include "./impl/functions.hpp"
+#include "./impl/norm_diagnostics_engine.hpp"
+#include "./impl/updaters.hpp"
+#include "./impl/root_finder.cpp"
+#include "./impl/nonlinear_least_squares.hpp"
+
+namespace pressio{
+
+namespace nonlinearsolvers{ namespace impl{
+
+// by default, the Jacobian is evaluated at the first iteration and then
+// only every 10 Broyden updates or when the residual norm decreases
+// by less than 10 percent, so that the memory used by the
+// limited-memory updates stays bounded
+constexpr int broyden_default_jacobian_update_frequency = 10;
+
+template<class ScalarType>
+constexpr ScalarType broyden_default_jacobian_update_rate_threshold(){
+  return static_cast<ScalarType>(0.9);
+}
+
+template<class Tag, class SystemType, class LinearSolverType>
+auto create_broyden_root_finder(const SystemType & system,
+				LinearSolverType && linSolver)
+{
+  using nonlinearsolvers::Diagnostic;
+  const std::vector<Diagnostic> diagnostics =
+    {Diagnostic::residualAbsolutel2Norm,
+     Diagnostic::residualRelativel2Norm,
+     Diagnostic::correctionAbsolutel2Norm,
+     Diagnostic::correctionRelativel2Norm};
+
+  using state_t  = typename SystemType::state_type;
+  using reg_t    = RegistryBroyden<SystemType, LinearSolverType>;
+  using scalar_t = nonlinearsolvers::scalar_of_t<SystemType>;
+  RootFinder<Tag, state_t, reg_t, scalar_t> solver
+    (Tag{}, diagnostics, system, std::forward<LinearSolverType>(linSolver));
+  solver.setJacobianUpdateFrequency(broyden_default_jacobian_update_frequency);
+  solver.setJacobianUpdateRateThreshold(
+    broyden_default_jacobian_update_rate_threshold<scalar_t>());
+  return solver;
+}
+}} // end namespace nonlinearsolvers::impl
+
+/*
+  Quasi-Newton (Broyden) solvers for r(x) = 0, for r \in R^n and x \in R^n.
+
+  These are drop-in replacements of the Newton solver for problems where
+  the Jacobian is expensive to evaluate: the exact Jacobian is only
+  evaluated (and factorized, if the linear solver supports reusing
+  the factorization) at the first iteration and when the convergence
+  stagnates, while all the other iterations use a limited-memory
+  rank-1 update of the inverse Jacobian costing a few vector operations.
+  See setJacobianUpdateFrequency and setJacobianUpdateRateThreshold
+  to control when the Jacobian is re-evaluated.
+
+  - good Broyden updates the Jacobian, i.e. minimizes the change of J
+  - bad Broyden updates the inverse Jacobian, i.e. minimizes the change of J^{-1}
+
+  preconditions, effects and post-conditions are the same as create_newton_solver
+*/
+
+template<class SystemType, class LinearSolverType>
+#ifdef PRESSIO_ENABLE_CXX20
+  requires nonlinearsolvers::RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>
+  && (Traits<typename SystemType::state_type>::rank    == 1)
+  && (Traits<typename SystemType::residual_type>::rank == 1)
+  && (Traits<typename SystemType::jacobian_type>::rank == 2)
+  && requires(typename SystemType::state_type    & a,
+	      typename SystemType::state_type    & b,
+	      typename SystemType::state_type    & c,
+	      typename SystemType::residual_type & r,
+	      typename SystemType::jacobian_type & J,
+	      nonlinearsolvers::scalar_of_t<SystemType> alpha,
+	      nonlinearsolvers::scalar_of_t<SystemType> beta,
+	      nonlinearsolvers::scalar_of_t<SystemType> gamma,
+	      LinearSolverType && linSolver)
+  {
+    { ::pressio::ops::norm2(std::as_const(a)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::norm2(std::as_const(r)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::dot(std::as_const(a), std::as_const(b)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::dot(std::as_const(r), std::as_const(r)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+
+    { ::pressio::ops::deep_copy(b, std::as_const(a)) };
+    { ::pressio::ops::scale (a, alpha) };
+    { ::pressio::ops::update(a,	alpha, std::as_const(b), beta) };
+    { ::pressio::ops::update(a,	alpha, std::as_const(b), beta, std::as_const(c), gamma) };
+
+    { linSolver.solve(std::as_const(J), std::as_const(r), a) };
+  }
+#endif
+auto create_broyden_good_solver(const SystemType & system,
+				LinearSolverType && linSolver)
+{
+  using tag = nonlinearsolvers::impl::BroydenGoodTag;
+  return nonlinearsolvers::impl::create_broyden_root_finder<tag>
+    (system, std::forward<LinearSolverType>(linSolver));
+}
+
+template<class SystemType, class LinearSolverType>
+#ifdef PRESSIO_ENABLE_CXX20
+  requires nonlinearsolvers::RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>
+  && (Traits<typename SystemType::state_type>::rank    == 1)
+  && (Traits<typename SystemType::residual_type>::rank == 1)
+  && (Traits<typename SystemType::jacobian_type>::rank == 2)
+  && requires(typename SystemType::state_type    & a,
+	      typename SystemType::state_type    & b,
+	      typename SystemType::state_type    & c,
+	      typename SystemType::residual_type & r,
+	      typename SystemType::jacobian_type & J,
+	      nonlinearsolvers::scalar_of_t<SystemType> alpha,
+	      nonlinearsolvers::scalar_of_t<SystemType> beta,
+	      nonlinearsolvers::scalar_of_t<SystemType> gamma,
+	      LinearSolverType && linSolver)
+  {
+    { ::pressio::ops::norm2(std::as_const(a)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::norm2(std::as_const(r)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::dot(std::as_const(r), std::as_const(r)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+
+    { ::pressio::ops::deep_copy(b, std::as_const(a)) };
+    { ::pressio::ops::scale (a, alpha) };
+    { ::pressio::ops::update(a,	alpha, std::as_const(b), beta) };
+    { ::pressio::ops::update(a,	alpha, std::as_const(b), beta, std::as_const(c), gamma) };
+
+    { linSolver.solve(std::as_const(J), std::as_const(r), a) };
+  }
+#endif
+auto create_broyden_bad_solver(const SystemType & system,
+			       LinearSolverType && linSolver)
+{
+  using tag = nonlinearsolvers::impl::BroydenBadTag;
+  return nonlinearsolvers::impl::create_broyden_root_finder<tag>
+    (system, std::forward<LinearSolverType>(linSolver));
+}
+
+/*
+  Broyden Gauss-Newton for the nonlinear least squares problems:
+  same as Gauss-Newton with the normal equations, but the Jacobian is
+  only evaluated at the first iteration and when the convergence
+  stagnates, while in all other iterations it is corrected with a
+  rank-1 secant update, J += (y - J s) s^T / (s^T s).
+  The Hessian is recomputed after every update.
+  Since ops has no rank-1 (outer product) update, this currently
+  requires Eigen state and residual vectors and a dense Eigen Jacobian.
+*/
+template<class SystemType, class LinearSolverType>
+#ifdef PRESSIO_ENABLE_CXX20
+  requires nonlinearsolvers::RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>
+  && nonlinearsolvers::valid_state_for_least_squares<typename SystemType::state_type>::value
+  && (Traits<typename SystemType::state_type>::rank    == 1)
+  && (Traits<typename SystemType::residual_type>::rank == 1)
+  && (Traits<typename SystemType::jacobian_type>::rank == 2)
+  && ::pressio::is_vector_eigen<typename SystemType::state_type>::value
+  && ::pressio::is_vector_eigen<typename SystemType::residual_type>::value
+  && ::pressio::is_dense_matrix_eigen<typename SystemType::jacobian_type>::value
+  && requires(
+	    typename SystemType::state_type    & x,
+      const typename SystemType::jacobian_type & J,
+      const typename SystemType::residual_type & r,
+      nonlinearsolvers::normal_eqs_default_hessian_t<typename SystemType::state_type>  & H,
+      nonlinearsolvers::normal_eqs_default_gradient_t<typename SystemType::state_type> & g,
+      LinearSolverType && linSolver)
+  {
+    { ::pressio::ops::norm2(r) } -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::dot(x, x) } -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::product(transpose(), nontranspose(), 1, J, 0, H) };
+    { ::pressio::ops::product(transpose(), 1, J, r, 0, g) };
+    { linSolver.solve(std::as_const(H), std::as_const(g), x) };
+  }
+#endif
+auto create_broyden_gauss_newton_solver(const SystemType & system,
+					LinearSolverType && linSolver)
+{
+  using nonlinearsolvers::Diagnostic;
+  const std::vector<Diagnostic> defaultDiagnostics =
+    {Diagnostic::objectiveAbsolute,
+     Diagnostic::objectiveRelative,
+     Diagnostic::residualAbsolutel2Norm,
+     Diagnostic::residualRelativel2Norm,
+     Diagnostic::correctionAbsolutel2Norm,
+     Diagnostic::correctionRelativel2Norm,
+     Diagnostic::gradientAbsolutel2Norm,
+     Diagnostic::gradientRelativel2Norm};
+
+  using tag      = nonlinearsolvers::impl::GaussNewtonBroydenNormalEqTag;
+  using state_t  = typename SystemType::state_type;
+  using reg_t    = nonlinearsolvers::impl::RegistryGaussNewtonBroydenNormalEqs<SystemType, LinearSolverType>;
+  using scalar_t = nonlinearsolvers::scalar_of_t<SystemType>;
+  nonlinearsolvers::impl::NonLinLeastSquares<tag, state_t, reg_t, scalar_t> solver
+    (tag{}, defaultDiagnostics, system, std::forward<LinearSolverType>(linSolver));
+  solver.setJacobianUpdateFrequency(nonlinearsolvers::impl::broyden_default_jacobian_update_frequency);
+  solver.setJacobianUpdateRateThreshold(
+    nonlinearsolvers::impl::broyden_default_jacobian_update_rate_threshold<scalar_t>());
+  return solver;
+}
+
+} //end namespace pressio
+#endif  // SOLVERS_NONLINEAR_SOLVERS_CREATE_BROYDEN_HPP_
@@ -52,9 +52,13 @@
 #include "solvers_default_types.hpp"
 #include "./impl/solvers_tagbased_registry.hpp"
 #include "./impl/internal_tags.hpp"
+#include "./impl/jacobian_reuse.hpp"
+#include "./impl/broyden.hpp"
+#include "./impl/jacobian_free.hpp"
 #include "./impl/registries.hpp"
 #include "./impl/diagnostics.hpp"
 #include "./impl/functions.hpp"
+#include "./impl/norm_diagnostics_engine.hpp"
 #include "./impl/updaters.hpp"
 #include "./impl/nonlinear_least_squares.hpp"
 
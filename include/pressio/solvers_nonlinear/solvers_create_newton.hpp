@@ -52,9 +52,13 @@
 #include "solvers_default_types.hpp"
 #include "./impl/solvers_tagbased_registry.hpp"
 #include "./impl/internal_tags.hpp"
+#include "./impl/jacobian_reuse.hpp"
+#include "./impl/broyden.hpp"
+#include "./impl/jacobian_free.hpp"
 #include "./impl/registries.hpp"
 #include "./impl/diagnostics.hpp"
 #include "./impl/functions.hpp"
+#include "./impl/norm_diagnostics_engine.hpp"
 #include "./impl/updaters.hpp"
 #include "./impl/root_finder.cpp"
 
@@ -128,5 +132,83 @@ auto create_newton_solver(const SystemType & system,
     (tag{}, diagnostics, system, std::forward<LinearSolverType>(linSolver));
 }
 
+/*
+  Jacobian-free Newton-Krylov (JFNK) for r(x) = 0, for r \in R^n and x \in R^n.
+
+  Same as Newton, but the Jacobian is never formed: the linear solver
+  only accesses J through its action on a vector, Jv, approximated via
+  a forward finite difference of the residual, which is computed
+  with residualAndJacobian passing an empty Jacobian.
+  Therefore, the linear solver must be matrix-free, e.g.
+  pressio::linearsolvers::MatrixFreeGmres, and have a method:
+    solve(const A &, const M &, const residual_type & b, state_type & x)
+  where A(v, Av) is the Jacobian action and M(v, z) the preconditioner.
+
+  The optional preconditioner applies the inverse of an approximation
+  of J (right preconditioning): M(v, z) computes z = M^{-1} v.
+  If the preconditioner has a method update(state, residual), this is
+  called at every nonlinear iteration before the linear solve.
+
+  preconditions, effects and post-conditions are the same as
+  create_newton_solver, and also apply to the preconditioner.
+*/
+template<class SystemType, class LinearSolverType, class PreconditionerType>
+#ifdef PRESSIO_ENABLE_CXX20
+  requires nonlinearsolvers::RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>
+  && std::same_as<typename SystemType::state_type, typename SystemType::residual_type>
+  && (Traits<typename SystemType::state_type>::rank    == 1)
+  && requires(typename SystemType::state_type & a,
+	      const typename SystemType::state_type & b,
+	      PreconditionerType && prec,
+	      nonlinearsolvers::scalar_of_t<SystemType> alpha)
+  {
+    { ::pressio::ops::norm2(b) } -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::dot(b, b) } -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::set_zero(a) };
+    { ::pressio::ops::scale(a, alpha) };
+    { ::pressio::ops::update(a, alpha, b, alpha) };
+    { ::pressio::ops::update(a, alpha, b, alpha, b, alpha) };
+    { prec(b, a) };
+  }
+#endif
+auto create_jacobian_free_newton_krylov_solver(const SystemType & system,
+					       LinearSolverType && linSolver,
+					       PreconditionerType && preconditioner)
+{
+  static_assert(std::is_same<typename SystemType::state_type,
+		typename SystemType::residual_type>::value,
+		"Jacobian-free Newton-Krylov requires the state and residual to be of the same type");
+
+  using nonlinearsolvers::Diagnostic;
+  const std::vector<Diagnostic> diagnostics =
+    {Diagnostic::residualAbsolutel2Norm,
+     Diagnostic::residualRelativel2Norm,
+     Diagnostic::correctionAbsolutel2Norm,
+     Diagnostic::correctionRelativel2Norm};
+
+  using tag      = nonlinearsolvers::impl::JacobianFreeNewtonKrylovTag;
+  using state_t  = typename SystemType::state_type;
+  using reg_t    = nonlinearsolvers::impl::RegistryJacobianFreeNewtonKrylov<
+    SystemType, LinearSolverType, PreconditionerType>;
+  using scalar_t = nonlinearsolvers::scalar_of_t<SystemType>;
+  return nonlinearsolvers::impl::RootFinder<tag, state_t, reg_t, scalar_t>
+    (tag{}, diagnostics, system,
+     std::forward<LinearSolverType>(linSolver),
+     std::forward<PreconditionerType>(preconditioner));
+}
+
+template<class SystemType, class LinearSolverType>
+#ifdef PRESSIO_ENABLE_CXX20
+  requires nonlinearsolvers::RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>
+  && std::same_as<typename SystemType::state_type, typename SystemType::residual_type>
+#endif
+auto create_jacobian_free_newton_krylov_solver(const SystemType & system,
+					       LinearSolverType && linSolver)
+{
+  return create_jacobian_free_newton_krylov_solver
+    (system, std::forward<LinearSolverType>(linSolver),
+     linearsolvers::impl::IdentityPreconditioner{});
+}
+
 } //end namespace pressio
 #endif  // SOLVERS_NONLINEAR_SOLVERS_CREATE_PUBLIC_API_HPP_
@@ -52,6 +52,9 @@
 #include "./mpl.hpp"
 #include <iomanip>
 
+// must come before any Eigen header, see the file for details
+#include "./utils/utils_instrumentation.hpp"
+
 #include "./utils/utils_static_constants.hpp"
 #include "./utils/utils_make_unique.hpp"
 #include "./utils/utils_instance_or_reference_wrapper.hpp"
@@ -138,6 +138,28 @@ template <typename T= void> void setVerbosity(std::initializer_list<::pressio::l
 #endif
 }
 
+// true if a message at the given level would be written by at least one sink,
+// so callers can skip computing values that are only meant to be logged
+template <typename T = void>
+bool isEnabledFor(::pressio::log::level lvl)
+{
+#if PRESSIO_LOG_ACTIVE_MIN_LEVEL != PRESSIO_LOG_LEVEL_OFF
+  if (static_cast<int>(lvl) < PRESSIO_LOG_ACTIVE_MIN_LEVEL){ return false; }
+
+  const auto * logger = spdlog::default_logger_raw();
+  if (!logger){ return false; }
+
+  const auto spdlogLevel = impl::pressioLogLevelToSpdlogLevel(lvl);
+  if (!logger->should_log(spdlogLevel)){ return false; }
+  const auto & sinks = logger->sinks();
+  return std::any_of(sinks.begin(), sinks.end(),
+		     [=](const spdlog::sink_ptr & s){ return s->should_log(spdlogLevel); });
+#else
+  (void)lvl;
+  return false;
+#endif
+}
+
 // Set global format string.
 // example: spdlog::set_pattern("%Y-%m-%d %H:%M:%S.%e %l : %v");
 template <typename ...Args>
@@ -0,0 +1,248 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// utils_instrumentation.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef UTILS_UTILS_INSTRUMENTATION_HPP_
+#define UTILS_UTILS_INSTRUMENTATION_HPP_
+
+/*
+  Opt-in instrumentation of the memory traffic of pressio,
+  enabled by defining PRESSIO_ENABLE_INSTRUMENTATION project-wide.
+
+  It counts:
+  - calls to ops::clone and ops::deep_copy
+  - allocations of storage for dynamically-sized Eigen dense containers,
+    i.e. constructions, copy-constructions and resizes to a new size.
+    This uses EIGEN_DENSE_STORAGE_CTOR_PLUGIN, so pressio headers
+    must be included before Eigen, otherwise compilation fails.
+  - calls to the global operator new, if the application includes
+    utils_instrumentation_global_new.hpp in exactly one translation unit
+
+  Events are recorded against the innermost active label set via
+  PRESSIO_INSTRUMENTATION_SCOPE("label"), or "unlabeled" if there is none.
+  The counters are not thread safe: they are meant to be used from
+  the (serial) driver code, e.g. to check that steady-state stepping
+  does not allocate or copy.
+
+  When PRESSIO_ENABLE_INSTRUMENTATION is not defined, the macros
+  expand to nothing.
+*/
+
+#ifdef PRESSIO_ENABLE_INSTRUMENTATION
+
+#include <array>
+#include <cstring>
+#include <ostream>
+
+namespace pressio{ namespace utils{ namespace instrumentation{
+
+struct Counts
+{
+  std::size_t clones = 0;
+  std::size_t deepCopies = 0;
+  std::size_t containerAllocations = 0;
+  std::size_t heapAllocations = 0;
+
+  // copies that allocate memory
+  std::size_t allocationsAndClones() const{
+    return clones + containerAllocations + heapAllocations;
+  }
+
+  Counts & operator+=(const Counts & o){
+    clones += o.clones;
+    deepCopies += o.deepCopies;
+    containerAllocations += o.containerAllocations;
+    heapAllocations += o.heapAllocations;
+    return *this;
+  }
+};
+
+enum class Event{
+  Clone,
+  DeepCopy,
+  ContainerAllocation,
+  HeapAllocation
+};
+
+namespace impl{
+
+constexpr std::size_t max_num_labels = 64;
+constexpr const char * unlabeled = "unlabeled";
+
+struct Registry
+{
+  std::array<const char *, max_num_labels> labels_ = {unlabeled};
+  std::array<Counts, max_num_labels> counts_ = {};
+  std::size_t size_ = 1;
+
+  // labels are expected to be string literals, so we compare
+  // pointers first and only fall back to comparing strings.
+  // If the table is full, events go to "unlabeled".
+  std::size_t slot(const char * label){
+    for (std::size_t i=0; i<size_; ++i){
+      if (labels_[i] == label){ return i; }
+    }
+    for (std::size_t i=0; i<size_; ++i){
+      if (std::strcmp(labels_[i], label) == 0){ return i; }
+    }
+    if (size_ == max_num_labels){ return 0; }
+    labels_[size_] = label;
+    return size_++;
+  }
+};
+
+inline Registry & registry(){
+  static Registry r;
+  return r;
+}
+
+inline const char *& current_label(){
+  static thread_local const char * label = unlabeled;
+  return label;
+}
+
+inline void record(Event e)
+{
+  auto & c = registry().counts_[registry().slot(current_label())];
+  switch(e){
+  case Event::Clone:               ++c.clones; break;
+  case Event::DeepCopy:            ++c.deepCopies; break;
+  case Event::ContainerAllocation: ++c.containerAllocations; break;
+  case Event::HeapAllocation:      ++c.heapAllocations; break;
+  }
+}
+
+template<class IndexType>
+void record_eigen_dense_storage(IndexType size){
+  if (size > 0){ record(Event::ContainerAllocation); }
+}
+
+} // end namespace impl
+
+class ScopedLabel
+{
+public:
+  explicit ScopedLabel(const char * label)
+    : previous_(impl::current_label()){
+    // register the label so that it shows up in the report
+    // even if nothing is recorded against it
+    impl::registry().slot(label);
+    impl::current_label() = label;
+  }
+
+  ScopedLabel(const ScopedLabel &) = delete;
+  ScopedLabel & operator=(const ScopedLabel &) = delete;
+
+  ~ScopedLabel(){
+    impl::current_label() = previous_;
+  }
+
+private:
+  const char * previous_;
+};
+
+inline Counts counts(const char * label){
+  auto & r = impl::registry();
+  for (std::size_t i=0; i<r.size_; ++i){
+    if (std::strcmp(r.labels_[i], label) == 0){ return r.counts_[i]; }
+  }
+  return Counts{};
+}
+
+inline Counts total_counts(){
+  auto & r = impl::registry();
+  Counts result;
+  for (std::size_t i=0; i<r.size_; ++i){ result += r.counts_[i]; }
+  return result;
+}
+
+inline void reset(){
+  auto & r = impl::registry();
+  for (auto & it : r.counts_){ it = Counts{}; }
+}
+
+inline void report(std::ostream & os){
+  auto & r = impl::registry();
+  for (std::size_t i=0; i<r.size_; ++i){
+    const auto & c = r.counts_[i];
+    os << r.labels_[i]
+       << ": clones = " << c.clones
+       << ", deep copies = " << c.deepCopies
+       << ", container allocations = " << c.containerAllocations
+       << ", heap allocations = " << c.heapAllocations
+       << "\n";
+  }
+}
+
+}}} // end namespace pressio::utils::instrumentation
+
+#define PRESSIO_INSTRUMENTATION_RECORD(EVENT) \
+  ::pressio::utils::instrumentation::impl::record(::pressio::utils::instrumentation::Event::EVENT)
+
+#define PRESSIO_INSTRUMENTATION_SCOPE(LABEL) \
+  ::pressio::utils::instrumentation::ScopedLabel pressioInstrumentationScope_(LABEL)
+
+// the plugin is read when Eigen's DenseStorage is parsed: if Eigen was
+// included first, the allocations would silently not be counted and
+// DenseStorage would differ across translation units
+#if defined(EIGEN_WORLD_VERSION) && !defined(EIGEN_DENSE_STORAGE_CTOR_PLUGIN)
+#error "with PRESSIO_ENABLE_INSTRUMENTATION, pressio headers must be included before Eigen"
+#endif
+
+#ifndef EIGEN_DENSE_STORAGE_CTOR_PLUGIN
+#define EIGEN_DENSE_STORAGE_CTOR_PLUGIN \
+  ::pressio::utils::instrumentation::impl::record_eigen_dense_storage(size);
+#endif
+
+#else
+
+#define PRESSIO_INSTRUMENTATION_RECORD(EVENT)
+#define PRESSIO_INSTRUMENTATION_SCOPE(LABEL)
+
+#endif // PRESSIO_ENABLE_INSTRUMENTATION
+
+#endif  // UTILS_UTILS_INSTRUMENTATION_HPP_
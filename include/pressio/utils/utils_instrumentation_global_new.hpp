@@ -0,0 +1,89 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// utils_instrumentation_global_new.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef UTILS_UTILS_INSTRUMENTATION_GLOBAL_NEW_HPP_
+#define UTILS_UTILS_INSTRUMENTATION_GLOBAL_NEW_HPP_
+
+/*
+  Replaces the global operator new/delete so that heap allocations
+  are counted by the instrumentation in utils_instrumentation.hpp.
+  This must be included in exactly one translation unit of the
+  application, and only has an effect if PRESSIO_ENABLE_INSTRUMENTATION
+  is defined.
+*/
+
+#include "./utils_instrumentation.hpp"
+
+#ifdef PRESSIO_ENABLE_INSTRUMENTATION
+
+#include <cstdlib>
+#include <new>
+
+void * operator new(std::size_t count)
+{
+  PRESSIO_INSTRUMENTATION_RECORD(HeapAllocation);
+  if (count == 0){ ++count; }
+  if (void * ptr = std::malloc(count)){
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t /*count*/) noexcept
+{
+  std::free(ptr);
+}
+
+#endif // PRESSIO_ENABLE_INSTRUMENTATION
+
+#endif  // UTILS_UTILS_INSTRUMENTATION_GLOBAL_NEW_HPP_
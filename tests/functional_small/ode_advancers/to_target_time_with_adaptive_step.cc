@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_advancers.hpp"
+
+namespace{
+
+struct MyApp
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  // dy/dt = -lambda * y, with lambda varying by orders of magnitude
+  // across components so that the step size has to adapt
+  state_type createState() const{
+    state_type ret(3); ret.setZero();
+    return ret;
+  }
+
+  rhs_type createRhs() const{
+    rhs_type ret(3); ret.setZero();
+    return ret;
+  }
+
+  void rhs(const state_type & y, double /*t*/, rhs_type & f) const{
+    f(0) = -1.*y(0);
+    f(1) = -10.*y(1);
+    f(2) = -50.*y(2);
+  }
+};
+
+struct FinalTimeObserver
+{
+  double lastTime_ = -1.;
+  int lastStep_ = -1;
+  void operator()(pressio::ode::StepCount step, double time,
+		  const Eigen::VectorXd & /*unused*/){
+    lastTime_ = time;
+    lastStep_ = step.get();
+  }
+};
+
+Eigen::VectorXd exact_solution(double t){
+  Eigen::VectorXd y(3);
+  y << std::exp(-t), 2.*std::exp(-10.*t), 3.*std::exp(-50.*t);
+  return y;
+}
+}
+
+TEST(ode_advancers, adaptive_step_concept)
+{
+  namespace pode = pressio::ode;
+  MyApp app;
+  auto s1 = pode::create_explicit_stepper<pode::RungeKutta4>(app);
+  auto s2 = pode::create_explicit_stepper<
+    pode::EmbeddedRungeKutta<pode::tableaus::DormandPrince54>>(app);
+#ifdef PRESSIO_ENABLE_CXX20
+  static_assert(!pode::StronglySteppableWithErrorEstimate<decltype(s1)>, "");
+  static_assert( pode::StronglySteppableWithErrorEstimate<decltype(s2)>, "");
+#else
+  static_assert(!pode::StronglySteppableWithErrorEstimate<decltype(s1)>::value, "");
+  static_assert( pode::StronglySteppableWithErrorEstimate<decltype(s2)>::value, "");
+#endif
+  EXPECT_EQ(s2.errorEstimateOrder(), 4);
+}
+
+TEST(ode_advancers, adaptive_step_dormand_prince)
+{
+  namespace pode = pressio::ode;
+  MyApp app;
+  auto stepper = pode::create_explicit_stepper<
+    pode::EmbeddedRungeKutta<pode::tableaus::DormandPrince54>>(app);
+
+  Eigen::VectorXd y(3); y << 1., 2., 3.;
+  pode::PIStepSizeController<double> controller(1e-9, 1e-9);
+  FinalTimeObserver observer;
+  // start with a step size that is too large so that it must be rejected
+  pode::advance_to_target_point_with_adaptive_step(stepper, y, 0., 2., 0.5,
+						   controller, observer);
+
+  EXPECT_DOUBLE_EQ(observer.lastTime_, 2.);
+  EXPECT_EQ(observer.lastStep_, (int) controller.numAcceptedSteps());
+  EXPECT_GT(controller.numRejectedSteps(), 0u);
+  EXPECT_EQ(controller.history().size(),
+	    controller.numAcceptedSteps() + controller.numRejectedSteps());
+  EXPECT_FALSE(controller.history().front().accepted);
+
+  // the step size grows once the fast components have decayed
+  const auto & h = controller.history();
+  EXPECT_GT(h.back().stepSize, 10.*h[h.size()/4].stepSize);
+
+  const Eigen::VectorXd yEx = exact_solution(2.);
+  EXPECT_LT((y - yEx).cwiseAbs().maxCoeff(), 1e-7);
+}
+
+TEST(ode_advancers, adaptive_step_tolerance_drives_steps)
+{
+  namespace pode = pressio::ode;
+  MyApp app;
+  auto stepper = pode::create_explicit_stepper<
+    pode::EmbeddedRungeKutta<pode::tableaus::BogackiShampine32>>(app);
+
+  pode::PIStepSizeController<double> loose(1e-4, 1e-4);
+  Eigen::VectorXd y1(3); y1 << 1., 2., 3.;
+  pode::advance_to_target_point_with_adaptive_step(stepper, y1, 0., 1., 1e-3, loose);
+
+  pode::PIStepSizeController<double> tight(1e-8, 1e-8);
+  Eigen::VectorXd y2(3); y2 << 1., 2., 3.;
+  pode::advance_to_target_point_with_adaptive_step(stepper, y2, 0., 1., 1e-3, tight);
+
+  const Eigen::VectorXd yEx = exact_solution(1.);
+  const double e1 = (y1 - yEx).cwiseAbs().maxCoeff();
+  const double e2 = (y2 - yEx).cwiseAbs().maxCoeff();
+  EXPECT_LT(e1, 1e-3);
+  EXPECT_LT(e2, 1e-6);
+  EXPECT_LT(e2, e1);
+  EXPECT_GT(tight.numAcceptedSteps(), 5*loose.numAcceptedSteps());
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "pressio/solvers.hpp"
+#include "pressio/ode_steppers_implicit.hpp"
+#include "pressio/ode_advancers.hpp"
+
+namespace{
+
+struct MyApp
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+  using jacobian_type = Eigen::SparseMatrix<double>;
+
+  // dy/dt = -lambda * y, with a fast and a slow component
+  state_type createState() const{
+    state_type ret(2); ret.setZero();
+    return ret;
+  }
+
+  rhs_type createRhs() const{
+    rhs_type ret(2); ret.setZero();
+    return ret;
+  }
+
+  jacobian_type createJacobian() const{
+    jacobian_type J(2,2);
+    J.insert(0,0) = -1.;
+    J.insert(1,1) = -20.;
+    return J;
+  }
+
+  void rhsAndJacobian(const state_type & y, double /*t*/, rhs_type & f,
+		      std::optional<jacobian_type*> J) const
+  {
+    f(0) = -1.*y(0);
+    f(1) = -20.*y(1);
+    if (J){
+      (*J.value()).coeffRef(0,0) = -1.;
+      (*J.value()).coeffRef(1,1) = -20.;
+    }
+  }
+};
+
+Eigen::VectorXd exact_solution(double t){
+  Eigen::VectorXd y(2);
+  y << std::exp(-t), 2.*std::exp(-20.*t);
+  return y;
+}
+
+// fails the nonlinear solve of the given attempts to mimic
+// a solver that does not converge for a too large step
+template<class SolverType>
+struct FailingSolver
+{
+  SolverType & solver_;
+  std::vector<int> attemptsToFail_;
+  int count_ = 0;
+
+  template<class SystemType, class StateType>
+  void solve(SystemType & system, StateType & state){
+    const bool fail = std::find(attemptsToFail_.begin(), attemptsToFail_.end(),
+				count_++) != attemptsToFail_.end();
+    if (fail){
+      state.setConstant(1e10);
+      throw ::pressio::eh::NonlinearSolveFailure();
+    }
+    solver_.solve(system, state);
+  }
+};
+}
+
+TEST(ode_advancers, adaptive_step_implicit_concept)
+{
+  namespace pode = pressio::ode;
+  using namespace pressio;
+  MyApp app;
+  auto stepper = pode::create_bdf1_stepper(app);
+  using jac_t = typename MyApp::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::Bicgstab, jac_t>;
+  using nonlin_solver_t = decltype(create_newton_solver(stepper, std::declval<lin_solver_t&>()));
+  // only the stepper with bdf1 fixed at compile time has the estimate,
+  // the ones with the scheme chosen at runtime are rejected
+  using runtime_stepper_t = decltype(pode::create_implicit_stepper(pode::StepScheme::BDF2, app));
+#ifdef PRESSIO_ENABLE_CXX20
+  static_assert(pode::StronglySteppableWithAuxiliaryArgsAndErrorEstimate<
+		decltype(stepper), nonlin_solver_t&>, "");
+  static_assert(!pode::StronglySteppableWithAuxiliaryArgsAndErrorEstimate<
+		runtime_stepper_t, nonlin_solver_t&>, "");
+#else
+  static_assert(pode::StronglySteppableWithAuxiliaryArgsAndErrorEstimate<
+		void, decltype(stepper), nonlin_solver_t&>::value, "");
+  static_assert(!pode::StronglySteppableWithAuxiliaryArgsAndErrorEstimate<
+		void, runtime_stepper_t, nonlin_solver_t&>::value, "");
+#endif
+  EXPECT_EQ(stepper.errorEstimateOrder(), 1);
+
+  // the estimate has to be enabled
+  EXPECT_THROW(stepper.localErrorEstimate(), std::runtime_error);
+}
+
+TEST(ode_advancers, adaptive_step_implicit_bdf1_tolerance_drives_steps)
+{
+  namespace pode = pressio::ode;
+  using namespace pressio;
+  using jac_t = typename MyApp::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::Bicgstab, jac_t>;
+
+  MyApp app;
+  const Eigen::VectorXd yEx = exact_solution(1.);
+  std::vector<double> errors;
+  std::vector<std::size_t> numSteps;
+  for (double tol : {1e-3, 1e-4, 1e-5}){
+    auto stepper = pode::create_bdf1_stepper(app);
+    lin_solver_t linSolver;
+    auto solver = create_newton_solver(stepper, linSolver);
+    solver.setStopTolerance(1e-13);
+
+    pode::PIStepSizeController<double> controller(tol, tol);
+    Eigen::VectorXd y(2); y << 1., 2.;
+    pode::advance_to_target_point_with_adaptive_step(stepper, y, 0., 1., 1e-2,
+						     controller, solver);
+    errors.push_back( (y - yEx).cwiseAbs().maxCoeff() );
+    numSteps.push_back(controller.numAcceptedSteps());
+
+    // the step size grows once the fast component has decayed
+    const auto & h = controller.history();
+    const auto largest = std::max_element(h.begin(), h.end(),
+      [](const auto & a, const auto & b){ return a.stepSize < b.stepSize; });
+    EXPECT_GT(largest->stepSize, 5.*h[h.size()/4].stepSize);
+  }
+
+  for (std::size_t i=1; i<errors.size(); ++i){
+    EXPECT_LT(errors[i], errors[i-1]);
+    EXPECT_GT(numSteps[i], numSteps[i-1]);
+  }
+  // the tolerance is on the local error, the global one accumulates
+  EXPECT_LT(errors.back(), 2e-3);
+}
+
+TEST(ode_advancers, adaptive_step_implicit_failed_solve_is_retried)
+{
+  namespace pode = pressio::ode;
+  using namespace pressio;
+  using jac_t = typename MyApp::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::Bicgstab, jac_t>;
+
+  MyApp app;
+  auto stepper = pode::create_bdf1_stepper(app);
+  lin_solver_t linSolver;
+  auto newton = create_newton_solver(stepper, linSolver);
+  newton.setStopTolerance(1e-13);
+
+  // fail the very first solve and one later solve
+  FailingSolver<decltype(newton)> solver{newton, {0, 10}};
+
+  pode::PIStepSizeController<double> controller(1e-4, 1e-4);
+  Eigen::VectorXd y(2); y << 1., 2.;
+  const double dt0 = 1e-2;
+  pode::advance_to_target_point_with_adaptive_step(stepper, y, 0., 1., dt0,
+						   controller, solver);
+
+  EXPECT_GE(controller.numRejectedSteps(), 2u);
+  const auto & h = controller.history();
+  EXPECT_FALSE(h.front().accepted);
+  EXPECT_LT(h[1].stepSize, dt0);
+  EXPECT_LT((y - exact_solution(1.)).cwiseAbs().maxCoeff(), 1e-2);
+}
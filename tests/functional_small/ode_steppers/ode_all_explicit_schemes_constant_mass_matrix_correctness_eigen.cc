@@ -0,0 +1,243 @@
+
+#include <gtest/gtest.h>
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_advancers.hpp"
+
+struct MyAppConstantMM
+{
+  using independent_variable_type = double;
+  using state_type           = Eigen::VectorXd;
+  using rhs_type = state_type;
+  using mass_matrix_type     = Eigen::MatrixXd;
+
+  mutable int count1 = 0;
+  mutable int massMatrixCount_ = 0;
+  std::map<int, Eigen::VectorXd> & rhs_;
+  const Eigen::MatrixXd & uniqueMM_;
+
+  MyAppConstantMM(std::map<int, Eigen::VectorXd> & rhs,
+		  const Eigen::MatrixXd & MM)
+    : rhs_(rhs), uniqueMM_(MM){}
+
+  state_type createState() const{
+    state_type ret(3); ret.setZero();
+    return ret;
+  }
+
+  rhs_type createRhs() const{
+    rhs_type ret(3); ret.setZero();
+    return ret;
+  };
+
+  mass_matrix_type createMassMatrix() const{
+    mass_matrix_type ret(3,3); ret.setZero();
+    return ret;
+  };
+
+  void rhs(const state_type & /*unused*/,
+	   independent_variable_type evaltime,
+	   rhs_type & rhs) const
+  {
+    for (int i=0; i<rhs.size(); ++i){
+      rhs(i) = evaltime;
+    }
+    rhs_[++count1] = rhs;
+  };
+
+  void massMatrix(mass_matrix_type & M) const
+  {
+    ++massMatrixCount_;
+    M = uniqueMM_;
+  };
+};
+
+struct MyAppNoMM
+{
+  using independent_variable_type = double;
+  using state_type           = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  mutable int count1 = 0;
+  const std::map<int, Eigen::VectorXd> & rhs_;
+  const Eigen::MatrixXd & uniqueMM_;
+
+  MyAppNoMM(const std::map<int, Eigen::VectorXd> & rhs,
+	    const Eigen::MatrixXd & MM)
+    : rhs_(rhs), uniqueMM_(MM){}
+
+  state_type createState() const{
+    state_type ret(3); ret.setZero();
+    return ret;
+  }
+
+  rhs_type createRhs() const{
+    rhs_type ret(3); ret.setZero();
+    return ret;
+  };
+
+  void rhs(const state_type & /*unused*/,
+	   independent_variable_type evaltime,
+	   rhs_type & rhs) const
+  {
+    rhs = rhs_.at(++count1);
+    for (int i=0; i<rhs.size(); ++i){
+      EXPECT_NEAR(rhs(i), evaltime, 1e-15);
+    }
+    rhs = uniqueMM_.inverse()*rhs;
+  };
+};
+
+// only knows how to solve a full system: M is passed at every stage
+struct LinearSolverFullSolve
+{
+  int solveCount_ = 0;
+
+  void solve(const Eigen::MatrixXd & A,
+	     Eigen::VectorXd & x,
+	     const Eigen::VectorXd & b)
+  {
+    ++solveCount_;
+    x = A.colPivHouseholderQr().solve(b);
+  }
+};
+
+// can factorize once and then solve for many right-hand sides
+struct LinearSolverReusable
+{
+  int factorizeCount_ = 0;
+  int solveCount_ = 0;
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr_;
+
+  void resetLinearSystem(const Eigen::MatrixXd & A){
+    ++factorizeCount_;
+    qr_.compute(A);
+  }
+
+  void solve(const Eigen::VectorXd & b, Eigen::VectorXd & x){
+    ++solveCount_;
+    x = qr_.solve(b);
+  }
+};
+
+static_assert(pressio::ode::RealValuedOdeSystemWithConstantMassMatrix<MyAppConstantMM>
+#if !defined PRESSIO_ENABLE_CXX20
+	      ::value
+#endif
+	      , "");
+
+#define ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(NAME, SOLVER)		\
+  using namespace pressio;						\
+  const auto nsteps = ::pressio::ode::StepCount(4);			\
+  const double dt = 2.;							\
+  std::map<int, Eigen::VectorXd> rhs;					\
+  srand(342556331);							\
+  Eigen::MatrixXd M = Eigen::MatrixXd::Random(3, 3);			\
+  M += 3.*Eigen::MatrixXd::Identity(3, 3);				\
+  /**/									\
+  /* solve using the constant mass matrix API */			\
+  Eigen::VectorXd y0(3);						\
+  MyAppConstantMM appObj(rhs, M);					\
+  SOLVER solver;							\
+  {									\
+    auto stepperObj = ode::create_##NAME##_stepper(appObj);		\
+    y0(0) = 1.; y0(1) = 2.; y0(2) = 3.;					\
+    ode::advance_n_steps(stepperObj, y0, 0.0, dt, nsteps, solver);	\
+  }									\
+  /* M must have been computed only once */				\
+  EXPECT_EQ(appObj.massMatrixCount_, 1);				\
+  EXPECT_EQ(solver.solveCount_, appObj.count1);				\
+  /**/									\
+  /* solve problem computing modified rhs using mass matrix inverse */	\
+  Eigen::VectorXd y1(3);						\
+  {									\
+    MyAppNoMM appObj2(rhs, M);						\
+    auto stepperObj = ode::create_##NAME##_stepper(appObj2);		\
+    y1(0) = 1.; y1(1) = 2.; y1(2) = 3.;					\
+    ode::advance_n_steps(stepperObj, y1, 0.0, dt, nsteps);		\
+  }									\
+  EXPECT_NEAR( y0(0), y1(0), 1e-12);					\
+  EXPECT_NEAR( y0(1), y1(1), 1e-12);					\
+  EXPECT_NEAR( y0(2), y1(2), 1e-12);					\
+
+
+TEST(ode_explicit_steppers, forward_euler_constant_mass_matrix_full_solve){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(forward_euler, LinearSolverFullSolve)
+}
+
+TEST(ode_explicit_steppers, ab2_constant_mass_matrix_full_solve){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(ab2, LinearSolverFullSolve)
+}
+
+TEST(ode_explicit_steppers, rk4_constant_mass_matrix_full_solve){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(rk4, LinearSolverFullSolve)
+}
+
+TEST(ode_explicit_steppers, ssprk3_constant_mass_matrix_full_solve){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(ssprk3, LinearSolverFullSolve)
+}
+
+TEST(ode_explicit_steppers, forward_euler_constant_mass_matrix_factorize_once){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(forward_euler, LinearSolverReusable)
+  EXPECT_EQ(solver.factorizeCount_, 1);
+}
+
+TEST(ode_explicit_steppers, ab2_constant_mass_matrix_factorize_once){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(ab2, LinearSolverReusable)
+  EXPECT_EQ(solver.factorizeCount_, 1);
+}
+
+TEST(ode_explicit_steppers, rk4_constant_mass_matrix_factorize_once){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(rk4, LinearSolverReusable)
+  EXPECT_EQ(solver.factorizeCount_, 1);
+}
+
+TEST(ode_explicit_steppers, ssprk3_constant_mass_matrix_factorize_once){
+  ODE_CONSTANT_MASS_MATRIX_CHECK_TEST(ssprk3, LinearSolverReusable)
+  EXPECT_EQ(solver.factorizeCount_, 1);
+}
+
+namespace{
+// the solver is local, so two calls typically create it at the same address
+template<class StepperType>
+Eigen::VectorXd advanceWithLocalSolver(StepperType & stepperObj, int & factorizeCount)
+{
+  using namespace pressio;
+  Eigen::VectorXd y(3);
+  y << 1., 2., 3.;
+  LinearSolverReusable solver;
+  ode::advance_n_steps(stepperObj, y, 0.0, 0.5, ode::StepCount(3), solver);
+  factorizeCount = solver.factorizeCount_;
+  return y;
+}
+}
+
+TEST(ode_explicit_steppers, constant_mass_matrix_two_solvers_in_sequence)
+{
+  using namespace pressio;
+  std::map<int, Eigen::VectorXd> rhs;
+  srand(342556331);
+  Eigen::MatrixXd M = Eigen::MatrixXd::Random(3, 3);
+  M += 3.*Eigen::MatrixXd::Identity(3, 3);
+  MyAppConstantMM appObj(rhs, M);
+
+  int factorizeCount1 = 0;
+  int factorizeCount2 = 0;
+  auto rk4Stepper = ode::create_rk4_stepper(appObj);
+  const auto y1 = advanceWithLocalSolver(rk4Stepper, factorizeCount1);
+  const auto y2 = advanceWithLocalSolver(rk4Stepper, factorizeCount2);
+  EXPECT_EQ(factorizeCount1, 1);
+  EXPECT_EQ(factorizeCount2, 1);
+  EXPECT_TRUE(y1.isApprox(y2));
+
+  // same stepper, two distinct solvers one after the other
+  auto stepperObj = ode::create_forward_euler_stepper(appObj);
+  LinearSolverReusable solverA;
+  LinearSolverReusable solverB;
+  Eigen::VectorXd yA(3); yA << 1., 2., 3.;
+  Eigen::VectorXd yB = yA;
+  ode::advance_n_steps(stepperObj, yA, 0.0, 0.5, ode::StepCount(3), solverA);
+  ode::advance_n_steps(stepperObj, yB, 0.0, 0.5, ode::StepCount(3), solverB);
+  EXPECT_EQ(solverA.factorizeCount_, 1);
+  EXPECT_EQ(solverB.factorizeCount_, 1);
+  EXPECT_TRUE(yA.isApprox(yB));
+}
@@ -198,7 +198,7 @@ struct FakeNonLinearSolver2{
   }
 };
 
-#define ODE_MASS_MATRIX_CHECK_TEST(NAME)				\
+#define ODE_MASS_MATRIX_CHECK_TEST(NAME, NUM_SOLVES)			\
   std::cout << "\n";							\
   pressio::log::initialize(pressio::logto::terminal);			\
   pressio::log::setVerbosity({pressio::log::level::info});		\
@@ -217,7 +217,7 @@ struct FakeNonLinearSolver2{
   /* to be safe, need to store many random instances */			\
   /* so that we don't get errors when running things */			\
   /* becuase we try to access instances that are not there */		\
-  for (int i=0; i< 20; ++i){						\
+  for (int i=0; i< 60; ++i){						\
     rhs[i] = Eigen::VectorXd::Random(N);				\
     rhsJacobians[i] = Eigen::MatrixXd::Random(N, N);			\
   }									\
@@ -236,7 +236,7 @@ struct FakeNonLinearSolver2{
 				odeSchemeResidualsToCompare,		\
 				odeSchemeJacobiansToCompare);		\
     ode::advance_n_steps(stepperObj, y0, 0.0, dt, nsteps, solver);	\
-    EXPECT_TRUE(solver.count()== nsteps.get()*numFakeSolverIterations); \
+    EXPECT_TRUE(solver.count()== (NUM_SOLVES)*numFakeSolverIterations); \
   }									\
   std::cout << "y0 : \n" << y0 << " \n";				\
   /**/									\
@@ -252,7 +252,7 @@ struct FakeNonLinearSolver2{
 				odeSchemeResidualsToCompare,		\
 				odeSchemeJacobiansToCompare);		\
     ode::advance_n_steps(stepperObj, y1, 0.0, dt, nsteps, solver);	\
-    EXPECT_TRUE(solver.count() == nsteps.get()*numFakeSolverIterations); \
+    EXPECT_TRUE(solver.count() == (NUM_SOLVES)*numFakeSolverIterations); \
   }									\
   std::cout << "y1 : \n" << y1 << " \n";				\
   /**/									\
@@ -290,12 +290,24 @@ TEST(ode_implicit_steppers, bdf1_with_fixed_mass_matrix_use_inverse)
     some schemes, not everything.
    */
 
-  ODE_MASS_MATRIX_CHECK_TEST(bdf1)
+  ODE_MASS_MATRIX_CHECK_TEST(bdf1, nsteps.get())
 }
 
 TEST(ode_implicit_steppers, bdf2_with_fixed_mass_matrix_use_inverse){
   // similar explanation as for BDF1
-  ODE_MASS_MATRIX_CHECK_TEST(bdf2)
+  ODE_MASS_MATRIX_CHECK_TEST(bdf2, nsteps.get())
+}
+
+TEST(ode_implicit_steppers, bdf3_with_fixed_mass_matrix_use_inverse){
+  // similar explanation as for BDF1
+  // the first two steps take 1+2 implicit euler sub-steps each
+  ODE_MASS_MATRIX_CHECK_TEST(bdf3, 3*2 + 2)
+}
+
+TEST(ode_implicit_steppers, bdf4_with_fixed_mass_matrix_use_inverse){
+  // similar explanation as for BDF1
+  // the first three steps take 1+2+3 implicit euler sub-steps each
+  ODE_MASS_MATRIX_CHECK_TEST(bdf4, 6*3 + 1)
 }
 
 // TEST(ode_implicit_steppers, cn_with_fixed_mass_matrix_use_inverse){
@@ -227,7 +227,7 @@ struct FakeNonLinearSolver2{
   }
 };
 
-#define ODE_MASS_MATRIX_CHECK_TEST(NAME)			\
+#define ODE_MASS_MATRIX_CHECK_TEST(NAME, NUM_SOLVES)		\
   std::cout << "\n";							\
   pressio::log::initialize(pressio::logto::terminal);			\
   pressio::log::setVerbosity({pressio::log::level::info});		\
@@ -244,7 +244,7 @@ struct FakeNonLinearSolver2{
   /* to be safe, need to store many random instances */			\
   /* so that we don't get errors when running things */			\
   /* becuase we try to access instances that are not there */		\
-  for (int i=0; i< 20; ++i){						\
+  for (int i=0; i< 60; ++i){						\
     rhs[i] = Eigen::VectorXd::Random(N);				\
     massMatrices[i] = Eigen::MatrixXd::Random(N, N);			\
     rhsJacobians[i] = Eigen::MatrixXd::Random(N, N);			\
@@ -262,7 +262,7 @@ struct FakeNonLinearSolver2{
 				odeSchemeResidualsToCompare,		\
 				odeSchemeJacobiansToCompare);		\
     ode::advance_n_steps(stepperObj, y0, 0.0, dt, nsteps, solver);	\
-    EXPECT_TRUE(solver.count()== nsteps.get()*numFakeSolverIterations); \
+    EXPECT_TRUE(solver.count()== (NUM_SOLVES)*numFakeSolverIterations); \
   }									\
   std::cout << "y0 : \n" << y0 << " \n";				\
   /**/									\
@@ -276,7 +276,7 @@ struct FakeNonLinearSolver2{
 				odeSchemeResidualsToCompare,		\
 				odeSchemeJacobiansToCompare);		\
     ode::advance_n_steps(stepperObj, y1, 0.0, dt, nsteps, solver);	\
-    EXPECT_TRUE(solver.count() == nsteps.get()*numFakeSolverIterations); \
+    EXPECT_TRUE(solver.count() == (NUM_SOLVES)*numFakeSolverIterations); \
   }									\
   std::cout << "y1 : \n" << y1 << " \n";				\
   /**/									\
@@ -314,10 +314,22 @@ TEST(ode_implicit_steppers, bdf1_with_varying_mass_matrix_use_inverse)
     some schemes, not everything.
    */
 
-  ODE_MASS_MATRIX_CHECK_TEST(bdf1)
+  ODE_MASS_MATRIX_CHECK_TEST(bdf1, nsteps.get())
 }
 
 TEST(ode_implicit_steppers, bdf2_with_varying_mass_matrix_use_inverse){
   // similar explanation as for BDF1
-  ODE_MASS_MATRIX_CHECK_TEST(bdf2)
+  ODE_MASS_MATRIX_CHECK_TEST(bdf2, nsteps.get())
+}
+
+TEST(ode_implicit_steppers, bdf3_with_varying_mass_matrix_use_inverse){
+  // similar explanation as for BDF1
+  // the first two steps take 1+2 implicit euler sub-steps each
+  ODE_MASS_MATRIX_CHECK_TEST(bdf3, 3*2 + 2)
+}
+
+TEST(ode_implicit_steppers, bdf4_with_varying_mass_matrix_use_inverse){
+  // similar explanation as for BDF1
+  // the first three steps take 1+2+3 implicit euler sub-steps each
+  ODE_MASS_MATRIX_CHECK_TEST(bdf4, 6*3 + 1)
 }
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "pressio/solvers.hpp"
+#include "pressio/ode_steppers_implicit.hpp"
+#include "pressio/ode_advancers.hpp"
+#include "testing_apps.hpp"
+
+namespace{
+
+/*
+  dy/dt = -10*y has the exact solution y(t) = y(0)*exp(-10*t).
+  For a bdf scheme of order k, the error at the final time must
+  decrease as dt^k, which only holds if the startup steps
+  are accurate enough, so we check the observed order of accuracy.
+*/
+constexpr double finalTime = 0.5;
+
+template<class StepperType>
+Eigen::VectorXd runWithNewton(StepperType & stepperObj,
+			      const Eigen::VectorXd & y0,
+			      double dt, int numSteps)
+{
+  using namespace pressio;
+  using jac_t = typename ode::testing::AppEigenB::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::Bicgstab, jac_t>;
+  lin_solver_t linSolverObj;
+  auto NonLinSolver = create_newton_solver(stepperObj, linSolverObj);
+  NonLinSolver.setStopTolerance(1e-14);
+
+  Eigen::VectorXd y = y0;
+  ode::advance_n_steps(stepperObj, y, 0.0, dt, ode::StepCount(numSteps), NonLinSolver);
+  return y;
+}
+
+template<class StepperFactory>
+void checkConvergenceOrder(StepperFactory && createStepper, double expectedOrder)
+{
+  using namespace pressio;
+  ode::testing::AppEigenB problemObj;
+  const Eigen::VectorXd y0 = problemObj.getInitCond();
+  const Eigen::VectorXd yExact = y0*std::exp(-10.*finalTime);
+
+  std::vector<double> errors;
+  for (int numSteps : {20, 40, 80, 160}){
+    auto stepperObj = createStepper(problemObj);
+    const double dt = finalTime/numSteps;
+    const auto y = runWithNewton(stepperObj, y0, dt, numSteps);
+    errors.push_back( (y - yExact).norm() );
+  }
+
+  for (std::size_t i=1; i<errors.size(); ++i){
+    const double observedOrder = std::log2(errors[i-1]/errors[i]);
+    EXPECT_NEAR(observedOrder, expectedOrder, 0.25);
+  }
+}
+}
+
+TEST(ode, implicit_bdf3_policy_default_created_convergence_order)
+{
+  using namespace pressio;
+  checkConvergenceOrder([](ode::testing::AppEigenB & problemObj){
+    return ode::create_implicit_stepper(ode::StepScheme::BDF3, problemObj);
+  }, 3.);
+}
+
+TEST(ode, implicit_bdf4_policy_default_created_convergence_order)
+{
+  using namespace pressio;
+  checkConvergenceOrder([](ode::testing::AppEigenB & problemObj){
+    return ode::create_bdf4_stepper(problemObj);
+  }, 4.);
+}
+
+TEST(ode, implicit_bdf4_custom_policy_convergence_order)
+{
+  using namespace pressio;
+  using problem_t = ode::testing::AppEigenB;
+  using time_type = typename problem_t::independent_variable_type;
+  using state_t = typename problem_t::state_type;
+  using res_t = typename problem_t::rhs_type;
+  using jac_t = typename problem_t::jacobian_type;
+  using pol_t = ode::impl::ResidualJacobianStandardPolicy<problem_t&, time_type, state_t, res_t, jac_t>;
+
+  checkConvergenceOrder([](problem_t & problemObj){
+    return ode::create_bdf4_stepper(pol_t(problemObj));
+  }, 4.);
+}
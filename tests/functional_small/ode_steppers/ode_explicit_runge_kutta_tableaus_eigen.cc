@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_advancers.hpp"
+#include "testing_apps.hpp"
+
+namespace{
+
+template<class SchemeTag>
+double run_and_compute_error(double dt, int numSteps)
+{
+  using namespace pressio;
+  using app_t = ode::testing::AppEigenB;
+  using state_t = typename app_t::state_type;
+  app_t appObj;
+  state_t y(3); y << 1., 2., 3.;
+  auto stepperObj = ode::create_explicit_stepper<SchemeTag>(appObj);
+  ode::advance_n_steps(stepperObj, y, 0.0, dt, ode::StepCount(numSteps));
+
+  // the app is dy/dt = -10 y
+  state_t yEx(3); yEx << 1., 2., 3.;
+  yEx *= std::exp(-10.*dt*numSteps);
+  return (y - yEx).norm();
+}
+
+template<class SchemeTag>
+void check_convergence_order(int expectedOrder)
+{
+  const double e1 = run_and_compute_error<SchemeTag>(0.01, 50);
+  const double e2 = run_and_compute_error<SchemeTag>(0.005, 100);
+  const double observedOrder = std::log2(e1/e2);
+  std::cout << "observed order = " << observedOrder << std::endl;
+  EXPECT_NEAR(observedOrder, expectedOrder, 0.25);
+}
+}
+
+TEST(ode_explicit_steppers, tableau_classic_rk4_matches_rk4)
+{
+  using namespace pressio;
+  using app_t = ode::testing::AppEigenB;
+  using state_t = typename app_t::state_type;
+  app_t appObj;
+
+  state_t y1(3); y1 << 1., 2., 3.;
+  state_t y2 = y1;
+  auto stepper1 = ode::create_rk4_stepper(appObj);
+  auto stepper2 = ode::create_explicit_stepper<
+    ode::ExplicitRungeKutta<ode::tableaus::ClassicRK4>>(appObj);
+  static_assert(decltype(stepper2)::num_rhs == 4, "");
+  static_assert(decltype(stepper2)::num_aux_states == 1, "");
+
+  const double dt = 0.01;
+  ode::advance_n_steps(stepper1, y1, 0.0, dt, ode::StepCount(20));
+  ode::advance_n_steps(stepper2, y2, 0.0, dt, ode::StepCount(20));
+  for (int i=0; i<3; ++i){
+    EXPECT_NEAR(y1(i), y2(i), 1e-14);
+  }
+}
+
+TEST(ode_explicit_steppers, tableau_convergence_order)
+{
+  namespace pode = pressio::ode;
+  check_convergence_order<pode::ExplicitRungeKutta<pode::tableaus::Heun2>>(2);
+  check_convergence_order<pode::ExplicitRungeKutta<pode::tableaus::Kutta3>>(3);
+  check_convergence_order<pode::ExplicitRungeKutta<pode::tableaus::ClassicRK4>>(4);
+}
+
+TEST(ode_explicit_steppers, low_storage_convergence_order)
+{
+  namespace pode = pressio::ode;
+  check_convergence_order<pode::LowStorageRungeKutta<pode::tableaus::Williamson3LowStorage>>(3);
+  check_convergence_order<pode::LowStorageRungeKutta<pode::tableaus::CarpenterKennedy4LowStorage>>(4);
+}
+
+TEST(ode_explicit_steppers, low_storage_uses_two_registers)
+{
+  using namespace pressio;
+  using app_t = ode::testing::AppEigenB;
+  app_t appObj;
+  auto stepperObj = ode::create_explicit_stepper<
+    ode::LowStorageRungeKutta<ode::tableaus::CarpenterKennedy4LowStorage>>(appObj);
+  static_assert(decltype(stepperObj)::num_rhs == 2, "");
+  static_assert(decltype(stepperObj)::num_aux_states == 0, "");
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_advancers.hpp"
+#include "testing_apps.hpp"
+
+template<class SchemeTag>
+void run_and_compare_static_vs_dynamic(pressio::ode::StepScheme schemeName)
+{
+  using namespace pressio;
+  using app_t = ode::testing::AppEigenB;
+  using state_t = typename app_t::state_type;
+  app_t appObj;
+
+  state_t y1(3); y1 << 1., 2., 3.;
+  state_t y2 = y1;
+
+  auto stepper1 = ode::create_explicit_stepper(schemeName, appObj);
+  auto stepper2 = ode::create_explicit_stepper<SchemeTag>(appObj);
+  static_assert(decltype(stepper2)::num_rhs ==
+		ode::impl::explicit_scheme_num_rhs<SchemeTag>::value, "");
+  static_assert(decltype(stepper2)::num_aux_states ==
+		ode::impl::explicit_scheme_num_aux_states<SchemeTag>::value, "");
+
+  const double dt = 0.01;
+  ode::advance_n_steps(stepper1, y1, 0.0, dt, ode::StepCount(20));
+  ode::advance_n_steps(stepper2, y2, 0.0, dt, ode::StepCount(20));
+  for (int i=0; i<3; ++i){
+    EXPECT_DOUBLE_EQ(y1(i), y2(i));
+  }
+}
+
+TEST(ode_explicit_steppers, static_scheme_forward_euler)
+{
+  namespace pode = pressio::ode;
+  run_and_compare_static_vs_dynamic<pode::ForwardEuler>(pode::StepScheme::ForwardEuler);
+}
+
+TEST(ode_explicit_steppers, static_scheme_rk4)
+{
+  namespace pode = pressio::ode;
+  run_and_compare_static_vs_dynamic<pode::RungeKutta4>(pode::StepScheme::RungeKutta4);
+}
+
+TEST(ode_explicit_steppers, static_scheme_ab2)
+{
+  namespace pode = pressio::ode;
+  run_and_compare_static_vs_dynamic<pode::AdamsBashforth2>(pode::StepScheme::AdamsBashforth2);
+}
+
+TEST(ode_explicit_steppers, static_scheme_ssprk3)
+{
+  namespace pode = pressio::ode;
+  run_and_compare_static_vs_dynamic<pode::SSPRungeKutta3>(pode::StepScheme::SSPRungeKutta3);
+}
+
+TEST(ode_explicit_steppers, static_scheme_rk4_analytic)
+{
+  using namespace pressio;
+  using app_t = ode::testing::AppEigenB;
+  using state_t = typename app_t::state_type;
+  app_t appObj;
+  state_t y(3); y << 1., 2., 3.;
+  auto stepperObj = ode::create_explicit_stepper<ode::RungeKutta4>(app_t());
+  const double dt = 0.1;
+  ode::advance_n_steps(stepperObj, y, 0.0, dt, ode::StepCount(1));
+  appObj.analyticAdvanceRK4(dt);
+  EXPECT_NEAR(y(0), appObj.y(0), 1e-15);
+  EXPECT_NEAR(y(1), appObj.y(1), 1e-15);
+  EXPECT_NEAR(y(2), appObj.y(2), 1e-15);
+}
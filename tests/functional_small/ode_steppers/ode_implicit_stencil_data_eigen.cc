@@ -199,3 +199,52 @@ TEST(ode, stencil_states_data)
   EXPECT_TRUE(all_equal_to(v43r, 4.));
   EXPECT_TRUE(all_equal_to(v44r, 5.));
 }
+
+TEST(ode, stencil_states_rotate)
+{
+  using T = Eigen::VectorXd;
+  T a(5);
+
+  pressio::ode::ImplicitStencilStatesStaticContainer<T, 3> data(a);
+  data(pressio::ode::n()).setConstant(2.);
+  data(pressio::ode::nMinusOne()).setConstant(3.);
+  data(pressio::ode::nMinusTwo()).setConstant(4.);
+  const auto ptr_n   = data(pressio::ode::n()).data();
+  const auto ptr_nm1 = data(pressio::ode::nMinusOne()).data();
+  const auto ptr_nm2 = data(pressio::ode::nMinusTwo()).data();
+
+  // rotating moves y_n -> y_n-1, y_n-1 -> y_n-2 without copying,
+  // and the oldest storage becomes y_n
+  data.rotateForward();
+  EXPECT_TRUE(data(pressio::ode::n()).data() == ptr_nm2);
+  EXPECT_TRUE(data(pressio::ode::nMinusOne()).data() == ptr_n);
+  EXPECT_TRUE(data(pressio::ode::nMinusTwo()).data() == ptr_nm1);
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 2.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusTwo()), 3.));
+
+  data(pressio::ode::n()).setConstant(1.);
+  data.rotateForward();
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 1.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusTwo()), 2.));
+
+  data.rotateBackward();
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::n()), 1.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 2.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusTwo()), 3.));
+}
+
+TEST(ode, stencil_states_dynamic_rotate)
+{
+  using T = Eigen::VectorXd;
+  pressio::ode::ImplicitStencilStatesDynamicContainer<T> data{T(5), T(5)};
+  data(pressio::ode::n()).setConstant(2.);
+  data(pressio::ode::nMinusOne()).setConstant(3.);
+
+  data.rotateForward();
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::n()), 3.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 2.));
+
+  data.rotateBackward();
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::n()), 2.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 3.));
+}
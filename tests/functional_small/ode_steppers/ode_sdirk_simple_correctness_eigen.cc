@@ -0,0 +1,219 @@
+
+#include <gtest/gtest.h>
+#include "pressio/solvers.hpp"
+#include "pressio/ode_steppers_implicit.hpp"
+#include "pressio/ode_advancers.hpp"
+#include "testing_apps.hpp"
+
+namespace{
+
+constexpr double finalTime = 0.5;
+
+/*
+  dy/dt = -10*(y - cos(t)) - sin(t)
+  has the exact solution y(t) = cos(t) + (y(0) - 1)*exp(-10*t),
+  and, since the rhs depends on time, the observed order
+  is only the expected one if the stages are evaluated at t_n + c_i*dt
+*/
+struct ForcedDecayApp
+{
+  using independent_variable_type = double;
+  using state_type    = Eigen::VectorXd;
+  using rhs_type      = state_type;
+  using jacobian_type = Eigen::MatrixXd;
+
+  state_type getInitCond() const{
+    state_type y0(3);
+    y0 << 1., 2., 3.;
+    return y0;
+  }
+
+  state_type exactSolution(double t) const{
+    const state_type y0 = getInitCond();
+    return (y0.array() - 1.)*std::exp(-10.*t) + std::cos(t);
+  }
+
+  state_type createState() const{ return state_type::Zero(3); }
+  rhs_type createRhs() const{ return rhs_type::Zero(3); }
+  jacobian_type createJacobian() const{ return jacobian_type::Zero(3,3); }
+
+  void rhsAndJacobian(const state_type & y,
+		      independent_variable_type t,
+		      rhs_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		      std::optional<jacobian_type*> Jo) const
+#else
+                      jacobian_type* Jo) const
+#endif
+  {
+    R = -10.*(y.array() - std::cos(t)) - std::sin(t);
+    if (Jo){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & J = *(Jo.value());
+#else
+      auto & J = *Jo;
+#endif
+      J = -10.*jacobian_type::Identity(3,3);
+    }
+  }
+};
+
+// the same problem written as M dy/dt = M*f(y,t) with a constant M
+struct ForcedDecayAppWithMassMatrix
+{
+  using independent_variable_type = double;
+  using state_type       = Eigen::VectorXd;
+  using rhs_type         = state_type;
+  using jacobian_type    = Eigen::MatrixXd;
+  using mass_matrix_type = Eigen::MatrixXd;
+
+  ForcedDecayApp app_;
+
+  state_type getInitCond() const{ return app_.getInitCond(); }
+  state_type exactSolution(double t) const{ return app_.exactSolution(t); }
+
+  state_type createState() const{ return app_.createState(); }
+  rhs_type createRhs() const{ return app_.createRhs(); }
+  jacobian_type createJacobian() const{ return app_.createJacobian(); }
+  mass_matrix_type createMassMatrix() const{ return mass_matrix_type::Zero(3,3); }
+
+  void massMatrixAndRhsAndJacobian(const state_type & y,
+				   independent_variable_type t,
+				   mass_matrix_type & M,
+				   rhs_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+				   std::optional<jacobian_type*> Jo) const
+#else
+                                   jacobian_type* Jo) const
+#endif
+  {
+    M.setZero();
+    M.diagonal() << 2., 4., 0.5;
+    app_.rhsAndJacobian(y, t, R, Jo);
+    R = M*R;
+    if (Jo){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & J = *(Jo.value());
+#else
+      auto & J = *Jo;
+#endif
+      J = M*J;
+    }
+  }
+};
+
+template<class StepperType>
+Eigen::VectorXd run(StepperType & stepperObj,
+		    const Eigen::VectorXd & y0,
+		    double dt, int numSteps)
+{
+  using namespace pressio;
+  using jac_t = Eigen::MatrixXd;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::HouseholderQR, jac_t>;
+  lin_solver_t linSolverObj;
+  auto NonLinSolver = create_newton_solver(stepperObj, linSolverObj);
+  NonLinSolver.setStopTolerance(1e-14);
+
+  Eigen::VectorXd y = y0;
+  ode::advance_n_steps(stepperObj, y, 0.0, dt, ode::StepCount(numSteps), NonLinSolver);
+  return y;
+}
+
+template<class AppType, class StepperFactory>
+void checkConvergenceOrder(StepperFactory && createStepper, double expectedOrder)
+{
+  AppType problemObj;
+  const Eigen::VectorXd y0 = problemObj.getInitCond();
+  const Eigen::VectorXd yExact = problemObj.exactSolution(finalTime);
+
+  std::vector<double> errors;
+  for (int numSteps : {10, 20, 40, 80}){
+    auto stepperObj = createStepper(problemObj);
+    const double dt = finalTime/numSteps;
+    const auto y = run(stepperObj, y0, dt, numSteps);
+    errors.push_back( (y - yExact).norm() );
+  }
+
+  for (std::size_t i=1; i<errors.size(); ++i){
+    const double observedOrder = std::log2(errors[i-1]/errors[i]);
+    EXPECT_NEAR(observedOrder, expectedOrder, 0.25);
+  }
+}
+}
+
+TEST(ode, implicit_sdirk22_convergence_order)
+{
+  using namespace pressio;
+  checkConvergenceOrder<ForcedDecayApp>([](ForcedDecayApp & problemObj){
+    return ode::create_sdirk22_stepper(problemObj);
+  }, 2.);
+}
+
+TEST(ode, implicit_sdirk33_convergence_order)
+{
+  using namespace pressio;
+  checkConvergenceOrder<ForcedDecayApp>([](ForcedDecayApp & problemObj){
+    return ode::create_implicit_stepper(ode::StepScheme::SDIRK33, problemObj);
+  }, 3.);
+}
+
+TEST(ode, implicit_sdirk22_with_mass_matrix_convergence_order)
+{
+  using namespace pressio;
+  using app_t = ForcedDecayAppWithMassMatrix;
+  checkConvergenceOrder<app_t>([](app_t & problemObj){
+    return ode::create_sdirk22_stepper(problemObj);
+  }, 2.);
+}
+
+TEST(ode, implicit_sdirk33_with_mass_matrix_convergence_order)
+{
+  using namespace pressio;
+  using app_t = ForcedDecayAppWithMassMatrix;
+  checkConvergenceOrder<app_t>([](app_t & problemObj){
+    return ode::create_sdirk33_stepper(problemObj);
+  }, 3.);
+}
+
+TEST(ode, implicit_sdirk33_custom_policy_convergence_order)
+{
+  using namespace pressio;
+  using problem_t = ForcedDecayApp;
+  using time_type = typename problem_t::independent_variable_type;
+  using state_t = typename problem_t::state_type;
+  using res_t = typename problem_t::rhs_type;
+  using jac_t = typename problem_t::jacobian_type;
+  using pol_t = ode::impl::ResidualJacobianStandardPolicy<problem_t&, time_type, state_t, res_t, jac_t>;
+
+  checkConvergenceOrder<problem_t>([](problem_t & problemObj){
+    return ode::create_sdirk33_stepper(pol_t(problemObj));
+  }, 3.);
+}
+
+/*
+  dy/dt = -10*y: each sdirk step multiplies y by the stability
+  function R(z), z = -10*dt, which is known in closed form for
+  two stages: R(z) = (1 + (1 - 2*gamma)*z)/(1 - gamma*z)^2
+*/
+TEST(ode, implicit_sdirk22_one_step_matches_stability_function)
+{
+  using namespace pressio;
+  ode::testing::AppEigenB problemObj;
+  auto stepperObj = ode::create_sdirk22_stepper(problemObj);
+
+  using jac_t = typename ode::testing::AppEigenB::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::Bicgstab, jac_t>;
+  lin_solver_t linSolverObj;
+  auto NonLinSolver = create_newton_solver(stepperObj, linSolverObj);
+  NonLinSolver.setStopTolerance(1e-14);
+
+  const double dt = 0.1;
+  Eigen::VectorXd y = problemObj.getInitCond();
+  ode::advance_n_steps(stepperObj, y, 0.0, dt, ode::StepCount(1), NonLinSolver);
+
+  const double gamma = ode::tableaus::Alexander2Sdirk::gamma;
+  const double z = -10.*dt;
+  const double R = (1. + (1. - 2.*gamma)*z)/((1. - gamma*z)*(1. - gamma*z));
+  const Eigen::VectorXd gold = R*problemObj.getInitCond();
+  EXPECT_NEAR((y - gold).norm(), 0., 1e-12);
+}
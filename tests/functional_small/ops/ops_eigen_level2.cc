@@ -157,3 +157,42 @@ TEST(ops_eigen_level2, dense_matrix_T_diag_prod)
   const auto exp = pressio::diagonal(M0);
   OPS_EIGEN_DENSEMATRIX_T_VEC_PROD(exp);
 }
+
+TEST(ops_eigen_level2, dense_matrix_vector_prod_with_offset)
+{
+  // use more rows than one block of the implementation
+  const int m = 10000;
+  const int n = 7;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(m, n);
+  Eigen::VectorXd x = Eigen::VectorXd::Random(n);
+  Eigen::VectorXd b = Eigen::VectorXd::Random(m);
+
+  Eigen::VectorXd y(m);
+  y.setConstant(1e10);
+  pressio::ops::product_with_offset(::pressio::nontranspose(), 2., A, x, 3., b, y);
+  Eigen::VectorXd gold = 2.*A*x + 3.*b;
+  ASSERT_TRUE(y.isApprox(gold));
+
+  // beta = 0 must not read b
+  b.setConstant(std::numeric_limits<double>::quiet_NaN());
+  pressio::ops::product_with_offset(::pressio::nontranspose(), 2., A, x, 0., b, y);
+  gold = 2.*A*x;
+  ASSERT_TRUE(y.isApprox(gold));
+}
+
+TEST(ops_eigen_level2, dense_matrix_span_prod_with_offset)
+{
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(6, 3);
+  Eigen::VectorXd x0 = Eigen::VectorXd::Random(5);
+  Eigen::VectorXd b = Eigen::VectorXd::Random(6);
+  Eigen::VectorXd y0(8);
+  y0.setConstant(-5.);
+
+  const auto x = pressio::span(x0, 1, 3);
+  auto y = pressio::span(y0, 1, 6);
+  pressio::ops::product_with_offset(::pressio::nontranspose(), 1., A, x, 1., b, y);
+  const Eigen::VectorXd gold = A*x0.segment(1, 3) + b;
+  ASSERT_TRUE(y0.segment(1, 6).isApprox(gold));
+  ASSERT_DOUBLE_EQ(y0(0), -5.);
+  ASSERT_DOUBLE_EQ(y0(7), -5.);
+}
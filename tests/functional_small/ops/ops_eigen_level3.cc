@@ -171,3 +171,56 @@ TEST_F(ops_eigen, dense_matrix_T_self_prod)
 {
   test_impl(A);
 }
+
+TEST(ops_eigen_level3, dense_matrix_T_self_prod_is_symmetric)
+{
+  // tall matrix, as for the Gauss-Newton hessian H = J^T J
+  using mat_t = Eigen::MatrixXd;
+  const mat_t A = mat_t::Random(200, 17);
+  const mat_t gold = 2.5 * A.transpose() * A;
+
+  mat_t C(17, 17);
+  C.setConstant(std::nan("0"));
+  pressio::ops::product(pressio::transpose(), pressio::nontranspose(), 2.5, A, 0., C);
+  ASSERT_TRUE((C - gold).norm() <= 1e-12 * gold.norm());
+  for (int i=0; i<C.rows(); ++i){
+    for (int j=0; j<C.cols(); ++j){
+      ASSERT_EQ(C(i,j), C(j,i));
+    }
+  }
+
+  const auto C2 = pressio::ops::product<mat_t>(pressio::transpose(), pressio::nontranspose(), 2.5, A);
+  ASSERT_TRUE(C2.isApprox(C));
+}
+
+TEST(ops_eigen_level3, normal_equations_product)
+{
+  // tall enough that A is processed in several row blocks
+  using mat_t = Eigen::MatrixXd;
+  using vec_t = Eigen::VectorXd;
+  const mat_t A = mat_t::Random(5000, 20);
+  const vec_t b = vec_t::Random(5000);
+
+  mat_t H(20, 20);
+  vec_t g(20);
+  H.setConstant(std::nan("0"));
+  g.setConstant(std::nan("0"));
+  pressio::ops::normal_equations_product(1.5, A, b, 0., H, g);
+
+  const mat_t goldH = 1.5 * A.transpose() * A;
+  const vec_t goldg = 1.5 * A.transpose() * b;
+  ASSERT_TRUE((H - goldH).norm() <= 1e-12 * goldH.norm());
+  ASSERT_TRUE((g - goldg).norm() <= 1e-12 * goldg.norm());
+  for (int i=0; i<H.rows(); ++i){
+    for (int j=0; j<H.cols(); ++j){
+      ASSERT_EQ(H(i,j), H(j,i));
+    }
+  }
+
+  // beta != 0 accumulates on top of the (symmetric) H and g
+  pressio::ops::normal_equations_product(1., A, b, 2., H, g);
+  const mat_t goldH2 = 2. * goldH + A.transpose() * A;
+  const vec_t goldg2 = 2. * goldg + A.transpose() * b;
+  ASSERT_TRUE((H - goldH2).norm() <= 1e-12 * goldH2.norm());
+  ASSERT_TRUE((g - goldg2).norm() <= 1e-12 * goldg2.norm());
+}
@@ -438,3 +438,38 @@ TEST_F(ops_kokkos, dense_submat_diag_diag_T)
 {
   test_impl(*this, pressio::transpose(), A_subspan(), xt_diagonal(), yt_diagonal());
 }
+
+TEST(ops_kokkos_level2, dense_matrix_vector_prod_with_offset)
+{
+  const std::size_t m = 20;
+  const std::size_t n = 3;
+  Kokkos::View<double**> A("A", m, n);
+  Kokkos::View<double*> x("x", n);
+  Kokkos::View<double*> b("b", m);
+  Kokkos::View<double*> y("y", m);
+
+  auto A_h = Kokkos::create_mirror_view(A);
+  auto x_h = Kokkos::create_mirror_view(x);
+  auto b_h = Kokkos::create_mirror_view(b);
+  for (std::size_t i = 0; i < m; ++i){
+    for (std::size_t j = 0; j < n; ++j){
+      A_h(i, j) = (double)(i*n + j);
+    }
+    b_h(i) = (double) i + 0.5;
+  }
+  for (std::size_t j = 0; j < n; ++j){ x_h(j) = (double)(j + 1); }
+  Kokkos::deep_copy(A, A_h);
+  Kokkos::deep_copy(x, x_h);
+  Kokkos::deep_copy(b, b_h);
+
+  pressio::ops::product_with_offset(::pressio::nontranspose(), 2., A, x, 3., b, y);
+
+  auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  for (std::size_t i = 0; i < m; ++i){
+    double gold = 3.*b_h(i);
+    for (std::size_t j = 0; j < n; ++j){
+      gold += 2.*A_h(i, j)*x_h(j);
+    }
+    ASSERT_DOUBLE_EQ(y_h(i), gold);
+  }
+}
@@ -166,3 +166,59 @@ TEST(ops_kokkos_level3, dense_matrix_T_self_prod)
   OPS_KOKKOS_DENSE_MAT_T_SELF_PROD;
 }
 
+
+TEST(ops_kokkos_level3, normal_equations_product)
+{
+  using vec_t = Kokkos::View<double*>;
+  const int m = 50;
+  const int n = 4;
+  mat_t A("A", m, n);
+  vec_t b("b", m);
+  auto A_h = Kokkos::create_mirror_view(A);
+  auto b_h = Kokkos::create_mirror_view(b);
+  for (int i=0; i<m; ++i){
+    b_h(i) = 1. + 0.1*i;
+    for (int j=0; j<n; ++j){
+      A_h(i,j) = std::sin(double(i*n + j));
+    }
+  }
+  Kokkos::deep_copy(A, A_h);
+  Kokkos::deep_copy(b, b_h);
+
+  mat_t H("H", n, n);
+  vec_t g("g", n);
+  Kokkos::deep_copy(H, std::nan("0"));
+  Kokkos::deep_copy(g, std::nan("0"));
+  pressio::ops::normal_equations_product(1.5, A, b, 0., H, g);
+
+  auto goldH = [&](int r, int c){
+    double v = 0.;
+    for (int i=0; i<m; ++i){ v += A_h(i,r)*A_h(i,c); }
+    return v;
+  };
+  auto goldg = [&](int r){
+    double v = 0.;
+    for (int i=0; i<m; ++i){ v += A_h(i,r)*b_h(i); }
+    return v;
+  };
+
+  auto H_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), H);
+  auto g_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), g);
+  for (int r=0; r<n; ++r){
+    EXPECT_NEAR(g_h(r), 1.5*goldg(r), 1e-12);
+    for (int c=0; c<n; ++c){
+      EXPECT_NEAR(H_h(r,c), 1.5*goldH(r,c), 1e-12);
+    }
+  }
+
+  // beta != 0 accumulates on top of H and g
+  pressio::ops::normal_equations_product(1., A, b, 2., H, g);
+  Kokkos::deep_copy(H_h, H);
+  Kokkos::deep_copy(g_h, g);
+  for (int r=0; r<n; ++r){
+    EXPECT_NEAR(g_h(r), 4.*goldg(r), 1e-12);
+    for (int c=0; c<n; ++c){
+      EXPECT_NEAR(H_h(r,c), 4.*goldH(r,c), 1e-12);
+    }
+  }
+}
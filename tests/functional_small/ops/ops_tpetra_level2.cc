@@ -313,3 +313,57 @@ TEST_F(ops_tpetra, mv_T_vector_storein_eigen_diag)
   test_impl(*this, ::pressio::transpose{}, *myMv_, *x_tpetra, y_eigen_diag);
 }
 #endif
+
+//-------------------------------------------
+// Test product with offset
+//-------------------------------------------
+
+TEST_F(ops_tpetra, mv_prod_kokkos_vector_with_offset)
+{
+  Kokkos::View<double*> x_kokkos{"x", (size_t)numVecs_};
+  auto x_h = Kokkos::create_mirror_view(Kokkos::HostSpace(), x_kokkos);
+  for (int j = 0; j < numVecs_; ++j) {
+    x_h(j) = (double)(j + 1.);
+  }
+  Kokkos::deep_copy(x_kokkos, x_h);
+
+  vec_t b(contigMap_);
+  b.putScalar(0.5);
+  vec_t y(contigMap_);
+  y.putScalar(-100.);
+  pressio::ops::product_with_offset(::pressio::nontranspose{}, 2., *myMv_, x_kokkos, 3., b, y);
+
+  const auto A_h = myMv_->getLocalViewHost(Tpetra::Access::ReadOnly);
+  const auto y_h = y.getLocalViewHost(Tpetra::Access::ReadOnly);
+  for (int i = 0; i < localSize_; ++i){
+    double gold = 1.5;
+    for (int j = 0; j < numVecs_; ++j){
+      gold += 2.*A_h(i, j)*x_h(j);
+    }
+    EXPECT_DOUBLE_EQ(y_h(i, 0), gold);
+  }
+}
+
+TEST_F(ops_tpetra, mv_prod_eigen_vector_with_offset)
+{
+  Eigen::VectorXd x_eigen(numVecs_);
+  for (int j = 0; j < numVecs_; ++j) {
+    x_eigen(j) = (double)(j + 1.);
+  }
+
+  vec_t b(contigMap_);
+  b.putScalar(0.5);
+  vec_t y(contigMap_);
+  y.putScalar(-100.);
+  pressio::ops::product_with_offset(::pressio::nontranspose{}, 2., *myMv_, x_eigen, 3., b, y);
+
+  const auto A_h = myMv_->getLocalViewHost(Tpetra::Access::ReadOnly);
+  const auto y_h = y.getLocalViewHost(Tpetra::Access::ReadOnly);
+  for (int i = 0; i < localSize_; ++i){
+    double gold = 1.5;
+    for (int j = 0; j < numVecs_; ++j){
+      gold += 2.*A_h(i, j)*x_eigen(j);
+    }
+    EXPECT_DOUBLE_EQ(y_h(i, 0), gold);
+  }
+}
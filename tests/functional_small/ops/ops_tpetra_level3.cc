@@ -192,6 +192,82 @@ TEST_F(tpetraMultiVectorGlobSize15Fixture, mv_T_self_storein_eigen_C_test2)
     EXPECT_NEAR( C(3,2), 3.*15. + 2.*180., 1e-12);
     EXPECT_NEAR( C(3,3), 3.*16. + 2.*240., 1e-12);
 }
+
+TEST_F(tpetraMultiVectorGlobSize15Fixture, mv_T_mv_storein_eigen_C_repeated)
+{
+  // the replicated map and the wrapper of C are reused across calls,
+  // make sure results stay correct when C changes between calls
+  auto A = pressio::ops::clone(*myMv_);
+  std::array<double, 4> ac{1.,2.,3.,4.};
+  for (std::size_t i=0; i<A.getNumVectors(); ++i) {
+    A.getVectorNonConst(i)->putScalar(ac[i]);
+  }
+
+  mvec_t B(contigMap_, 3);
+  std::array<double, 3> bc{1.2, 2.2, 3.2};
+  for (int i=0; i<3; ++i) {
+    B.getVectorNonConst(i)->putScalar(bc[i]);
+  }
+
+  for (int k=1; k<=3; ++k){
+    Eigen::MatrixXd C(A.getNumVectors(), B.getNumVectors());
+    C.setConstant(std::nan("0"));
+    pressio::ops::product(pressio::transpose(), pressio::nontranspose(),
+			  double(k), A, B, 0.0, C);
+
+    Eigen::MatrixXd C1(A.getNumVectors(), 1);
+    C1.setConstant(std::nan("0"));
+    mvec_t B1(contigMap_, 1);
+    B1.putScalar(bc[0]);
+    pressio::ops::product(pressio::transpose(), pressio::nontranspose(),
+			  double(k), A, B1, 0.0, C1);
+
+    for (auto i=0; i<C.rows(); i++){
+      for (auto j=0; j<C.cols(); j++){
+	EXPECT_NEAR( C(i,j), ac[i]*A.getGlobalLength()*k*bc[j], 1e-12);
+      }
+      EXPECT_NEAR( C1(i,0), ac[i]*A.getGlobalLength()*k*bc[0], 1e-12);
+    }
+  }
+}
+
+TEST_F(tpetraMultiVectorGlobSize15Fixture, normal_equations_product_storein_eigen)
+{
+  // the local buffers are kept across calls: also change
+  // the number of columns to check that they get resized
+  for (int numCols : {4, 2, 4}){
+    mvec_t A(contigMap_, numCols);
+    std::array<double, 4> ac{1.,2.,3.,4.};
+    for (int i=0; i<numCols; ++i) {
+      A.getVectorNonConst(i)->putScalar(ac[i]);
+    }
+    vec_t b(contigMap_);
+    b.putScalar(0.5);
+
+    Eigen::MatrixXd H(numCols, numCols);
+    Eigen::VectorXd g(numCols);
+    H.setConstant(std::nan("0"));
+    g.setConstant(std::nan("0"));
+    pressio::ops::normal_equations_product(1.5, A, b, 0., H, g);
+
+    const double N = A.getGlobalLength();
+    for (int i=0; i<numCols; i++){
+      EXPECT_NEAR( g(i), 1.5*N*ac[i]*0.5, 1e-12);
+      for (int j=0; j<numCols; j++){
+	EXPECT_NEAR( H(i,j), 1.5*N*ac[i]*ac[j], 1e-12);
+      }
+    }
+
+    // beta != 0 accumulates on top of H and g
+    pressio::ops::normal_equations_product(1., A, b, 2., H, g);
+    for (int i=0; i<numCols; i++){
+      EXPECT_NEAR( g(i), 4.*N*ac[i]*0.5, 1e-12);
+      for (int j=0; j<numCols; j++){
+	EXPECT_NEAR( H(i,j), 4.*N*ac[i]*ac[j], 1e-12);
+      }
+    }
+  }
+}
 #endif
 
 
@@ -36,3 +36,37 @@ TEST_F(eigenDenseR9Fixture,
   	    << y << std::endl;
   gold_.checkYForRsolve(y);
 }
+
+TEST_F(eigenDenseR9Fixture, HouseholderEigenDenseOutOfPlaceImplicitQ)
+{
+  using namespace pressio;
+  using qr_algo = qr::Householder;
+  qr::QRSolver<matrix_type, qr_algo> qrObj;
+
+  // applying Q^T before Q is formed uses the reflectors directly
+  qrObj.computeThin( A_ );
+  vector_type rhs(pressio::qr::test::numVectors_);
+  qrObj.applyQTranspose(v_, rhs);
+
+  vector_type y(pressio::qr::test::numVectors_);
+  qrObj.solve(rhs, y);
+  gold_.checkYForRsolve(y);
+
+  // and it matches going through the explicit Q
+  const auto & Q = qrObj.cRefQFactor();
+  checkQFactor(Q);
+  const vector_type gold = Q.transpose() * v_;
+  EXPECT_TRUE(rhs.isApprox(gold, 1e-12));
+
+  // refactoring on the same object must not reuse the stale Q
+  const matrix_type A2 = 2. * A_;
+  qrObj.computeThin( A2 );
+  vector_type rhs2(pressio::qr::test::numVectors_);
+  qrObj.applyQTranspose(v_, rhs2);
+  const matrix_type Q2 = qrObj.cRefQFactor();
+  EXPECT_TRUE((Q2.transpose() * v_).isApprox(rhs2, 1e-12));
+  // A2 = 2A so the least-squares solution halves
+  vector_type y2(pressio::qr::test::numVectors_);
+  qrObj.solve(rhs2, y2);
+  EXPECT_TRUE((2. * y2).isApprox(y, 1e-10));
+}
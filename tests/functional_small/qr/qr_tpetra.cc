@@ -44,7 +44,70 @@ TEST_F(tpetraR9Fixture,
   checkQFactor(Q);
 }
 
+TEST_F(tpetraR9Fixture,
+       CGS2TpetraMultiVectorOutOfPlace)
+{
+  using namespace pressio;
+
+  // default: R_type == void, in_place = false
+  using qr_algo = qr::ClassicalGramSchmidt2;
+  qr::QRSolver<mymvec_t, qr_algo> qrObj;
+  qrObj.computeThin( *A_ );
+
+  const auto & Q = qrObj.cRefQFactor();
+  checkQFactor(Q);
+}
+
+TEST_F(tpetraR9Fixture,
+       BlockCGS2TpetraMultiVectorOutOfPlace)
+{
+  using namespace pressio;
+
+  // two blocks of two columns
+  using qr_algo = qr::BlockClassicalGramSchmidt2<2>;
+  qr::QRSolver<mymvec_t, qr_algo> qrObj;
+  qrObj.computeThin( *A_ );
+  // computing again must reuse the same Q
+  qrObj.computeThin( *A_ );
+
+  const auto & Q = qrObj.cRefQFactor();
+  checkQFactor(Q);
+}
+
 #ifdef PRESSIO_ENABLE_TPL_EIGEN
+TEST_F(tpetraR9Fixture,
+       HouseholderTpetraMVOutOfPlaceAndSolveEigenVecDynamic)
+{
+  using namespace pressio;
+
+  using qr_algo = qr::Householder;
+  qr::QRSolver<mymvec_t, qr_algo> qrObj;
+  qrObj.computeThin( *A_ );
+
+  Eigen::VectorXd rhs(pressio::qr::test::numVectors_);
+  qrObj.applyQTranspose(*v_, rhs);
+  Eigen::VectorXd y(pressio::qr::test::numVectors_);
+  qrObj.solve(rhs, y);
+  gold_.checkYForRsolve(y);
+}
+
+TEST_F(tpetraR9Fixture,
+       BlockCGS2TpetraMVOutOfPlaceAndSolveEigenVecDynamic)
+{
+  using namespace pressio;
+
+  // the last block has a single column
+  using qr_algo = qr::BlockClassicalGramSchmidt2<3>;
+  qr::QRSolver<mymvec_t, qr_algo> qrObj;
+  qrObj.computeThin( *A_ );
+
+  Eigen::VectorXd rhs(pressio::qr::test::numVectors_);
+  qrObj.applyQTranspose(*v_, rhs);
+  Eigen::VectorXd y(pressio::qr::test::numVectors_);
+  qrObj.solve(rhs, y);
+  gold_.checkYForRsolve(y);
+}
+
 TEST_F(tpetraR9Fixture,
        TSQRTpetraMVOutOfPlaceAndSolveEigenVecDynamic)
 {
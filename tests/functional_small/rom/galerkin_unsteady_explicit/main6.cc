@@ -0,0 +1,124 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+struct MyFomConstantMassMatrix
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+  int N_ = {};
+  mutable int applyMassMatrixCount_ = 0;
+
+  MyFomConstantMassMatrix(int N): N_(N){}
+
+  rhs_type createRhs() const{
+    rhs_type r(N_);
+    r.setConstant(0);
+    return r;
+  }
+
+  void rhs(const state_type & u,
+	   const time_type evalTime,
+	   rhs_type & f) const
+  {
+    for (decltype(f.rows()) i=0; i<f.rows(); ++i){
+      f(i) = u(i) + evalTime;
+    }
+  }
+
+  Eigen::MatrixXd createResultOfMassMatrixActionOn(const Eigen::MatrixXd & operand) const{
+    return Eigen::MatrixXd(N_, operand.cols());
+  }
+
+  // M = diag(1, 2, ..., N) does not depend on state or time
+  void applyMassMatrix(const Eigen::MatrixXd & operand,
+		       Eigen::MatrixXd & result) const
+  {
+    ++applyMassMatrixCount_;
+    for (int i=0; i<N_; ++i){
+      result.row(i) = (double)(i+1) * operand.row(i);
+    }
+  }
+};
+
+struct ReusableLinearSolver
+{
+  int factorizeCount_ = 0;
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr_;
+
+  void resetLinearSystem(const Eigen::MatrixXd & A){
+    ++factorizeCount_;
+    qr_.compute(A);
+  }
+
+  void solve(const Eigen::VectorXd & b, Eigen::VectorXd & x){
+    x = qr_.solve(b);
+  }
+};
+}
+
+TEST(rom_galerkin_explicit, test6_constant_mass_matrix)
+{
+  /* default galerkin explicit with euler forward and a FOM
+     with a constant mass matrix:
+
+       (phi^T M phi) delta = phi^T f
+
+     phi^T M phi must be computed and factorized only once
+  */
+
+  constexpr int N = 5;
+  using fom_t = MyFomConstantMassMatrix;
+  fom_t fomSystem(N);
+
+  using basis_t = Eigen::MatrixXd;
+  basis_t phi(N, 3);
+  for (int i=0; i<N; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = (double) i;
+    phi(i,2) = (double) (i*i);
+  }
+
+  using reduced_state_type = Eigen::VectorXd;
+  typename fom_t::state_type shift(N);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<reduced_state_type>(phi, shift, false);
+
+  auto romState = space.createReducedState();
+  romState[0]=1.;
+  romState[1]=2.;
+  romState[2]=3.;
+  Eigen::VectorXd gold = romState;
+
+  const auto odeScheme = pressio::ode::StepScheme::ForwardEuler;
+  namespace gal = pressio::rom::galerkin;
+  auto problem = gal::create_unsteady_explicit_problem(odeScheme, space, fomSystem);
+  ReusableLinearSolver linSolver;
+
+  using time_type = typename fom_t::time_type;
+  const time_type dt = 0.1;
+  const int nSteps = 4;
+  pressio::ode::advance_n_steps(problem, romState, time_type{0}, dt,
+				::pressio::ode::StepCount(nSteps), linSolver);
+  EXPECT_EQ(fomSystem.applyMassMatrixCount_, 1);
+  EXPECT_EQ(linSolver.factorizeCount_, 1);
+
+  // reference
+  Eigen::MatrixXd M = Eigen::MatrixXd::Zero(N, N);
+  for (int i=0; i<N; ++i){ M(i,i) = (double)(i+1); }
+  const Eigen::MatrixXd Mr = phi.transpose() * M * phi;
+  for (int step=0; step<nSteps; ++step){
+    Eigen::VectorXd f = phi * gold;
+    f.array() += step*dt;
+    const Eigen::VectorXd fr = phi.transpose() * f;
+    gold += dt * Mr.colPivHouseholderQr().solve(fr);
+  }
+
+  for (int i=0; i<3; ++i){
+    EXPECT_NEAR(romState[i], gold[i], 1e-10);
+  }
+}
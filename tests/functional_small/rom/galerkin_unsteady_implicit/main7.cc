@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+/* dy/dt = -y^3 + t, the jacobian action is -3 y^2 * B.
+   MyFom only provides separate rhs and applyJacobian,
+   MyFusedFom also provides rhsAndApplyJacobian */
+struct MyFom
+{
+  using time_type  = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type   = state_type;
+  int N_ = {};
+  mutable int rhsCount_ = 0;
+  mutable int applyJacobianCount_ = 0;
+
+  MyFom(int N): N_(N){}
+
+  rhs_type createRhs() const{ return rhs_type::Zero(N_); }
+
+  template<class OperandType>
+  OperandType createResultOfJacobianActionOn(const OperandType & B) const
+  {
+    return OperandType::Zero(B.rows(), B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const
+  {
+    ++rhsCount_;
+    f = -u.array().cube() + timeIn;
+  }
+
+  template<class OperandType>
+  void applyJacobian(const state_type & u,
+                     const OperandType & B,
+                     const time_type & /*unused*/,
+                     OperandType & A) const
+  {
+    ++applyJacobianCount_;
+    A = (-3. * u.array().square()).matrix().asDiagonal() * B;
+  }
+};
+
+struct MyFusedFom : MyFom
+{
+  mutable int fusedCount_ = 0;
+
+  using MyFom::MyFom;
+
+  template<class OperandType>
+  void rhsAndApplyJacobian(const state_type & u,
+			   const time_type & timeIn,
+			   rhs_type & f,
+			   const OperandType & B,
+			   OperandType & A) const
+  {
+    ++fusedCount_;
+    // the fom can share work between the two, here u^2
+    const Eigen::ArrayXd u2 = u.array().square();
+    f = -u2 * u.array() + timeIn;
+    A = (-3. * u2).matrix().asDiagonal() * B;
+  }
+};
+
+class HypRedOperator
+{
+  Eigen::MatrixXd matrix_;
+
+public:
+  HypRedOperator(const Eigen::MatrixXd & phi) : matrix_(phi){}
+
+  void operator()(const Eigen::VectorXd & operand, double /*unused*/,
+		  Eigen::VectorXd & result) const
+  {
+    result = matrix_.transpose() * operand;
+  }
+
+  void operator()(const Eigen::MatrixXd & operand, double /*unused*/,
+		  Eigen::MatrixXd & result) const
+  {
+    result = matrix_.transpose() * operand;
+  }
+};
+
+constexpr int N = 8;
+
+Eigen::MatrixXd createBasis()
+{
+  Eigen::MatrixXd phi(N, 3);
+  phi.setZero();
+  for (int i=0; i<N; ++i){
+    phi(i, i % 3) = 1.;
+  }
+  return phi;
+}
+
+template<class FomType, class ...Args>
+Eigen::VectorXd runGalerkin(const FomType & fomSystem, Args && ...args)
+{
+  using namespace pressio;
+
+  const auto phi = createBasis();
+  using reduced_state_type = Eigen::VectorXd;
+  typename FomType::state_type shift(N);
+  auto space = rom::create_trial_column_subspace<
+    reduced_state_type>(phi, shift, false);
+
+  auto romState = space.createReducedState();
+  romState << 0.5, 1., 1.5;
+
+  auto problem = rom::galerkin::create_unsteady_implicit_problem(ode::StepScheme::BDF2,
+								  space, fomSystem,
+								  std::forward<Args>(args)...);
+
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::HouseholderQR, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  ode::advance_n_steps(problem, romState, 0., 0.05, ode::StepCount(5), solver);
+  return romState;
+}
+}
+
+TEST(rom_galerkin_implicit, fused_rhs_and_jacobian_action_concept)
+{
+  using namespace pressio::rom;
+  using phi_t = Eigen::MatrixXd;
+#ifdef PRESSIO_ENABLE_CXX20
+  static_assert(!SemiDiscreteFomWithFusedRhsAndJacobianAction<MyFom, phi_t>, "");
+  static_assert(SemiDiscreteFomWithFusedRhsAndJacobianAction<MyFusedFom, phi_t>, "");
+#else
+  static_assert(!SemiDiscreteFomWithFusedRhsAndJacobianAction<MyFom, phi_t>::value, "");
+  static_assert(SemiDiscreteFomWithFusedRhsAndJacobianAction<MyFusedFom, phi_t>::value, "");
+#endif
+}
+
+TEST(rom_galerkin_implicit, fused_rhs_and_jacobian_action_default)
+{
+  MyFom fom(N);
+  MyFusedFom fusedFom(N);
+  const auto gold = runGalerkin(fom);
+  const auto romState = runGalerkin(fusedFom);
+  std::cout << romState << "\n" << gold << std::endl;
+  EXPECT_TRUE(romState.isApprox(gold, 1e-12));
+
+  EXPECT_TRUE(fom.applyJacobianCount_ > 0);
+  EXPECT_TRUE(fusedFom.fusedCount_ > 0);
+  EXPECT_EQ(fusedFom.applyJacobianCount_, 0);
+  // plain rhs is only used when the jacobian is not needed
+  EXPECT_EQ(fusedFom.rhsCount_ + fusedFom.fusedCount_, fom.rhsCount_);
+}
+
+TEST(rom_galerkin_implicit, fused_rhs_and_jacobian_action_hypred)
+{
+  MyFom fom(N);
+  MyFusedFom fusedFom(N);
+  HypRedOperator hrOp(createBasis());
+  const auto gold = runGalerkin(fom, hrOp);
+  const auto romState = runGalerkin(fusedFom, hrOp);
+  EXPECT_TRUE(romState.isApprox(gold, 1e-12));
+
+  EXPECT_TRUE(fusedFom.fusedCount_ > 0);
+  EXPECT_EQ(fusedFom.applyJacobianCount_, 0);
+  EXPECT_EQ(fom.applyJacobianCount_, fusedFom.fusedCount_);
+}
@@ -0,0 +1,169 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+#include "pressio/rom_lspg_unsteady.hpp"
+#include "pressio/utils/utils_instrumentation_global_new.hpp"
+
+/*
+  this is compiled with PRESSIO_ENABLE_INSTRUMENTATION:
+  after a few warm-up steps, stepping must not allocate or clone
+  anything, it should only work on the memory created up front
+*/
+
+namespace{
+
+namespace pinstr = pressio::utils::instrumentation;
+
+// dy/dt = -y^3 + t, everything is computed in place
+struct MyFom
+{
+  using time_type  = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type   = state_type;
+  int N_ = {};
+
+  MyFom(int N): N_(N){}
+
+  rhs_type createRhs() const{ return rhs_type::Zero(N_); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd::Zero(B.rows(), B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const{
+    f.array() = -u.array().cube() + timeIn;
+  }
+
+  void applyJacobian(const state_type & u,
+                     const Eigen::MatrixXd & B,
+                     const time_type & /*unused*/,
+                     Eigen::MatrixXd & A) const
+  {
+    A.noalias() = (-3. * u.array().square()).matrix().asDiagonal() * B;
+  }
+};
+
+struct ResetAfterWarmUp
+{
+  int numWarmUpSteps_;
+
+  void operator()(pressio::ode::StepCount stepIn, double /*unused*/,
+		  const Eigen::VectorXd & /*unused*/) const
+  {
+    if (stepIn.get() == numWarmUpSteps_){ pinstr::reset(); }
+  }
+};
+
+constexpr int N = 20;
+constexpr int numWarmUpSteps = 3;
+constexpr int numSteps = 10;
+
+auto createSpace()
+{
+  Eigen::MatrixXd phi(N, 3);
+  phi.setZero();
+  for (int i=0; i<N; ++i){
+    phi(i, i % 3) = 1. + i;
+  }
+  typename MyFom::state_type shift(N);
+  shift.setZero();
+  return pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, false);
+}
+
+void checkNoAllocationsAndClones(const char * romLabel, const char * stepperLabel)
+{
+  // take the snapshot first, printing and failing checks allocate
+  const auto rom = pinstr::counts(romLabel);
+  const auto stepper = pinstr::counts(stepperLabel);
+  const auto solver = pinstr::counts("solvers::nonlinear");
+  const auto total = pinstr::total_counts();
+
+  pinstr::report(std::cout);
+  EXPECT_EQ(rom.allocationsAndClones(), 0u);
+  EXPECT_EQ(stepper.allocationsAndClones(), 0u);
+  EXPECT_EQ(solver.allocationsAndClones(), 0u);
+  EXPECT_EQ(total.allocationsAndClones(), 0u);
+}
+}
+
+TEST(rom_instrumentation, positive_control)
+{
+  // the zero-count checks below are only meaningful if the
+  // counters do record the events they are supposed to record
+  pinstr::reset();
+  Eigen::VectorXd a(N);
+  a.setConstant(1.);
+  Eigen::VectorXd b, c;
+  std::vector<double> buffer;
+  {
+    PRESSIO_INSTRUMENTATION_SCOPE("positive_control");
+    b = pressio::ops::clone(a);
+    c = a + b;
+    buffer.resize(N);
+  }
+  const auto counts = pinstr::counts("positive_control");
+  EXPECT_GE(counts.clones, 1u);
+  EXPECT_GE(counts.containerAllocations, 2u);
+  EXPECT_GE(counts.heapAllocations, 1u);
+  EXPECT_DOUBLE_EQ(c.sum(), 2.*N);
+}
+
+TEST(rom_instrumentation, lspg_unsteady_steady_state_stepping)
+{
+  using namespace pressio;
+  MyFom fomSystem(N);
+  const auto space = createSpace();
+  auto romState = space.createReducedState();
+  romState << 0.1, 0.2, 0.3;
+
+  auto problem = rom::lspg::create_unsteady_problem(ode::StepScheme::BDF2, space, fomSystem);
+  auto & stepper = problem.lspgStepper();
+  // Eigen's HouseholderQR::solve copies the rhs internally,
+  // so use a factorization that solves in place
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::LLT, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = create_gauss_newton_solver(stepper, linSolver);
+  solver.setStopCriterion(nonlinearsolvers::Stop::AfterMaxIters);
+  solver.setMaxIterations(2);
+
+  ResetAfterWarmUp observer{numWarmUpSteps};
+  ode::advance_n_steps(problem, romState, 0., 0.05, ode::StepCount(numSteps), observer, solver);
+  checkNoAllocationsAndClones("rom::lspg", "ode::implicit_stepper");
+}
+
+TEST(rom_instrumentation, galerkin_implicit_steady_state_stepping)
+{
+  using namespace pressio;
+  MyFom fomSystem(N);
+  const auto space = createSpace();
+  auto romState = space.createReducedState();
+  romState << 0.1, 0.2, 0.3;
+
+  auto problem = rom::galerkin::create_unsteady_implicit_problem(ode::StepScheme::BDF2,
+								  space, fomSystem);
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = create_newton_solver(problem, linSolver);
+  solver.setStopCriterion(nonlinearsolvers::Stop::AfterMaxIters);
+  solver.setMaxIterations(2);
+
+  ResetAfterWarmUp observer{numWarmUpSteps};
+  ode::advance_n_steps(problem, romState, 0., 0.05, ode::StepCount(numSteps), observer, solver);
+  checkNoAllocationsAndClones("rom::galerkin", "ode::implicit_stepper");
+}
+
+TEST(rom_instrumentation, galerkin_explicit_steady_state_stepping)
+{
+  using namespace pressio;
+  MyFom fomSystem(N);
+  const auto space = createSpace();
+  auto romState = space.createReducedState();
+  romState << 0.1, 0.2, 0.3;
+
+  auto problem = rom::galerkin::create_unsteady_explicit_problem(ode::StepScheme::RungeKutta4,
+								  space, fomSystem);
+  ResetAfterWarmUp observer{numWarmUpSteps};
+  ode::advance_n_steps(problem, romState, 0., 0.01, ode::StepCount(numSteps), observer);
+  checkNoAllocationsAndClones("rom::galerkin", "ode::explicit_stepper");
+}
@@ -0,0 +1,121 @@
+
+#include <gtest/gtest.h>
+#include "pressio/type_traits.hpp"
+#include "pressio/rom_lspg_unsteady.hpp"
+#include "./fixtures/tpetra_only_fixtures.hpp"
+
+using fixture_t = tpetraMultiVectorGlobSize15Fixture;
+
+namespace{
+
+/*
+  the stencil mesh is the contiguous map of the fixture (5 rows per rank),
+  the sample mesh owns, on each rank, the odd global rows of the stencil
+  rows of that rank listed in reverse order, so that the sample-to-stencil
+  local indices are neither contiguous nor the identity
+*/
+Teuchos::RCP<const fixture_t::map_t> createSampleMap(const fixture_t & f)
+{
+  using GO = typename fixture_t::GO;
+  std::vector<GO> gids;
+  const auto & stencilMap = *f.contigMap_;
+  for (auto i = static_cast<GO>(stencilMap.getLocalNumElements())-1; i >= 0; --i){
+    const auto gid = stencilMap.getGlobalElement(i);
+    if (gid % 2 == 1){ gids.push_back(gid); }
+  }
+  const auto invalid = Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid();
+  return Teuchos::rcp(new typename fixture_t::map_t
+		      (invalid, Teuchos::ArrayView<const GO>(gids), 0, f.comm_));
+}
+
+// stencil(gid, j) = gid + 100*j
+void fillStencilOperand(typename fixture_t::mvec_t & stencil)
+{
+  const auto & map = *stencil.getMap();
+  auto v_h = stencil.getLocalViewHost(Tpetra::Access::OverwriteAllStruct());
+  for (std::size_t i=0; i<stencil.getLocalLength(); ++i){
+    const auto gid = map.getGlobalElement(i);
+    for (std::size_t j=0; j<stencil.getNumVectors(); ++j){
+      v_h(i,j) = static_cast<double>(gid) + 100.*j;
+    }
+  }
+}
+
+// sample(gid, j) = alpha*sample(gid, j) + beta*stencil(gid, j)
+// for a sample operand initialized to one and updated numUpdates times
+void checkSampleOperand(const typename fixture_t::mvec_t & sample,
+			double alpha, double beta, int numUpdates)
+{
+  const auto & map = *sample.getMap();
+  auto v_h = sample.getLocalViewHost(Tpetra::Access::ReadOnlyStruct());
+  for (std::size_t i=0; i<sample.getLocalLength(); ++i){
+    const auto gid = map.getGlobalElement(i);
+    for (std::size_t j=0; j<sample.getNumVectors(); ++j){
+      double gold = 1.;
+      for (int k=0; k<numUpdates; ++k){
+	gold = alpha*gold + beta*(static_cast<double>(gid) + 100.*j);
+      }
+      EXPECT_DOUBLE_EQ(v_h(i,j), gold);
+    }
+  }
+}
+}
+
+TEST_F(fixture_t, lspg_precomputed_hypred_updater_multivector)
+{
+  auto sampleMap = createSampleMap(*this);
+  EXPECT_EQ(sampleMap->getLocalNumElements(), rank_ == 1 ? 3u : 2u);
+
+  mvec_t stencil(contigMap_, numVecs_);
+  fillStencilOperand(stencil);
+  mvec_t sample(sampleMap, numVecs_);
+  sample.putScalar(1.);
+
+  const auto updater = pressio::rom::lspg::create_precomputed_hypred_updater_trilinos
+    (*sampleMap, *contigMap_);
+  // the same precomputed indices serve all the updates
+  updater.updateSampleMeshOperandWithStencilMeshOne(sample, 2., stencil, 3.);
+  checkSampleOperand(sample, 2., 3., 1);
+  updater.updateSampleMeshOperandWithStencilMeshOne(sample, 2., stencil, 3.);
+  checkSampleOperand(sample, 2., 3., 2);
+}
+
+TEST_F(fixture_t, lspg_precomputed_hypred_updater_vector)
+{
+  auto sampleMap = createSampleMap(*this);
+  vec_t stencil(contigMap_);
+  fillStencilOperand(stencil);
+  vec_t sample(sampleMap);
+  sample.putScalar(1.);
+
+  pressio::rom::lspg::PrecomputedHypRedUpdaterTrilinos<map_t> updater(*sampleMap, *contigMap_);
+  updater.updateSampleMeshOperandWithStencilMeshOne(sample, 0., stencil, 1.);
+  checkSampleOperand(sample, 0., 1., 1);
+}
+
+TEST_F(fixture_t, lspg_hypred_updater_matches_precomputed_one)
+{
+  auto sampleMap = createSampleMap(*this);
+  mvec_t stencil(contigMap_, numVecs_);
+  fillStencilOperand(stencil);
+  mvec_t sample(sampleMap, numVecs_);
+  sample.putScalar(1.);
+  mvec_t samplePre(sampleMap, numVecs_);
+  samplePre.putScalar(1.);
+
+  pressio::rom::lspg::HypRedUpdaterTrilinos updater;
+  updater.updateSampleMeshOperandWithStencilMeshOne(sample, -1., stencil, 0.5);
+  checkSampleOperand(sample, -1., 0.5, 1);
+
+  const auto updaterPre = pressio::rom::lspg::create_precomputed_hypred_updater_trilinos
+    (*sampleMap, *contigMap_);
+  updaterPre.updateSampleMeshOperandWithStencilMeshOne(samplePre, -1., stencil, 0.5);
+
+  auto a_h = sample.getLocalViewHost(Tpetra::Access::ReadOnlyStruct());
+  auto b_h = samplePre.getLocalViewHost(Tpetra::Access::ReadOnlyStruct());
+  for (std::size_t i=0; i<sample.getLocalLength(); ++i){
+    for (std::size_t j=0; j<sample.getNumVectors(); ++j){
+      EXPECT_DOUBLE_EQ(a_h(i,j), b_h(i,j));
+    }
+  }
+}
@@ -0,0 +1,192 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_lspg_unsteady.hpp"
+
+namespace{
+
+/* dy/dt = -y: since the FOM is a multiple of the identity, the span of
+   the basis is invariant and the LSPG solution is exact, i.e. the
+   generalized coordinates follow the same bdf recursion, or sdirk
+   stages, as the FOM */
+struct MyFom
+{
+  using time_type  = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type   = state_type;
+  int N_ = {};
+
+  MyFom(int N): N_(N){}
+
+  rhs_type createRhs() const{
+    auto R = rhs_type(N_);
+    R.setConstant(0.);
+    return R;
+  }
+
+  template<class OperandType>
+  OperandType createResultOfJacobianActionOn(const OperandType & B) const
+  {
+    OperandType A(N_, B.cols());
+    A.setConstant(0.);
+    return A;
+  }
+
+  void rhs(const state_type & u, time_type /*unused*/, rhs_type & f) const{
+    f = -u;
+  }
+
+  template<class OperandType>
+  void applyJacobian(const state_type & /*unused*/,
+                     const OperandType & B,
+                     time_type /*unused*/,
+                     OperandType & A) const
+  {
+    A = -B;
+  }
+};
+
+/* the generalized coordinates follow dq/dt = -q, which we integrate
+   with the ode stepper of the same scheme to get the reference */
+struct ReducedSystem
+{
+  using independent_variable_type = double;
+  using state_type    = Eigen::VectorXd;
+  using rhs_type      = state_type;
+  using jacobian_type = Eigen::MatrixXd;
+
+  state_type createState() const{ return state_type::Zero(3); }
+  rhs_type createRhs() const{ return rhs_type::Zero(3); }
+  jacobian_type createJacobian() const{ return jacobian_type::Zero(3, 3); }
+
+  void rhsAndJacobian(const state_type & q,
+		      independent_variable_type /*unused*/,
+		      rhs_type & f,
+#ifdef PRESSIO_ENABLE_CXX17
+		      std::optional<jacobian_type*> Jo) const
+#else
+		      jacobian_type* Jo) const
+#endif
+  {
+    f = -q;
+    if (Jo){
+#ifdef PRESSIO_ENABLE_CXX17
+      *(Jo.value()) = -jacobian_type::Identity(3, 3);
+#else
+      *Jo = -jacobian_type::Identity(3, 3);
+#endif
+    }
+  }
+};
+
+Eigen::VectorXd odeReference(pressio::ode::StepScheme scheme,
+			     const Eigen::VectorXd & q0,
+			     double dt, int numSteps)
+{
+  using namespace pressio;
+  ReducedSystem system;
+  auto stepper = ode::create_implicit_stepper(scheme, system);
+  using lin_solver_t = linearsolvers::Solver<
+    linearsolvers::direct::HouseholderQR, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = create_newton_solver(stepper, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  Eigen::VectorXd q = q0;
+  ode::advance_n_steps(stepper, q, 0., dt, ode::StepCount(numSteps), solver);
+  return q;
+}
+
+/* sample and stencil mesh coincide, so the hyper-reduced
+   problem must give the same result as the default one */
+struct IdentityHypRedUpdater
+{
+  void updateSampleMeshOperandWithStencilMeshOne(Eigen::VectorXd & a, double alpha,
+						 const Eigen::VectorXd & b, double beta) const
+  {
+    a = alpha*a + beta*b;
+  }
+
+  void updateSampleMeshOperandWithStencilMeshOne(Eigen::MatrixXd & a, double alpha,
+						 const Eigen::MatrixXd & b, double beta) const
+  {
+    a = alpha*a + beta*b;
+  }
+};
+
+template<class ...Args>
+void runLspgAndCompare(pressio::ode::StepScheme scheme, Args && ...args)
+{
+  using namespace pressio;
+
+  constexpr int N = 8;
+  MyFom fomSystem(N);
+
+  using phi_t = Eigen::Matrix<double, -1,-1>;
+  phi_t phi(N, 3);
+  phi.setZero();
+  for (int i=0; i<N; ++i){
+    phi(i, i % 3) = 1. + i;
+  }
+
+  using reduced_state_type = Eigen::VectorXd;
+  typename MyFom::state_type dummyFomState(N);
+  auto space = rom::create_trial_column_subspace<
+    reduced_state_type>(phi, dummyFomState, false);
+
+  auto romState = space.createReducedState();
+  romState << 1., 2., 3.;
+  const reduced_state_type romState0 = romState;
+
+  auto problem = rom::lspg::create_unsteady_problem(scheme, space, fomSystem,
+						     std::forward<Args>(args)...);
+  auto & stepper = problem.lspgStepper();
+
+  using hessian_t = Eigen::MatrixXd;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::HouseholderQR, hessian_t>;
+  lin_solver_t linSolver;
+  auto solver = create_gauss_newton_solver(stepper, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  const double dt = 0.1;
+  const int numSteps = 6;
+  ode::advance_n_steps(problem, romState, 0., dt, ode::StepCount(numSteps), solver);
+
+  const auto gold = odeReference(scheme, romState0, dt, numSteps);
+  for (int i=0; i<3; ++i){
+    EXPECT_NEAR(romState(i), gold(i), 1e-10);
+  }
+}
+}
+
+TEST(rom_lspg_unsteady, test10_bdf3)
+{
+  runLspgAndCompare(pressio::ode::StepScheme::BDF3);
+}
+
+TEST(rom_lspg_unsteady, test10_bdf4)
+{
+  runLspgAndCompare(pressio::ode::StepScheme::BDF4);
+}
+
+TEST(rom_lspg_unsteady, test10_bdf4_hypred)
+{
+  IdentityHypRedUpdater updater;
+  runLspgAndCompare(pressio::ode::StepScheme::BDF4, updater);
+}
+
+TEST(rom_lspg_unsteady, test10_sdirk22)
+{
+  runLspgAndCompare(pressio::ode::StepScheme::SDIRK22);
+}
+
+TEST(rom_lspg_unsteady, test10_sdirk33)
+{
+  runLspgAndCompare(pressio::ode::StepScheme::SDIRK33);
+}
+
+TEST(rom_lspg_unsteady, test10_sdirk33_hypred)
+{
+  IdentityHypRedUpdater updater;
+  runLspgAndCompare(pressio::ode::StepScheme::SDIRK33, updater);
+}
@@ -0,0 +1,146 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_lspg_unsteady.hpp"
+
+namespace{
+
+/* dy/dt = -y^3 + t, the jacobian action is -3 y^2 * B.
+   MyFom only provides separate rhs and applyJacobian,
+   MyFusedFom also provides rhsAndApplyJacobian */
+struct MyFom
+{
+  using time_type  = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type   = state_type;
+  int N_ = {};
+  mutable int rhsCount_ = 0;
+  mutable int applyJacobianCount_ = 0;
+
+  MyFom(int N): N_(N){}
+
+  rhs_type createRhs() const{ return rhs_type::Zero(N_); }
+
+  template<class OperandType>
+  OperandType createResultOfJacobianActionOn(const OperandType & B) const
+  {
+    return OperandType::Zero(B.rows(), B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const
+  {
+    ++rhsCount_;
+    f = -u.array().cube() + timeIn;
+  }
+
+  template<class OperandType>
+  void applyJacobian(const state_type & u,
+                     const OperandType & B,
+                     const time_type & /*unused*/,
+                     OperandType & A) const
+  {
+    ++applyJacobianCount_;
+    A = (-3. * u.array().square()).matrix().asDiagonal() * B;
+  }
+};
+
+struct MyFusedFom : MyFom
+{
+  mutable int fusedCount_ = 0;
+
+  using MyFom::MyFom;
+
+  template<class OperandType>
+  void rhsAndApplyJacobian(const state_type & u,
+			   const time_type & timeIn,
+			   rhs_type & f,
+			   const OperandType & B,
+			   OperandType & A) const
+  {
+    ++fusedCount_;
+    // the fom can share work between the two, here u^2
+    const Eigen::ArrayXd u2 = u.array().square();
+    f = -u2 * u.array() + timeIn;
+    A = (-3. * u2).matrix().asDiagonal() * B;
+  }
+};
+
+/* sample and stencil mesh coincide */
+struct IdentityHypRedUpdater
+{
+  void updateSampleMeshOperandWithStencilMeshOne(Eigen::VectorXd & a, double alpha,
+						 const Eigen::VectorXd & b, double beta) const
+  {
+    a = alpha*a + beta*b;
+  }
+
+  void updateSampleMeshOperandWithStencilMeshOne(Eigen::MatrixXd & a, double alpha,
+						 const Eigen::MatrixXd & b, double beta) const
+  {
+    a = alpha*a + beta*b;
+  }
+};
+
+constexpr int N = 8;
+
+template<class FomType, class ...Args>
+Eigen::VectorXd runLspg(const FomType & fomSystem, Args && ...args)
+{
+  using namespace pressio;
+
+  Eigen::MatrixXd phi(N, 3);
+  phi.setZero();
+  for (int i=0; i<N; ++i){
+    phi(i, i % 3) = 1. + i;
+  }
+
+  using reduced_state_type = Eigen::VectorXd;
+  typename FomType::state_type shift(N);
+  auto space = rom::create_trial_column_subspace<
+    reduced_state_type>(phi, shift, false);
+
+  auto romState = space.createReducedState();
+  romState << 0.1, 0.2, 0.3;
+
+  auto problem = rom::lspg::create_unsteady_problem(ode::StepScheme::BDF2, space, fomSystem,
+						     std::forward<Args>(args)...);
+  auto & stepper = problem.lspgStepper();
+
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::HouseholderQR, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = create_gauss_newton_solver(stepper, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  ode::advance_n_steps(problem, romState, 0., 0.05, ode::StepCount(5), solver);
+  return romState;
+}
+}
+
+TEST(rom_lspg_unsteady, test11_fused_rhs_and_jacobian_action_default)
+{
+  MyFom fom(N);
+  MyFusedFom fusedFom(N);
+  const auto gold = runLspg(fom);
+  const auto romState = runLspg(fusedFom);
+  std::cout << romState << "\n" << gold << std::endl;
+  EXPECT_TRUE(romState.isApprox(gold, 1e-12));
+
+  EXPECT_TRUE(fusedFom.fusedCount_ > 0);
+  EXPECT_EQ(fusedFom.applyJacobianCount_, 0);
+  EXPECT_EQ(fom.applyJacobianCount_, fusedFom.fusedCount_);
+  EXPECT_EQ(fusedFom.rhsCount_ + fusedFom.fusedCount_, fom.rhsCount_);
+}
+
+TEST(rom_lspg_unsteady, test11_fused_rhs_and_jacobian_action_hypred)
+{
+  MyFom fom(N);
+  MyFusedFom fusedFom(N);
+  IdentityHypRedUpdater updater;
+  const auto gold = runLspg(fom, updater);
+  const auto romState = runLspg(fusedFom, updater);
+  EXPECT_TRUE(romState.isApprox(gold, 1e-12));
+
+  EXPECT_TRUE(fusedFom.fusedCount_ > 0);
+  EXPECT_EQ(fusedFom.applyJacobianCount_, 0);
+  EXPECT_EQ(fom.applyJacobianCount_, fusedFom.fusedCount_);
+}
@@ -12,6 +12,7 @@ struct MyFom
   using rhs_type  = state_type;
   int N_ = {};
   const std::vector<int> indices_to_corrupt_ = {};
+  mutable int applyJacobianCount_ = 0;
 
   MyFom(int N, std::vector<int> ind) : N_(N), indices_to_corrupt_(ind){}
 
@@ -46,6 +47,7 @@ struct MyFom
                      time_type time,
                      OperandType & A) const
   {
+    ++applyJacobianCount_;
     A = B;
     A.array() += time;
     // corrupt some to ensure masking works
@@ -271,6 +273,29 @@ struct FakeNonLinSolver
   }
 };
 
+struct ResidualOnlyCheckSolver
+{
+  const MyFom & fom_;
+
+  template<class SystemType, class StateType>
+  void solve(const SystemType & system, StateType & state)
+  {
+    auto R = system.createResidual();
+    auto J = system.createJacobian();
+
+    // residual only, e.g. a line search objective evaluation:
+    // the fom jacobian action must not be computed
+    const int count = fom_.applyJacobianCount_;
+    system.residualAndJacobian(state, R, {});
+    EXPECT_EQ(fom_.applyJacobianCount_, count);
+    const Eigen::VectorXd Rgold = R;
+
+    system.residualAndJacobian(state, R, &J);
+    EXPECT_EQ(fom_.applyJacobianCount_, count+1);
+    EXPECT_TRUE(R.isApprox(Rgold));
+  }
+};
+
 struct Observer
 {
   void operator()(pressio::ode::StepCount stepIn,
@@ -413,3 +438,33 @@ TEST(rom_lspg_unsteady, test3)
 
   pressio::log::finalize();
 }
+
+TEST(rom_lspg_unsteady, test3_residual_only_skips_jacobian)
+{
+  /* masked lspg eigen: residual-only evaluations do not compute J*phi */
+
+  const std::vector<int> rows_to_corrupt_ = {1,3,5,7,9,11,13};
+  const std::vector<int> sample_indices = {0,2,4,6,8,10,12,14};
+  const int N = (int) (rows_to_corrupt_.size() + sample_indices.size());
+  MyFom fomSystem(N, rows_to_corrupt_);
+
+  using phi_t = Eigen::Matrix<double, -1,-1>;
+  phi_t phi(N, 3);
+  fill_phi(phi);
+
+  using namespace pressio;
+  using reduced_state_type = Eigen::VectorXd;
+  typename MyFom::state_type dummyFomState(N);
+  auto space = rom::create_trial_column_subspace<
+    reduced_state_type>(phi, dummyFomState, false);
+  auto romState = space.createReducedState();
+  romState.setConstant(1.);
+
+  MyMasker masker(sample_indices);
+  auto problem = rom::lspg::create_unsteady_problem
+    (ode::StepScheme::BDF1, space, fomSystem, masker);
+
+  ResidualOnlyCheckSolver solver{fomSystem};
+  ode::advance_n_steps(problem, romState, 0., 2., ode::StepCount(2), solver);
+  EXPECT_EQ(fomSystem.applyJacobianCount_, 2);
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include "pressio/type_traits.hpp"
+#include "pressio/ops.hpp"
+#include "pressio/rom_subspaces.hpp"
+
+TEST(rom, trial_subspace_on_rows)
+{
+  using namespace pressio::rom;
+
+  using basis_t = Eigen::MatrixXd;
+  using full_state_type = Eigen::VectorXd;
+  using reduced_state_type = Eigen::VectorXd;
+  const basis_t phi = basis_t::Random(20,3);
+  const full_state_type shift = full_state_type::Random(20);
+
+  const std::vector<int> stencilRows = {1,4,5,8,13,19};
+  auto fullSpace = create_trial_column_subspace<reduced_state_type>(phi, shift, true);
+  auto space = create_trial_column_subspace_on_rows<reduced_state_type>(phi, shift, true, stencilRows);
+  ASSERT_EQ(space.dimension(), std::size_t(3));
+  ASSERT_EQ(space.basisOfTranslatedSpace().rows(), 6);
+
+  const reduced_state_type latState = reduced_state_type::Random(3);
+  const auto gold = fullSpace.createFullStateFromReducedState(latState);
+  const auto a = space.createFullStateFromReducedState(latState);
+  ASSERT_EQ(a.size(), 6);
+  for (std::size_t i=0; i<stencilRows.size(); ++i){
+    EXPECT_NEAR(a[i], gold[stencilRows[i]], 1e-14);
+  }
+}
+
+TEST(rom, sample_mesh_rows_within_stencil_mesh)
+{
+  using namespace pressio::rom;
+
+  const std::vector<int> stencilRows = {1,4,5,8,13,19};
+  const std::vector<int> sampleRows  = {5,19,1};
+  const auto rows = sample_mesh_rows_within_stencil_mesh(sampleRows, stencilRows);
+  ASSERT_EQ(rows.size(), std::size_t(3));
+  EXPECT_EQ(rows[0], 2);
+  EXPECT_EQ(rows[1], 5);
+  EXPECT_EQ(rows[2], 0);
+
+  const std::vector<int> badSampleRows = {5,7};
+  EXPECT_THROW(sample_mesh_rows_within_stencil_mesh(badSampleRows, stencilRows),
+	       std::runtime_error);
+}
@@ -66,3 +66,276 @@ TEST(solvers_linear_eigen, dense_direct_houseqr)
   using tag = pressio::linearsolvers::direct::HouseholderQR;
   PRESSIO_SOLVERS_LINEAR_EIGEN_DENSE_UTEST(tag);
 }
+
+namespace{
+struct DenseOperator{
+  const Eigen::MatrixXd & A_;
+  void operator()(const Eigen::VectorXd & v, Eigen::VectorXd & Av) const{ Av = A_*v; }
+};
+
+struct JacobiPreconditioner{
+  Eigen::VectorXd invDiag_;
+  void operator()(const Eigen::VectorXd & v, Eigen::VectorXd & z) const{
+    z = invDiag_.cwiseProduct(v);
+  }
+};
+
+Eigen::MatrixXd create_nonsymmetric_matrix(int n){
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(n, n);
+  for (int i=0; i<n; ++i){
+    A(i,i) = 4. + i;
+    if (i>0)   { A(i,i-1) = -1.5; }
+    if (i<n-1) { A(i,i+1) = 0.5; }
+  }
+  return A;
+}
+}
+
+TEST(solvers_linear_eigen, matrix_free_gmres)
+{
+  const int n = 40;
+  const Eigen::MatrixXd A = create_nonsymmetric_matrix(n);
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(n, -1., 1.);
+  const Eigen::VectorXd b = A*gold;
+
+  pressio::linearsolvers::MatrixFreeGmres<Eigen::VectorXd> solver;
+  solver.setTolerance(1e-12);
+  Eigen::VectorXd y = Eigen::VectorXd::Zero(n);
+  solver.solve(DenseOperator{A}, b, y);
+  ASSERT_TRUE((y-gold).norm() <= 1e-10);
+  ASSERT_TRUE(solver.finalError() <= 1e-12);
+
+  // restarted, starting from a nonzero initial guess
+  pressio::linearsolvers::MatrixFreeGmres<Eigen::VectorXd> restarted;
+  restarted.setTolerance(1e-12);
+  restarted.setRestart(5);
+  restarted.setMaxIterations(500);
+  y.setConstant(1.);
+  restarted.solve(DenseOperator{A}, b, y);
+  ASSERT_TRUE((y-gold).norm() <= 1e-10);
+  ASSERT_TRUE(restarted.numIterationsExecuted() > 5);
+}
+
+TEST(solvers_linear_eigen, matrix_free_gmres_preconditioned)
+{
+  const int n = 40;
+  const Eigen::MatrixXd A = create_nonsymmetric_matrix(n);
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(n, -1., 1.);
+  const Eigen::VectorXd b = A*gold;
+
+  pressio::linearsolvers::MatrixFreeGmres<Eigen::VectorXd> solver;
+  solver.setTolerance(1e-12);
+  Eigen::VectorXd y = Eigen::VectorXd::Zero(n);
+  solver.solve(DenseOperator{A}, b, y);
+  const auto numIters = solver.numIterationsExecuted();
+
+  JacobiPreconditioner prec{A.diagonal().cwiseInverse()};
+  y.setZero();
+  solver.solve(DenseOperator{A}, prec, b, y);
+  ASSERT_TRUE((y-gold).norm() <= 1e-10);
+  ASSERT_TRUE(solver.numIterationsExecuted() < numIters);
+}
+
+namespace{
+Eigen::MatrixXd create_spd_matrix(int n){
+  const Eigen::MatrixXd J = Eigen::MatrixXd::Random(3*n, n);
+  return J.transpose()*J;
+}
+}
+
+TEST(solvers_linear_eigen, dense_direct_llt_ldlt_spd)
+{
+  const int n = 12;
+  const Eigen::MatrixXd A = create_spd_matrix(n);
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(n, -1., 1.);
+  const Eigen::VectorXd b = A*gold;
+
+  namespace pls = pressio::linearsolvers;
+  Eigen::VectorXd y(n);
+  pls::Solver<pls::direct::LLT, Eigen::MatrixXd> llt;
+  llt.solve(A, b, y);
+  ASSERT_TRUE((y-gold).norm() <= 1e-10);
+  ASSERT_FALSE(llt.usingFallback());
+
+  pls::Solver<pls::direct::LDLT, Eigen::MatrixXd> ldlt;
+  ldlt.solve(A, b, y);
+  ASSERT_TRUE((y-gold).norm() <= 1e-10);
+  ASSERT_FALSE(ldlt.usingFallback());
+
+  // only the lower triangle is used
+  Eigen::MatrixXd Alower = A.triangularView<Eigen::Lower>();
+  llt.solve(Alower, b, y);
+  ASSERT_TRUE((y-gold).norm() <= 1e-10);
+}
+
+TEST(solvers_linear_eigen, dense_direct_llt_falls_back_for_indefinite_matrix)
+{
+  // symmetric but indefinite: Cholesky fails
+  Eigen::MatrixXd A(3,3);
+  A << 1., 2., 0.,
+       2., 1., 1.,
+       0., 1., -3.;
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(3, -1., 1.);
+  const Eigen::VectorXd b = A*gold;
+
+  namespace pls = pressio::linearsolvers;
+  pls::Solver<pls::direct::LLT, Eigen::MatrixXd> solver;
+  Eigen::VectorXd y(3);
+  solver.solve(A, b, y);
+  ASSERT_TRUE(solver.usingFallback());
+  ASSERT_TRUE((y-gold).norm() <= 1e-12);
+
+  // factorization is reset when the matrix becomes SPD again
+  const Eigen::MatrixXd S = create_spd_matrix(3);
+  solver.solve(S, b, y);
+  ASSERT_FALSE(solver.usingFallback());
+  ASSERT_TRUE((S*y-b).norm() <= 1e-10);
+}
+
+TEST(solvers_linear_eigen, dense_direct_ldlt_falls_back_for_singular_matrix)
+{
+  // LDLT hits a zero pivot, LU with partial pivoting does not
+  Eigen::MatrixXd A(2,2);
+  A << 0., 1.,
+       1., 0.;
+  const Eigen::VectorXd b = (Eigen::VectorXd(2) << 3., 4.).finished();
+
+  namespace pls = pressio::linearsolvers;
+  pls::Solver<pls::direct::LDLT, Eigen::MatrixXd> solver;
+  Eigen::VectorXd y(2);
+  solver.solve(A, b, y);
+  ASSERT_TRUE(solver.usingFallback());
+  ASSERT_TRUE((A*y-b).norm() <= 1e-12);
+}
+
+TEST(solvers_linear_eigen, sparse_direct_llt)
+{
+  const int n = 20;
+  using matrix_t = Eigen::SparseMatrix<double>;
+  matrix_t A(n, n);
+  for (int i=0; i<n; ++i){
+    A.insert(i,i) = 4.;
+    if (i>0)   { A.insert(i,i-1) = -1.; }
+    if (i<n-1) { A.insert(i,i+1) = -1.; }
+  }
+  A.makeCompressed();
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(n, -1., 1.);
+  const Eigen::VectorXd b = A*gold;
+
+  namespace pls = pressio::linearsolvers;
+  pls::Solver<pls::direct::LLT, matrix_t> solver;
+  Eigen::VectorXd y(n);
+  solver.solve(A, b, y);
+  ASSERT_FALSE(solver.usingFallback());
+  ASSERT_TRUE((y-gold).norm() <= 1e-12);
+}
+
+namespace{
+Eigen::SparseMatrix<double> makeSparseSpdMatrix(int n, double diag)
+{
+  Eigen::SparseMatrix<double> A(n, n);
+  for (int i=0; i<n; ++i){
+    A.insert(i,i) = diag;
+    if (i>0)   { A.insert(i,i-1) = -1.; }
+    if (i<n-1) { A.insert(i,i+1) = -1.; }
+  }
+  A.makeCompressed();
+  return A;
+}
+}
+
+#define PRESSIO_SOLVERS_LINEAR_EIGEN_PRECONDITIONED_UTEST(TAGIN, PRECTAG) \
+  const int n = 50; \
+  const auto A = makeSparseSpdMatrix(n, 2.5); \
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(n, -1., 1.); \
+  const Eigen::VectorXd b = A*gold; \
+  using solver_t = pressio::linearsolvers::Solver<TAGIN, Eigen::SparseMatrix<double>, PRECTAG>; \
+  solver_t solver; \
+  Eigen::VectorXd y(n); \
+  solver.solve(A, b, y); \
+  ASSERT_TRUE((y-gold).norm() <= 1e-10); \
+
+TEST(solvers_linear_eigen, sparse_iterative_cg_jacobi)
+{
+  namespace pls = pressio::linearsolvers;
+  PRESSIO_SOLVERS_LINEAR_EIGEN_PRECONDITIONED_UTEST(pls::iterative::CG, pls::preconditioner::Jacobi);
+}
+
+TEST(solvers_linear_eigen, sparse_iterative_cg_incomplete_cholesky)
+{
+  namespace pls = pressio::linearsolvers;
+  PRESSIO_SOLVERS_LINEAR_EIGEN_PRECONDITIONED_UTEST(pls::iterative::CG, pls::preconditioner::IncompleteCholesky);
+}
+
+TEST(solvers_linear_eigen, sparse_iterative_bicgstab_incomplete_lut)
+{
+  namespace pls = pressio::linearsolvers;
+  PRESSIO_SOLVERS_LINEAR_EIGEN_PRECONDITIONED_UTEST(pls::iterative::Bicgstab, pls::preconditioner::IncompleteLUT);
+}
+
+TEST(solvers_linear_eigen, incomplete_factorization_preconditioners_admissible_solvers)
+{
+  namespace pls = pressio::linearsolvers;
+  using ilut = pls::preconditioner::IncompleteLUT;
+  using ichol = pls::preconditioner::IncompleteCholesky;
+  // CG needs a symmetric positive definite preconditioner
+  static_assert(!pls::PreconditionerTraits<ilut, pls::iterative::CG>::eigen_enabled, "");
+  static_assert(!pls::PreconditionerTraits<ilut, pls::iterative::LSCG>::eigen_enabled, "");
+  static_assert( pls::PreconditionerTraits<ilut, pls::iterative::Bicgstab>::eigen_enabled, "");
+  static_assert( pls::PreconditionerTraits<ichol, pls::iterative::CG>::eigen_enabled, "");
+  static_assert(!pls::PreconditionerTraits<ichol, pls::iterative::Bicgstab>::eigen_enabled, "");
+}
+
+TEST(solvers_linear_eigen, sparse_iterative_cg_warm_start)
+{
+  const int n = 50;
+  const auto A = makeSparseSpdMatrix(n, 2.5);
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(n, -1., 1.);
+  const Eigen::VectorXd b = A*gold;
+
+  namespace pls = pressio::linearsolvers;
+  pls::Solver<pls::iterative::CG, Eigen::SparseMatrix<double>> solver;
+  // too few iterations to converge from zero in one solve
+  solver.setMaxIterations(4);
+
+  Eigen::VectorXd y = Eigen::VectorXd::Zero(n);
+  solver.solve(A, b, y);
+  const auto coldError = (y-gold).norm();
+  ASSERT_TRUE(coldError > 1e-6);
+
+  // without warm start, solving again gives the same result
+  solver.solve(A, b, y);
+  ASSERT_NEAR((y-gold).norm(), coldError, 1e-14);
+
+  // with warm start, each solve continues from the previous one
+  solver.setWarmStart(true);
+  for (int i=0; i<10; ++i){
+    solver.solve(A, b, y);
+  }
+  ASSERT_TRUE((y-gold).norm() <= 1e-10);
+
+  // a non-finite initial guess is ignored
+  y.setConstant(std::numeric_limits<double>::quiet_NaN());
+  solver.solve(A, b, y);
+  ASSERT_NEAR((y-gold).norm(), coldError, 1e-14);
+}
+
+TEST(solvers_linear_eigen, sparse_iterative_cg_preconditioner_reuse)
+{
+  const int n = 50;
+  const Eigen::VectorXd gold = Eigen::VectorXd::LinSpaced(n, -1., 1.);
+
+  namespace pls = pressio::linearsolvers;
+  pls::Solver<pls::iterative::CG, Eigen::SparseMatrix<double>,
+	      pls::preconditioner::IncompleteCholesky> solver;
+  solver.setPreconditionerReuse(true);
+  for (double diag : {2.5, 2.6, 2.7}){
+    // same pattern, different values: the preconditioner of the first
+    // matrix is reused but the solution must be the one of the current matrix
+    const auto A = makeSparseSpdMatrix(n, diag);
+    const Eigen::VectorXd b = A*gold;
+    Eigen::VectorXd y(n);
+    solver.solve(A, b, y);
+    ASSERT_TRUE((y-gold).norm() <= 1e-10);
+  }
+}
@@ -122,4 +122,74 @@ TEST(solvers_linear_kokkos, dense_geqrf)
     EXPECT_TRUE( err < 1e-12);
   }
 
-}
\ No newline at end of file
+}
+template<class SolverTag>
+void runKokkosFactorizeOnceSolveMany()
+{
+  using d_layout = Kokkos::LayoutLeft;
+  using exe_space = Kokkos::DefaultExecutionSpace;
+  using k1d_d = Kokkos::View<double*, d_layout, exe_space>;
+  using k1d_h = typename k1d_d::host_mirror_type;
+  using k2d_d = Kokkos::View<double**, d_layout, exe_space>;
+  using k2d_h = typename k2d_d::host_mirror_type;
+
+  constexpr int N = 4;
+
+  // symmetric positive definite so that all solvers can be used
+  k2d_h A_h("Ah", N, N);
+  A_h(0,0)=4.; A_h(0,1)=1.; A_h(0,2)=0.; A_h(0,3)=0.;
+  A_h(1,0)=1.; A_h(1,1)=5.; A_h(1,2)=1.; A_h(1,3)=0.;
+  A_h(2,0)=0.; A_h(2,1)=1.; A_h(2,2)=6.; A_h(2,3)=1.;
+  A_h(3,0)=0.; A_h(3,1)=0.; A_h(3,2)=1.; A_h(3,3)=7.;
+  k2d_d A_d("Ad", N, N);
+  Kokkos::deep_copy(A_d, A_h);
+
+  using linear_solver_t = pressio::linearsolvers::Solver<SolverTag, k2d_d>;
+  linear_solver_t lsObj;
+  // factorize once
+  lsObj.resetLinearSystem(A_d);
+
+  for (int k=0; k<3; ++k)
+  {
+    k1d_h b_h("bh", N);
+    for (int i=0; i<N; ++i){ b_h(i) = 1. + i + k; }
+    k1d_d b_d("bd", N);
+    Kokkos::deep_copy(b_d, b_h);
+
+    k1d_d x_d("xd", N);
+    lsObj.solve(b_d, x_d);
+    k1d_h x_h("xh", N);
+    Kokkos::deep_copy(x_h, x_d);
+
+    for (int i=0; i<N; ++i){
+      double sum = 0.;
+      for (int j=0; j<N; ++j){ sum += A_h(i,j) * x_h(j); }
+      EXPECT_NEAR(sum, b_h(i), 1e-12);
+    }
+  }
+
+  // A must not have been modified
+  k2d_h A2_h("A2h", N, N);
+  Kokkos::deep_copy(A2_h, A_d);
+  for (int i=0; i<N; ++i){
+    for (int j=0; j<N; ++j){
+      EXPECT_DOUBLE_EQ(A2_h(i,j), A_h(i,j));
+    }
+  }
+}
+
+TEST(solvers_linear_kokkos, dense_getrs_factorize_once_solve_many){
+  runKokkosFactorizeOnceSolveMany<pressio::linearsolvers::direct::getrs>();
+}
+
+TEST(solvers_linear_kokkos, dense_geqrf_factorize_once_solve_many){
+  runKokkosFactorizeOnceSolveMany<pressio::linearsolvers::direct::geqrf>();
+}
+
+TEST(solvers_linear_kokkos, dense_potrsL_factorize_once_solve_many){
+  runKokkosFactorizeOnceSolveMany<pressio::linearsolvers::direct::potrsL>();
+}
+
+TEST(solvers_linear_kokkos, dense_potrsU_factorize_once_solve_many){
+  runKokkosFactorizeOnceSolveMany<pressio::linearsolvers::direct::potrsU>();
+}
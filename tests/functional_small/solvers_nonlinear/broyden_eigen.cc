@@ -0,0 +1,251 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// broyden_eigen.cc
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+#include "pressio/solvers_linear.hpp"
+#include "pressio/solvers_nonlinear_newton.hpp"
+#include "pressio/solvers_nonlinear_broyden.hpp"
+#include "pressio/solvers_nonlinear_gaussnewton.hpp"
+#include "./problems/problem3.hpp"
+
+namespace{
+
+// r_i(x) = x_i^3 + x_i - 2 + c (x_i-1 - 2 x_i + x_i+1)
+// with boundary values x_-1 = x_n = 1, so that the solution is x_i = 1
+struct CoupledCubicSystem
+{
+  using state_type    = Eigen::VectorXd;
+  using residual_type = state_type;
+  using jacobian_type = Eigen::MatrixXd;
+
+  int n_ = 8;
+  double c_ = 0.2;
+
+  state_type createState() const { return state_type::Zero(n_); }
+  residual_type createResidual() const { return residual_type::Zero(n_); }
+  jacobian_type createJacobian() const { return jacobian_type::Zero(n_, n_); }
+
+  double coupling(const state_type & x, int i) const{
+    const double left  = (i>0)    ? x(i-1) : 1.;
+    const double right = (i<n_-1) ? x(i+1) : 1.;
+    return c_*(left - 2.*x(i) + right);
+  }
+
+  void residualAndJacobian(const state_type& x,
+			   residual_type& res,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> Jin) const
+#else
+                           jacobian_type* Jin) const
+#endif
+  {
+    for (int i=0; i<n_; ++i){
+      res(i) = x(i)*x(i)*x(i) + x(i) - 2. + coupling(x, i);
+    }
+
+    if (Jin){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & jac = *Jin.value();
+#else
+      auto & jac = *Jin;
+#endif
+      jac.setZero();
+      for (int i=0; i<n_; ++i){
+	jac(i,i) = 3.*x(i)*x(i) + 1. - 2.*c_;
+	if (i>0)    { jac(i,i-1) = c_; }
+	if (i<n_-1) { jac(i,i+1) = c_; }
+      }
+    }
+  }
+};
+
+template<class SolverType>
+int solve_coupled_cubic(SolverType & solver, const CoupledCubicSystem & sys)
+{
+  auto y = sys.createState();
+  for (int i=0; i<y.size(); ++i){
+    y(i) = 1.3 - 0.05*i;
+  }
+  solver.solve(sys, y);
+  for (int i=0; i<y.size(); ++i){
+    EXPECT_NEAR(y(i), 1., 1e-10);
+  }
+  return solver.numJacobianEvaluations();
+}
+
+template<class SolverType>
+void set_tolerances(SolverType & solver){
+  solver.setStopCriterion(pressio::nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  solver.setStopTolerance(1e-12);
+  solver.setMaxIterations(50);
+}
+
+}
+
+TEST(solvers_nonlinear, broyden_good)
+{
+  using namespace pressio;
+  using jacobian_t = CoupledCubicSystem::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, jacobian_t>;
+
+  CoupledCubicSystem sys;
+  lin_solver_t linSolver1;
+  auto newton = create_newton_solver(sys, linSolver1);
+  set_tolerances(newton);
+  const int numNewton = solve_coupled_cubic(newton, sys);
+
+  lin_solver_t linSolver2;
+  auto broyden = create_broyden_good_solver(sys, linSolver2);
+  set_tolerances(broyden);
+  const int numBroyden = solve_coupled_cubic(broyden, sys);
+  EXPECT_LT(numBroyden, numNewton);
+
+  // the solver can be reused for a new solve
+  EXPECT_EQ(solve_coupled_cubic(broyden, sys), 2*numBroyden);
+}
+
+TEST(solvers_nonlinear, broyden_bad)
+{
+  using namespace pressio;
+  using jacobian_t = CoupledCubicSystem::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, jacobian_t>;
+
+  CoupledCubicSystem sys;
+  lin_solver_t linSolver1;
+  auto newton = create_newton_solver(sys, linSolver1);
+  set_tolerances(newton);
+  const int numNewton = solve_coupled_cubic(newton, sys);
+
+  lin_solver_t linSolver2;
+  auto broyden = create_broyden_bad_solver(sys, linSolver2);
+  set_tolerances(broyden);
+  const int numBroyden = solve_coupled_cubic(broyden, sys);
+  EXPECT_LT(numBroyden, numNewton);
+}
+
+TEST(solvers_nonlinear, broyden_with_frequency_one_is_newton)
+{
+  using namespace pressio;
+  using jacobian_t = CoupledCubicSystem::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, jacobian_t>;
+
+  CoupledCubicSystem sys;
+  lin_solver_t linSolver1;
+  auto newton = create_newton_solver(sys, linSolver1);
+  set_tolerances(newton);
+  const int numNewton = solve_coupled_cubic(newton, sys);
+
+  lin_solver_t linSolver2;
+  auto broyden = create_broyden_good_solver(sys, linSolver2);
+  set_tolerances(broyden);
+  broyden.setJacobianUpdateFrequency(1);
+  EXPECT_EQ(solve_coupled_cubic(broyden, sys), numNewton);
+}
+
+TEST(solvers_nonlinear, broyden_gauss_newton)
+{
+  using namespace pressio;
+  using problem_t = solvers::test::Problem3<double>;
+  using hessian_t = problem_t::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::HouseholderQR, hessian_t>;
+
+  problem_t problem;
+  lin_solver_t linSolver1;
+  auto gaussNewton = create_gauss_newton_solver(problem, linSolver1);
+  gaussNewton.setStopTolerance(1e-8);
+  gaussNewton.setMaxIterations(200);
+  auto xGN = problem.createState();
+  xGN(0) = 2.0; xGN(1) = 0.25;
+  gaussNewton.solve(problem, xGN);
+  EXPECT_NEAR(xGN(0), 2.4173449278229, 1e-6);
+  EXPECT_NEAR(xGN(1), 0.26464986197941, 1e-6);
+
+  lin_solver_t linSolver2;
+  auto solver = create_broyden_gauss_newton_solver(problem, linSolver2);
+  solver.setStopTolerance(1e-8);
+  solver.setMaxIterations(200);
+  auto x = problem.createState();
+  x(0) = 2.0; x(1) = 0.25;
+  solver.solve(problem, x);
+  EXPECT_NEAR(x(0), 2.4173449278229, 1e-6);
+  EXPECT_NEAR(x(1), 0.26464986197941, 1e-6);
+
+  // the secant updates replace Jacobian evaluations
+  EXPECT_GE(solver.numJacobianEvaluations(), 1);
+  EXPECT_LT(solver.numJacobianEvaluations(), gaussNewton.numJacobianEvaluations());
+}
+
+TEST(solvers_nonlinear, broyden_bad_skips_roundoff_level_update)
+{
+  using namespace pressio;
+  using vec_t = Eigen::VectorXd;
+  using mat_t = Eigen::MatrixXd;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, mat_t>;
+
+  const mat_t J0 = mat_t::Identity(3, 3);
+  lin_solver_t linSolver;
+  // the updates reuse the factorization of J0
+  linSolver.resetLinearSystem(J0);
+  vec_t x(3), r(3);
+  x << 1., 2., 3.;
+  r << 1., -1., 2.;
+  nonlinearsolvers::impl::LimitedMemoryInverseBroyden<vec_t, vec_t> history(x, r);
+  history.restart(x, r);
+
+  // the residual barely changes: y^T y is not zero but
+  // y is dominated by roundoff, so the update must be skipped
+  x(0) += 0.5;
+  r(1) += 1e-12;
+  history.update(nonlinearsolvers::impl::BroydenBadTag{}, x, r, linSolver, J0);
+  EXPECT_EQ(history.numUpdates(), 0u);
+
+  x(1) += 0.5;
+  r(1) += 0.1;
+  history.update(nonlinearsolvers::impl::BroydenBadTag{}, x, r, linSolver, J0);
+  EXPECT_EQ(history.numUpdates(), 1u);
+}
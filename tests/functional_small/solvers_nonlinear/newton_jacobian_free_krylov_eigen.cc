@@ -0,0 +1,172 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// newton_jacobian_free_krylov_eigen.cc
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+#include "pressio/solvers_linear.hpp"
+#include "pressio/solvers_nonlinear_newton.hpp"
+
+namespace{
+
+// r_i(x) = x_i^3 + x_i - 2 + c (x_i-1 - 2 x_i + x_i+1)
+// with boundary values x_-1 = x_n = 1, so that the solution is x_i = 1.
+// The Jacobian is only computed if requested, which JFNK never does.
+struct CoupledCubicSystem
+{
+  using state_type    = Eigen::VectorXd;
+  using residual_type = state_type;
+  using jacobian_type = Eigen::MatrixXd;
+
+  int n_ = 20;
+  double c_ = 0.2;
+  mutable int numJacobians_ = 0;
+
+  state_type createState() const { return state_type::Zero(n_); }
+  residual_type createResidual() const { return residual_type::Zero(n_); }
+  jacobian_type createJacobian() const { return jacobian_type::Zero(n_, n_); }
+
+  void residualAndJacobian(const state_type& x,
+			   residual_type& res,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> Jin) const
+#else
+                           jacobian_type* Jin) const
+#endif
+  {
+    for (int i=0; i<n_; ++i){
+      const double left  = (i>0)    ? x(i-1) : 1.;
+      const double right = (i<n_-1) ? x(i+1) : 1.;
+      res(i) = x(i)*x(i)*x(i) + x(i) - 2. + c_*(left - 2.*x(i) + right);
+    }
+
+    if (Jin){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & jac = *Jin.value();
+#else
+      auto & jac = *Jin;
+#endif
+      ++numJacobians_;
+      jac.setZero();
+      for (int i=0; i<n_; ++i){
+	jac(i,i) = 3.*x(i)*x(i) + 1. - 2.*c_;
+	if (i>0)    { jac(i,i-1) = c_; }
+	if (i<n_-1) { jac(i,i+1) = c_; }
+      }
+    }
+  }
+};
+
+// diagonal of the Jacobian, updated at every nonlinear iteration
+struct DiagonalPreconditioner
+{
+  Eigen::VectorXd invDiag_;
+  int numUpdates_ = 0;
+
+  void update(const Eigen::VectorXd & x, const Eigen::VectorXd & /*r*/){
+    invDiag_ = (3.*x.array().square() + 1. - 0.4).inverse().matrix();
+    ++numUpdates_;
+  }
+
+  void operator()(const Eigen::VectorXd & v, Eigen::VectorXd & z) const{
+    z = invDiag_.cwiseProduct(v);
+  }
+};
+
+Eigen::VectorXd initial_guess(int n){
+  Eigen::VectorXd y(n);
+  for (int i=0; i<n; ++i){
+    y(i) = 1.3 - 0.02*i;
+  }
+  return y;
+}
+
+}
+
+TEST(solvers_nonlinear, newton_jacobian_free_krylov)
+{
+  using namespace pressio;
+  using vector_t = CoupledCubicSystem::state_type;
+
+  CoupledCubicSystem sys;
+  linearsolvers::MatrixFreeGmres<vector_t> gmres;
+  gmres.setTolerance(1e-10);
+  auto solver = create_jacobian_free_newton_krylov_solver(sys, gmres);
+  solver.setStopCriterion(nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  solver.setStopTolerance(1e-10);
+  solver.setMaxIterations(20);
+
+  auto y = initial_guess(sys.n_);
+  solver.solve(sys, y);
+  for (int i=0; i<y.size(); ++i){
+    EXPECT_NEAR(y(i), 1., 1e-9);
+  }
+  EXPECT_EQ(sys.numJacobians_, 0);
+  EXPECT_EQ(solver.numJacobianEvaluations(), 0);
+}
+
+TEST(solvers_nonlinear, newton_jacobian_free_krylov_preconditioned)
+{
+  using namespace pressio;
+  using vector_t = CoupledCubicSystem::state_type;
+
+  CoupledCubicSystem sys;
+  DiagonalPreconditioner prec;
+  linearsolvers::MatrixFreeGmres<vector_t> gmres;
+  gmres.setTolerance(1e-10);
+  auto solver = create_jacobian_free_newton_krylov_solver(sys, gmres, prec);
+  solver.setStopCriterion(nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  solver.setStopTolerance(1e-10);
+  solver.setMaxIterations(20);
+
+  auto y = initial_guess(sys.n_);
+  solver.solve(sys, y);
+  for (int i=0; i<y.size(); ++i){
+    EXPECT_NEAR(y(i), 1., 1e-9);
+  }
+  EXPECT_EQ(sys.numJacobians_, 0);
+  EXPECT_GT(prec.numUpdates_, 0);
+}
@@ -0,0 +1,177 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// newton_lazy_norm_diagnostics.cc
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+#include "pressio/type_traits.hpp"
+
+/*
+  the solver must only compute the norms needed by the stop criterion,
+  plus the logged ones when a sink accepts info messages
+*/
+
+namespace{
+int correctionNormCount = 0;
+int residualNormCount = 0;
+}
+
+struct CustomVecA{};
+struct CustomVecB{};
+struct CustomMat{};
+
+namespace pressio{
+
+template<> struct Traits<CustomVecA>{
+  static constexpr int rank = 1;
+  using scalar_type = double;
+};
+template<> struct Traits<CustomVecB>{
+  static constexpr int rank = 1;
+  using scalar_type = double;
+};
+template<> struct Traits<CustomMat>{
+  static constexpr int rank = 2;
+  using scalar_type = double;
+};
+
+namespace ops{
+// the correction has the state type, the residual its own type
+double norm2(const CustomVecA &){ ++correctionNormCount; return 1.; }
+double norm2(const CustomVecB &){ ++residualNormCount; return 1.; }
+void deep_copy(CustomVecA &, const CustomVecA &){}
+void scale(CustomVecA &, double){}
+void update(CustomVecA &, double,
+	    const CustomVecA &, double,
+	    const CustomVecA &, double){}
+void update(CustomVecA &, double,
+	    const CustomVecA &, double){}
+}//end namespace ops
+}//end namespace pressio
+
+#include "pressio/solvers_nonlinear_newton.hpp"
+
+namespace{
+
+struct MyProblem{
+  using state_type = CustomVecA;
+  using residual_type = CustomVecB;
+  using jacobian_type = CustomMat;
+  state_type createState() const { return CustomVecA{}; }
+  residual_type createResidual() const { return CustomVecB{}; }
+  jacobian_type createJacobian() const { return CustomMat{}; }
+  void residualAndJacobian(const state_type& /*x*/,
+			   residual_type& /*r*/,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> /*Jo*/) const{}
+#else
+			   jacobian_type* /*Jo*/) const{}
+#endif
+};
+
+struct MyLinSolver{
+  void solve(const CustomMat & /*A*/,
+	     const CustomVecB & /*b*/,
+	     CustomVecA & /*x*/){}
+};
+
+constexpr int maxIters = 5;
+
+void runNewton(pressio::nonlinearsolvers::Stop stop)
+{
+  correctionNormCount = 0;
+  residualNormCount = 0;
+
+  MyProblem sys;
+  CustomVecA y;
+  auto solver = pressio::create_newton_solver(sys, MyLinSolver{});
+  solver.setStopCriterion(stop);
+  solver.setMaxIterations(maxIters);
+  solver.solve(y);
+}
+}
+
+TEST(solvers_nonlinear, newton_lazy_norm_diagnostics_without_logging)
+{
+  using pressio::nonlinearsolvers::Stop;
+
+  runNewton(Stop::WhenAbsolutel2NormOfCorrectionBelowTolerance);
+  EXPECT_EQ(correctionNormCount, maxIters);
+  EXPECT_EQ(residualNormCount, 0);
+
+  runNewton(Stop::WhenRelativel2NormOfResidualBelowTolerance);
+  EXPECT_EQ(correctionNormCount, 0);
+  EXPECT_EQ(residualNormCount, maxIters);
+
+  runNewton(Stop::AfterMaxIters);
+  EXPECT_EQ(correctionNormCount, 0);
+  EXPECT_EQ(residualNormCount, 0);
+}
+
+TEST(solvers_nonlinear, newton_lazy_norm_diagnostics_with_logging)
+{
+  using pressio::nonlinearsolvers::Stop;
+
+  // this test is built with logging compiled in at info level
+  static_assert(PRESSIO_LOG_ACTIVE_MIN_LEVEL == PRESSIO_LOG_LEVEL_INFO, "");
+
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::info});
+  ASSERT_TRUE(pressio::log::isEnabledFor(pressio::log::level::info));
+
+  // all the logged norms are needed
+  runNewton(Stop::AfterMaxIters);
+  EXPECT_EQ(correctionNormCount, maxIters);
+  EXPECT_EQ(residualNormCount, maxIters);
+
+  pressio::log::setVerbosity({pressio::log::level::warn});
+  EXPECT_FALSE(pressio::log::isEnabledFor(pressio::log::level::info));
+  runNewton(Stop::WhenAbsolutel2NormOfCorrectionBelowTolerance);
+  EXPECT_EQ(correctionNormCount, maxIters);
+  EXPECT_EQ(residualNormCount, 0);
+
+  pressio::log::finalize();
+}
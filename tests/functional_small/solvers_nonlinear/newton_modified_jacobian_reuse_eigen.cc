@@ -0,0 +1,237 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// newton_modified_jacobian_reuse_eigen.cc
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+#include "pressio/solvers_linear.hpp"
+#include "pressio/solvers_nonlinear_newton.hpp"
+#include "pressio/solvers_nonlinear_gaussnewton.hpp"
+#include "./problems/problem3.hpp"
+
+namespace{
+
+// r_i(x) = x_i^3 + x_i - b_i, with solution x_i = 1 for b_i = 2
+struct CubicSystem
+{
+  using state_type    = Eigen::VectorXd;
+  using residual_type = state_type;
+  using jacobian_type = Eigen::MatrixXd;
+
+  int n_ = 5;
+  mutable int numEvaluations_ = 0;
+
+  state_type createState() const { return state_type::Zero(n_); }
+  residual_type createResidual() const { return residual_type::Zero(n_); }
+  jacobian_type createJacobian() const { return jacobian_type::Zero(n_, n_); }
+
+  void residualAndJacobian(const state_type& x,
+			   residual_type& res,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> Jin) const
+#else
+                           jacobian_type* Jin) const
+#endif
+  {
+    ++numEvaluations_;
+    for (int i=0; i<n_; ++i){
+      res(i) = x(i)*x(i)*x(i) + x(i) - 2.;
+    }
+
+    if (Jin){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & jac = *Jin.value();
+#else
+      auto & jac = *Jin;
+#endif
+      jac.setZero();
+      for (int i=0; i<n_; ++i){
+	jac(i,i) = 3.*x(i)*x(i) + 1.;
+      }
+    }
+  }
+};
+
+template<class SolverType>
+int solve_cubic(SolverType & solver, const CubicSystem & sys)
+{
+  auto y = sys.createState();
+  y.setConstant(1.2);
+  solver.solve(sys, y);
+  for (int i=0; i<y.size(); ++i){
+    EXPECT_NEAR(y(i), 1., 1e-10);
+  }
+  return solver.numJacobianEvaluations();
+}
+
+}
+
+TEST(solvers_nonlinear, newton_jacobian_reuse)
+{
+  using namespace pressio;
+  using jacobian_t = CubicSystem::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, jacobian_t>;
+
+  CubicSystem sys;
+  lin_solver_t linSolver1;
+  auto standard = create_newton_solver(sys, linSolver1);
+  standard.setStopCriterion(nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  standard.setStopTolerance(1e-12);
+  const int numStandard = solve_cubic(standard, sys);
+
+  lin_solver_t linSolver2;
+  auto modified = create_newton_solver(sys, linSolver2);
+  modified.setStopCriterion(nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  modified.setStopTolerance(1e-12);
+  modified.setJacobianUpdateFrequency(100);
+  modified.setJacobianUpdateRateThreshold(0.9);
+  const int numModified = solve_cubic(modified, sys);
+
+  EXPECT_EQ(numModified, 1);
+  EXPECT_GT(numStandard, numModified);
+}
+
+TEST(solvers_nonlinear, newton_jacobian_reuse_rate_threshold)
+{
+  using namespace pressio;
+  using jacobian_t = CubicSystem::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, jacobian_t>;
+
+  CubicSystem sys;
+  lin_solver_t linSolver;
+  auto solver = create_newton_solver(sys, linSolver);
+  solver.setStopCriterion(nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  solver.setStopTolerance(1e-12);
+  solver.setMaxIterations(50);
+  solver.setJacobianUpdateFrequency(100);
+  // a tiny threshold forces the update at every iteration
+  solver.setJacobianUpdateRateThreshold(1e-12);
+  const int numEvals = solve_cubic(solver, sys);
+  EXPECT_GT(numEvals, 1);
+}
+
+TEST(solvers_nonlinear, newton_jacobian_reuse_across_solves)
+{
+  using namespace pressio;
+  using jacobian_t = CubicSystem::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, jacobian_t>;
+
+  CubicSystem sys;
+  lin_solver_t linSolver;
+  auto solver = create_newton_solver(sys, linSolver);
+  solver.setStopCriterion(nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  solver.setStopTolerance(1e-12);
+  solver.setJacobianUpdateFrequency(100);
+  solver.setJacobianUpdateRateThreshold(0.9);
+
+  solver.setJacobianReuseAcrossSolves(false);
+  solve_cubic(solver, sys);
+  EXPECT_EQ(solve_cubic(solver, sys), 2);
+
+  solver.setJacobianReuseAcrossSolves(true);
+  EXPECT_EQ(solve_cubic(solver, sys), 2);
+}
+
+TEST(solvers_nonlinear, gauss_newton_jacobian_reuse)
+{
+  using namespace pressio;
+  using problem_t = solvers::test::Problem3<double>;
+  using hessian_t = problem_t::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::HouseholderQR, hessian_t>;
+
+  problem_t problem;
+  lin_solver_t linSolver;
+  auto solver = create_gauss_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-8);
+  solver.setMaxIterations(200);
+  solver.setJacobianUpdateFrequency(5);
+  solver.setJacobianUpdateRateThreshold(0.99);
+
+  auto x = problem.createState();
+  x(0) = 2.0; x(1) = 0.25;
+  solver.solve(problem, x);
+  EXPECT_NEAR(x(0), 2.4173449278229, 1e-6);
+  EXPECT_NEAR(x(1), 0.26464986197941, 1e-6);
+
+  lin_solver_t linSolver2;
+  auto standard = create_gauss_newton_solver(problem, linSolver2);
+  standard.setStopTolerance(1e-8);
+  x(0) = 2.0; x(1) = 0.25;
+  standard.solve(problem, x);
+  EXPECT_LT(solver.numJacobianEvaluations(), standard.numJacobianEvaluations());
+}
+
+TEST(solvers_nonlinear, jacobian_reuse_evaluates_residual_once_per_iteration)
+{
+  // the iterations refreshing the Jacobian must not evaluate the residual twice
+  using namespace pressio;
+  using jacobian_t = CubicSystem::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::direct::PartialPivLU, jacobian_t>;
+  constexpr int numIterations = 6;
+
+  CubicSystem sys;
+  lin_solver_t linSolver;
+  auto newton = create_newton_solver(sys, linSolver);
+  newton.setStopCriterion(nonlinearsolvers::Stop::AfterMaxIters);
+  newton.setMaxIterations(numIterations);
+  newton.setJacobianUpdateFrequency(3);
+  auto y = sys.createState();
+  y.setConstant(1.2);
+  newton.solve(sys, y);
+  EXPECT_EQ(sys.numEvaluations_, numIterations);
+  EXPECT_EQ(newton.numJacobianEvaluations(), 2);
+
+  lin_solver_t linSolver2;
+  auto gaussNewton = create_gauss_newton_solver(sys, linSolver2);
+  gaussNewton.setStopCriterion(nonlinearsolvers::Stop::AfterMaxIters);
+  gaussNewton.setMaxIterations(numIterations);
+  gaussNewton.setJacobianUpdateFrequency(3);
+  sys.numEvaluations_ = 0;
+  y.setConstant(1.2);
+  gaussNewton.solve(sys, y);
+  EXPECT_EQ(sys.numEvaluations_, numIterations);
+  EXPECT_EQ(gaussNewton.numJacobianEvaluations(), 2);
+}